@@ -0,0 +1,124 @@
+# Model artifacts generated from data/autoencoder.tflite, shared by the firmware and host builds.
+#
+# Expects PYTHON_EXECUTABLE, MODEL_TFLITE, MODEL_DATA_DIR, MODEL_SCRIPTS_DIR, GENERATED_DIR,
+# MODEL_ACTIVE_TFLITE, APP_MODEL_VARIANT, APP_INFERENCE_BATCH_SIZE, APP_OFFLINE_PLAN and APP_SPARSITY
+# to be set; the caller adds the outputs it needs to its own targets.
+
+file(MAKE_DIRECTORY ${GENERATED_DIR})
+
+# Float model the firmware embeds: the original, or a block-sparse copy when APP_SPARSITY > 0
+if(APP_SPARSITY)
+    if(NOT APP_MODEL_VARIANT STREQUAL "float")
+        message(FATAL_ERROR "APP_SPARSITY supports only APP_MODEL_VARIANT=float")
+    endif()
+    set(MODEL_FLOAT_TFLITE ${GENERATED_DIR}/autoencoder_sparse.tflite)
+    set(MODEL_ACTIVE_TFLITE ${MODEL_FLOAT_TFLITE})
+    add_custom_command(
+        OUTPUT ${MODEL_FLOAT_TFLITE}
+        COMMAND ${PYTHON_EXECUTABLE} ${MODEL_SCRIPTS_DIR}/sparse_model.py
+                ${MODEL_TFLITE} --output ${MODEL_FLOAT_TFLITE} --sparsity ${APP_SPARSITY}
+        DEPENDS ${MODEL_TFLITE} ${MODEL_SCRIPTS_DIR}/sparse_model.py ${MODEL_SCRIPTS_DIR}/quantize_model.py
+                ${MODEL_SCRIPTS_DIR}/generate_kernels.py ${MODEL_SCRIPTS_DIR}/tflite_model.py
+        COMMENT "Pruning autoencoder model to ${APP_SPARSITY}% block sparsity"
+    )
+else()
+    set(MODEL_FLOAT_TFLITE ${MODEL_TFLITE})
+endif()
+
+# Embedded models carry TFLM's offline memory plan unless APP_OFFLINE_PLAN is off
+if(APP_OFFLINE_PLAN)
+    set(OFFLINE_PLAN_FLAGS "")
+else()
+    set(OFFLINE_PLAN_FLAGS --strip)
+endif()
+set(OFFLINE_PLAN_SCRIPTS ${MODEL_SCRIPTS_DIR}/offline_plan.py ${MODEL_SCRIPTS_DIR}/arena_size.py)
+
+# Float model embedded as a const, 16-byte aligned array so it stays in flash
+add_custom_command(
+    OUTPUT ${GENERATED_DIR}/autoencoder_planned.tflite ${GENERATED_DIR}/autoencoder_model.cc
+    COMMAND ${PYTHON_EXECUTABLE} ${MODEL_SCRIPTS_DIR}/offline_plan.py
+            ${MODEL_FLOAT_TFLITE} ${GENERATED_DIR}/autoencoder_planned.tflite ${OFFLINE_PLAN_FLAGS}
+    COMMAND ${PYTHON_EXECUTABLE} ${MODEL_SCRIPTS_DIR}/tflite_to_c.py
+            ${GENERATED_DIR}/autoencoder_planned.tflite ${GENERATED_DIR}/autoencoder_model.cc
+            --symbol autoencoder_model_tflite
+    DEPENDS ${MODEL_FLOAT_TFLITE} ${MODEL_SCRIPTS_DIR}/tflite_to_c.py ${MODEL_SCRIPTS_DIR}/tflite_model.py ${OFFLINE_PLAN_SCRIPTS}
+    COMMENT "Embedding autoencoder model"
+)
+
+# Full-integer int8 variant, calibrated on the data/machine_*/ CSVs
+add_custom_command(
+    OUTPUT ${GENERATED_DIR}/autoencoder_int8.tflite ${GENERATED_DIR}/autoencoder_int8_model.cc
+    COMMAND ${PYTHON_EXECUTABLE} ${MODEL_SCRIPTS_DIR}/quantize_model.py
+            ${MODEL_TFLITE} ${MODEL_DATA_DIR} ${GENERATED_DIR}/autoencoder_int8.tflite
+    COMMAND ${PYTHON_EXECUTABLE} ${MODEL_SCRIPTS_DIR}/offline_plan.py
+            ${GENERATED_DIR}/autoencoder_int8.tflite ${GENERATED_DIR}/autoencoder_int8.tflite ${OFFLINE_PLAN_FLAGS}
+    COMMAND ${PYTHON_EXECUTABLE} ${MODEL_SCRIPTS_DIR}/tflite_to_c.py
+            ${GENERATED_DIR}/autoencoder_int8.tflite ${GENERATED_DIR}/autoencoder_int8_model.cc
+            --symbol autoencoder_int8_model_tflite
+    DEPENDS ${MODEL_TFLITE} ${MODEL_SCRIPTS_DIR}/quantize_model.py ${MODEL_SCRIPTS_DIR}/replay_data.py
+            ${MODEL_SCRIPTS_DIR}/tflite_model.py ${MODEL_SCRIPTS_DIR}/tflite_to_c.py ${OFFLINE_PLAN_SCRIPTS}
+    COMMENT "Quantizing autoencoder model to int8"
+)
+
+# Replayed CSV windows for the accuracy/latency harnesses
+add_custom_command(
+    OUTPUT ${GENERATED_DIR}/replay_data.cc
+    COMMAND ${PYTHON_EXECUTABLE} ${MODEL_SCRIPTS_DIR}/replay_data.py ${MODEL_DATA_DIR} ${GENERATED_DIR}/replay_data.cc
+    DEPENDS ${MODEL_SCRIPTS_DIR}/replay_data.py
+    COMMENT "Generating replay data from CSVs"
+)
+
+# Batched copy of the active model: batch dimension INFERENCE_BATCH_SIZE, same weights
+add_custom_command(
+    OUTPUT ${GENERATED_DIR}/autoencoder_batch.tflite ${GENERATED_DIR}/autoencoder_batch_model.cc
+    COMMAND ${PYTHON_EXECUTABLE} ${MODEL_SCRIPTS_DIR}/batch_model.py
+            ${MODEL_ACTIVE_TFLITE} ${GENERATED_DIR}/autoencoder_batch.tflite --batch ${APP_INFERENCE_BATCH_SIZE}
+    COMMAND ${PYTHON_EXECUTABLE} ${MODEL_SCRIPTS_DIR}/offline_plan.py
+            ${GENERATED_DIR}/autoencoder_batch.tflite ${GENERATED_DIR}/autoencoder_batch.tflite ${OFFLINE_PLAN_FLAGS}
+    COMMAND ${PYTHON_EXECUTABLE} ${MODEL_SCRIPTS_DIR}/tflite_to_c.py
+            ${GENERATED_DIR}/autoencoder_batch.tflite ${GENERATED_DIR}/autoencoder_batch_model.cc
+            --symbol autoencoder_batch_model_tflite
+    DEPENDS ${MODEL_ACTIVE_TFLITE} ${MODEL_SCRIPTS_DIR}/batch_model.py ${MODEL_SCRIPTS_DIR}/tflite_model.py
+            ${MODEL_SCRIPTS_DIR}/tflite_to_c.py ${OFFLINE_PLAN_SCRIPTS}
+    COMMENT "Generating batched ${APP_MODEL_VARIANT} autoencoder model (batch ${APP_INFERENCE_BATCH_SIZE})"
+)
+
+# Tensor arena sizes derived from each model's activation high-water mark
+add_custom_command(
+    OUTPUT ${GENERATED_DIR}/arena_sizes.h
+    COMMAND ${PYTHON_EXECUTABLE} ${MODEL_SCRIPTS_DIR}/arena_size.py ${GENERATED_DIR}/arena_sizes.h
+            FLOAT=${MODEL_FLOAT_TFLITE} INT8=${GENERATED_DIR}/autoencoder_int8.tflite
+            BATCH=${GENERATED_DIR}/autoencoder_batch.tflite
+    DEPENDS ${MODEL_FLOAT_TFLITE} ${GENERATED_DIR}/autoencoder_int8.tflite ${GENERATED_DIR}/autoencoder_batch.tflite
+            ${MODEL_SCRIPTS_DIR}/arena_size.py ${MODEL_SCRIPTS_DIR}/tflite_model.py
+    COMMENT "Sizing tensor arenas"
+)
+
+# Op resolver with exactly the ops the embedded models use
+add_custom_command(
+    OUTPUT ${GENERATED_DIR}/model_op_resolver.h
+    COMMAND ${PYTHON_EXECUTABLE} ${MODEL_SCRIPTS_DIR}/generate_resolver.py ${GENERATED_DIR}/model_op_resolver.h
+            ${MODEL_FLOAT_TFLITE} ${GENERATED_DIR}/autoencoder_int8.tflite ${GENERATED_DIR}/autoencoder_batch.tflite
+    DEPENDS ${MODEL_FLOAT_TFLITE} ${GENERATED_DIR}/autoencoder_int8.tflite ${GENERATED_DIR}/autoencoder_batch.tflite
+            ${MODEL_SCRIPTS_DIR}/generate_resolver.py ${MODEL_SCRIPTS_DIR}/tflite_model.py
+    COMMENT "Generating op resolver"
+)
+
+# Float model compiled into a straight-line C++ forward pass (no MicroInterpreter)
+add_custom_command(
+    OUTPUT ${GENERATED_DIR}/autoencoder_compiled.h
+    COMMAND ${PYTHON_EXECUTABLE} ${MODEL_SCRIPTS_DIR}/generate_kernels.py
+            ${MODEL_TFLITE} ${GENERATED_DIR}/autoencoder_compiled.h
+    DEPENDS ${MODEL_TFLITE} ${MODEL_SCRIPTS_DIR}/generate_kernels.py ${MODEL_SCRIPTS_DIR}/tflite_model.py
+    COMMENT "Compiling autoencoder model to C++ kernels"
+)
+
+# Dense and block-sparse (50/75/90%) weights for the sparse FullyConnected benchmark
+add_custom_command(
+    OUTPUT ${GENERATED_DIR}/sparse_benchmark.h
+    COMMAND ${PYTHON_EXECUTABLE} ${MODEL_SCRIPTS_DIR}/sparse_model.py
+            ${MODEL_TFLITE} --benchmark-header ${GENERATED_DIR}/sparse_benchmark.h
+    DEPENDS ${MODEL_TFLITE} ${MODEL_SCRIPTS_DIR}/sparse_model.py ${MODEL_SCRIPTS_DIR}/quantize_model.py
+            ${MODEL_SCRIPTS_DIR}/generate_kernels.py ${MODEL_SCRIPTS_DIR}/tflite_model.py
+    COMMENT "Packing sparse benchmark weights"
+)
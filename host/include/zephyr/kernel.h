@@ -0,0 +1,67 @@
+#ifndef HOST_ZEPHYR_KERNEL_H
+#define HOST_ZEPHYR_KERNEL_H
+
+// Host stand-in for the few kernel services the inference library uses. The cycle counter
+// runs at 1 GHz (nanoseconds of the monotonic clock), so cycle figures read as ns on the host.
+
+#include <sched.h>
+#include <stdint.h>
+#include <time.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+static inline uint64_t host_monotonic_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+static inline uint32_t k_cycle_get_32(void)
+{
+    return (uint32_t)host_monotonic_ns();
+}
+
+static inline uint32_t k_cyc_to_us_floor32(uint32_t cycles)
+{
+    return cycles / 1000u;
+}
+
+static inline uint64_t k_cyc_to_ns_floor64(uint64_t cycles)
+{
+    return cycles;
+}
+
+static inline int64_t k_uptime_get(void)
+{
+    return (int64_t)(host_monotonic_ns() / 1000000u);
+}
+
+static inline uint32_t k_uptime_get_32(void)
+{
+    return (uint32_t)k_uptime_get();
+}
+
+// Ticks are nanoseconds too
+static inline int64_t k_uptime_ticks(void)
+{
+    return (int64_t)host_monotonic_ns();
+}
+
+static inline uint64_t k_ticks_to_us_floor64(uint64_t ticks)
+{
+    return ticks / 1000u;
+}
+
+static inline void k_yield(void)
+{
+    sched_yield();
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HOST_ZEPHYR_KERNEL_H
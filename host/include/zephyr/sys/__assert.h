@@ -0,0 +1,9 @@
+#ifndef HOST_ZEPHYR_SYS_ASSERT_H
+#define HOST_ZEPHYR_SYS_ASSERT_H
+
+#include <assert.h>
+
+#define __ASSERT(test, ...) assert(test)
+#define __ASSERT_NO_MSG(test) assert(test)
+
+#endif // HOST_ZEPHYR_SYS_ASSERT_H
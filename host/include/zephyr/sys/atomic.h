@@ -0,0 +1,24 @@
+#ifndef HOST_ZEPHYR_SYS_ATOMIC_H
+#define HOST_ZEPHYR_SYS_ATOMIC_H
+
+// Host stand-in for the Zephyr atomics the inference library uses, on the compiler builtins
+
+#include <stdbool.h>
+
+typedef long atomic_t;
+typedef long atomic_val_t;
+typedef void* atomic_ptr_t;
+typedef void* atomic_ptr_val_t;
+
+#define ATOMIC_INIT(i)      (i)
+#define ATOMIC_PTR_INIT(p)  (p)
+
+static inline atomic_val_t atomic_get(const atomic_t* target) { return __atomic_load_n(target, __ATOMIC_SEQ_CST); }
+static inline atomic_val_t atomic_set(atomic_t* target, atomic_val_t value) { return __atomic_exchange_n(target, value, __ATOMIC_SEQ_CST); }
+static inline atomic_val_t atomic_inc(atomic_t* target) { return __atomic_fetch_add(target, 1, __ATOMIC_SEQ_CST); }
+static inline atomic_val_t atomic_dec(atomic_t* target) { return __atomic_fetch_sub(target, 1, __ATOMIC_SEQ_CST); }
+
+static inline atomic_ptr_val_t atomic_ptr_get(const atomic_ptr_t* target) { return __atomic_load_n(target, __ATOMIC_SEQ_CST); }
+static inline atomic_ptr_val_t atomic_ptr_set(atomic_ptr_t* target, atomic_ptr_val_t value) { return __atomic_exchange_n(target, value, __ATOMIC_SEQ_CST); }
+
+#endif // HOST_ZEPHYR_SYS_ATOMIC_H
@@ -0,0 +1,9 @@
+#ifndef HOST_ZEPHYR_SYS_PRINTK_H
+#define HOST_ZEPHYR_SYS_PRINTK_H
+
+#include <stdio.h>
+
+// Library diagnostics go to stderr so stdout carries only the replay's scores
+#define printk(...) fprintf(stderr, __VA_ARGS__)
+
+#endif // HOST_ZEPHYR_SYS_PRINTK_H
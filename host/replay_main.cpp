@@ -0,0 +1,276 @@
+/*
+//  replay_main.cpp - Score recorded or generated sensor windows on the host as fast as possible
+//
+//  Replays the data/machine_<n>/ CSVs (or --generate N windows per machine drawn
+//  uniformly from the configured ranges, like data/simulate_data.py) through
+//  the same inference library as the firmware: windows are normalized like
+//  pack_window(), scored in chunks of INFERENCE_BATCH_SIZE with
+//  tflite_run_window_inference() and judged by anomaly_judge(). Per-window
+//  scores go to stdout as CSV; throughput goes to stderr.
+//
+//  Usage: replay [--data DIR] [--generate N] [--repeat R] [--seed S] [--quiet] [--benchmark]
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "tflite_wrapper.h"
+#include "anomaly.h"
+#include "sample_ring.h"
+#include "sparse_kernels.h"
+#include "score_cache.h"
+#include "fleet_store.h"
+#include "object_pool.h"
+
+#define NUM_MACHINES    3
+
+// Mirrors machine_configs in src/main.c
+static const MachineConfig machine_configs[NUM_MACHINES] =
+{
+    {   "Air Compressor",
+        {   {"Temperature", 60.0f, 100.0f},
+            {"Pressure", 72.0f, 145.0f},
+            {"Vibration", 0.5f, 2.0f} },
+        3
+    },
+    {   "Steam Boiler",
+        {   {"Temperature", 150.0f, 250.0f},
+            {"Pressure", 87.0f, 360.0f},
+            {"", 0.0f, 0.0f} },
+        2
+    },
+    {   "Electric Motor",
+        {   {"Temperature", 60.0f, 105.0f},
+            {"", 0.0f, 0.0f},
+            {"", 0.0f, 0.0f} },
+        1
+    }
+};
+
+// CSV file suffix per model feature, as written by data/simulate_data.py
+static const char* const csv_suffixes[MODEL_NUM_FEATURES] = {"temp", "pressure", "vibration"};
+
+typedef struct {
+    std::vector<float> windows;         // count x MODEL_NUM_FEATURES, normalized
+    std::vector<uint8_t> machines;      // Machine index of each window
+} WindowSet;
+
+// Second column of a "timestamp,value" CSV; false if the file cannot be opened
+static bool read_column(const std::string& path, std::vector<float>& values)
+{
+    FILE* f = fopen(path.c_str(), "r");
+    if (f == NULL) {
+        return false;
+    }
+
+    char line[128];
+    bool header = true;
+    while (fgets(line, sizeof(line), f) != NULL) {
+        const char* comma = strchr(line, ',');
+        if (header || comma == NULL) {
+            header = false;
+            continue;
+        }
+        values.push_back(strtof(comma + 1, NULL));
+    }
+    fclose(f);
+    return true;
+}
+
+// One window per CSV row, machines interleaved by row like scripts/replay_data.py
+static bool load_csv_windows(const char* data_dir, WindowSet* set)
+{
+    std::vector<float> columns[NUM_MACHINES][MODEL_NUM_FEATURES];
+    size_t rows[NUM_MACHINES];
+    size_t max_rows = 0;
+
+    for (int m = 0; m < NUM_MACHINES; m++) {
+        rows[m] = SIZE_MAX;
+        for (int f = 0; f < machine_configs[m].num_sensors; f++) {
+            std::string machine = "machine_" + std::to_string(m + 1);
+            std::string path = std::string(data_dir) + "/" + machine + "/" + machine + "_" + csv_suffixes[f] + ".csv";
+            if (!read_column(path, columns[m][f])) {
+                fprintf(stderr, "Error: cannot read %s\n", path.c_str());
+                return false;
+            }
+            if (columns[m][f].size() < rows[m]) rows[m] = columns[m][f].size();
+        }
+        if (rows[m] > max_rows) max_rows = rows[m];
+    }
+
+    for (size_t r = 0; r < max_rows; r++) {
+        for (int m = 0; m < NUM_MACHINES; m++) {
+            if (r >= rows[m]) continue;
+
+            const MachineConfig* config = &machine_configs[m];
+            for (int f = 0; f < MODEL_NUM_FEATURES; f++) {
+                float x = 0.0f;                                 // Missing sensors stay at 0
+                if (f < config->num_sensors) {
+                    const SensorConfig* s = &config->sensors[f];
+                    x = (columns[m][f][r] - s->min_value) / (s->max_value - s->min_value);
+                }
+                set->windows.push_back(x);
+            }
+            set->machines.push_back((uint8_t)m);
+        }
+    }
+    return true;
+}
+
+// count windows per machine, uniform over each sensor's configured range
+static void generate_windows(size_t count, unsigned seed, WindowSet* set)
+{
+    srand(seed);
+    set->windows.reserve(count * NUM_MACHINES * MODEL_NUM_FEATURES);
+    set->machines.reserve(count * NUM_MACHINES);
+
+    for (size_t r = 0; r < count; r++) {
+        for (int m = 0; m < NUM_MACHINES; m++) {
+            for (int f = 0; f < MODEL_NUM_FEATURES; f++) {
+                set->windows.push_back(f < machine_configs[m].num_sensors ? rand() / (float)RAND_MAX : 0.0f);
+            }
+            set->machines.push_back((uint8_t)m);
+        }
+    }
+}
+
+static void usage(const char* argv0)
+{
+    fprintf(stderr,
+        "Usage: %s [--data DIR] [--generate N] [--repeat R] [--seed S] [--quiet] [--benchmark]\n"
+        "  --data DIR     Directory with machine_*/ CSVs (default %s)\n"
+        "  --generate N   Score N generated windows per machine instead of the CSVs\n"
+        "  --repeat R     Score the window set R times (default 1)\n"
+        "  --seed S       Seed for --generate (default 1)\n"
+        "  --quiet        Only report throughput, no per-window scores\n"
+        "  --benchmark    Run the firmware's boot benchmarks and exit (needs -DAPP_BENCHMARK=ON)\n",
+        argv0, REPLAY_DATA_DIR);
+}
+
+int main(int argc, char** argv)
+{
+    const char* data_dir = REPLAY_DATA_DIR;
+    size_t generate = 0;
+    long repeat = 1;
+    unsigned seed = 1;
+    bool quiet = false;
+    bool benchmark = false;
+
+    for (int i = 1; i < argc; i++) {
+        bool has_value = i + 1 < argc;
+        if (strcmp(argv[i], "--data") == 0 && has_value) {
+            data_dir = argv[++i];
+        } else if (strcmp(argv[i], "--generate") == 0 && has_value) {
+            generate = strtoull(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--repeat") == 0 && has_value) {
+            repeat = strtol(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--seed") == 0 && has_value) {
+            seed = (unsigned)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--quiet") == 0) {
+            quiet = true;
+        } else if (strcmp(argv[i], "--benchmark") == 0) {
+            benchmark = true;
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    if (repeat < 1) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    if (benchmark) {
+#ifdef APP_BENCHMARK
+        tflite_setup();
+        tflite_run_benchmarks();
+        sample_ring_run_benchmark();
+        sensor_run_benchmark();
+        sparse_run_benchmark();
+        score_cache_run_benchmark();
+        fleet_run_benchmark();
+        object_pool_run_benchmark();
+        return 0;
+#else
+        fprintf(stderr, "Error: built without APP_BENCHMARK\n");
+        return 2;
+#endif
+    }
+
+    WindowSet set;
+    if (generate > 0) {
+        generate_windows(generate, seed, &set);
+    } else if (!load_csv_windows(data_dir, &set)) {
+        return 1;
+    }
+    size_t count = set.machines.size();
+    if (count == 0) {
+        fprintf(stderr, "Error: no windows to score\n");
+        return 1;
+    }
+
+    tflite_setup();
+
+    static const char* const names[NUM_MACHINES] = {"Air_Compressor_1", "Steam_Boiler_1", "Electric_Motor_1"};
+    static const MachineType types[NUM_MACHINES] = {AIR_COMPRESSOR, STEAM_BOILER, ELECTRIC_MOTOR};
+    MachineHandle machines[NUM_MACHINES];
+    for (int m = 0; m < NUM_MACHINES; m++) {
+        machines[m] = create_machine(names[m], types[m]);
+    }
+
+    // Per-window handle/config arrays so every chunk is one contiguous call
+    std::vector<MachineHandle> handles(count);
+    std::vector<const MachineConfig*> configs(count);
+    std::vector<const float*> windows(count);           // Scored where they lie in set.windows
+    for (size_t i = 0; i < count; i++) {
+        handles[i] = machines[set.machines[i]];
+        configs[i] = &machine_configs[set.machines[i]];
+        windows[i] = &set.windows[i * MODEL_NUM_FEATURES];
+    }
+
+    std::vector<InferenceResult> results(count);
+    std::vector<AnomalyVerdict> verdicts(count);
+    size_t anomalies = 0;
+
+    if (!quiet) {
+        printf("window,machine,mse,mae,threshold,anomalous\n");      // stdio takes its buffer before the seal
+    }
+    object_pool_seal_heap();                            // Scoring itself must not allocate
+    auto start = std::chrono::steady_clock::now();
+    for (long pass = 0; pass < repeat; pass++) {
+        anomaly_reset();
+        for (size_t i = 0; i < count; i += INFERENCE_BATCH_SIZE) {
+            int n = (int)(count - i < INFERENCE_BATCH_SIZE ? count - i : INFERENCE_BATCH_SIZE);
+            if (tflite_run_window_inference(&handles[i], &configs[i], &windows[i], n, &results[i]) != 0) {
+                fprintf(stderr, "Error: inference failed at window %zu\n", i);
+                return 1;
+            }
+            for (int j = 0; j < n; j++) {
+                anomaly_judge(set.machines[i + j], &results[i + j], &verdicts[i + j]);
+            }
+        }
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    for (size_t i = 0; i < count; i++) {
+        anomalies += verdicts[i].anomalous;
+        if (!quiet) {
+            printf("%zu,%s,%.6f,%.6f,%.6f,%u\n", i, machine_configs[set.machines[i]].name,
+                verdicts[i].mse, verdicts[i].mae, verdicts[i].threshold, verdicts[i].anomalous);
+        }
+    }
+
+    double scored = (double)count * repeat;
+    fprintf(stderr, "%zu windows x %ld passes in %.3f s: %.0f windows/s (%.3f us/window), %zu anomalous\n",
+        count, repeat, seconds, scored / seconds, seconds * 1e6 / scored, anomalies);
+    object_pool_report();
+
+    for (int m = 0; m < NUM_MACHINES; m++) {
+        destroy_machine(machines[m]);
+    }
+    return 0;
+}
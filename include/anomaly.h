@@ -0,0 +1,38 @@
+#ifndef ANOMALY_H
+#define ANOMALY_H
+
+#include "tflite_wrapper.h"
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ANOMALY_MAX_MACHINES    16
+#define ANOMALY_ALPHA           0.05f   // EWMA weight of the newest normal score
+#define ANOMALY_K               4.0f    // Threshold = EWMA mean + K * EWMA stddev of the machine's score
+#define ANOMALY_MIN_THRESHOLD   0.005f  // Floor while the score variance is still tiny
+#define ANOMALY_WARMUP          8       // Scores learned before any verdict is given
+
+typedef struct {
+    float mse;                  // Reconstruction error the verdict is based on
+    float mae;
+    float threshold;            // Adaptive threshold it was judged against
+    uint8_t machine;
+    uint8_t anomalous;          // 1 when mse > threshold
+    uint8_t warming_up;         // 1 while the machine's threshold is still being learned
+} AnomalyVerdict;
+
+// Judge one inference result against the machine's adaptive threshold. Only normal scores feed
+// the EWMA, so a developing fault cannot drag the threshold up behind it.
+void anomaly_judge(int machine, const InferenceResult* result, AnomalyVerdict* verdict);
+
+// Judge a reused score (score_cache.h) the same way, without feeding it to the EWMA again
+void anomaly_check(int machine, const InferenceResult* result, AnomalyVerdict* verdict);
+void anomaly_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ANOMALY_H
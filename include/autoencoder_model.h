@@ -4,4 +4,16 @@
 extern const unsigned char autoencoder_model_tflite[];
 extern const unsigned int autoencoder_model_tflite_len;
 
+// Generated at build time by scripts/quantize_model.py (full-integer int8 variant)
+extern const unsigned char autoencoder_int8_model_tflite[];
+extern const unsigned int autoencoder_int8_model_tflite_len;
+
+// Generated at build time by scripts/batch_model.py (batch dimension = INFERENCE_BATCH_SIZE)
+extern const unsigned char autoencoder_batch_model_tflite[];
+extern const unsigned int autoencoder_batch_model_tflite_len;
+
+// Generated by scripts/model_image.py with APP_MODEL_UPDATE_DEMO (flash slot image, header included)
+extern const unsigned char model_update_image[];
+extern const unsigned int model_update_image_len;
+
 #endif  // AUTOENCODER_MODEL_H_
@@ -0,0 +1,33 @@
+#ifndef COMPILED_KERNELS_H
+#define COMPILED_KERNELS_H
+
+#include <math.h>
+
+// Fixed-size layer kernels used by the generated forward pass (scripts/generate_kernels.py).
+// Every loop bound is a template parameter, so the compiler can fully unroll and vectorize.
+namespace compiled_kernels {
+
+// y = x * W^T + b, with W stored [Out][In] like TFLite FullyConnected weights
+template <int In, int Out, bool Relu>
+inline void dense(const float* __restrict x, const float (&w)[Out][In], const float (&b)[Out], float* __restrict y)
+{
+    for (int o = 0; o < Out; o++) {
+        float acc = b[o];
+        for (int i = 0; i < In; i++) {
+            acc += w[o][i] * x[i];
+        }
+        y[o] = (Relu && acc < 0.0f) ? 0.0f : acc;
+    }
+}
+
+template <int N>
+inline void logistic(const float* __restrict x, float* __restrict y)
+{
+    for (int i = 0; i < N; i++) {
+        y[i] = 1.0f / (1.0f + expf(-x[i]));
+    }
+}
+
+}  // namespace compiled_kernels
+
+#endif // COMPILED_KERNELS_H
@@ -0,0 +1,35 @@
+#ifndef DEADLINE_H
+#define DEADLINE_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    uint32_t runs;                  // Releases that scored a window
+    uint32_t idle;                  // Releases with no new window to score
+    uint32_t misses;                // Runs that completed after their deadline
+    uint32_t skipped;               // Releases lost while an earlier run was still going
+    uint32_t last_latency_us;       // Release to completion of the newest run
+    uint32_t avg_latency_us;
+    uint32_t max_latency_us;
+    uint32_t max_start_delay_us;    // Release to the thread actually starting the run
+    int32_t last_slack_us;          // Deadline minus completion; negative on a miss
+    int32_t min_slack_us;
+} DeadlineStats;
+
+// Account one periodic release of the inference thread. Times are measured from the absolute
+// release time, so a run that starts late is charged for the wait as well as for Invoke().
+void deadline_record(uint32_t start_delay_us, uint32_t latency_us, uint32_t deadline_us, uint32_t skipped);
+void deadline_record_idle(uint32_t skipped);
+
+void deadline_get_stats(DeadlineStats* stats);
+void deadline_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DEADLINE_H
@@ -0,0 +1,51 @@
+#ifndef FLEET_STORE_H
+#define FLEET_STORE_H
+
+#include "sensor_wrapper.h"
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef FLEET_MAX_MACHINES
+#define FLEET_MAX_MACHINES      16      // Machines the store holds; handles are 0 .. FLEET_MAX_MACHINES - 1 (set by CMake)
+#endif
+#define FLEET_CACHE_LINE        64
+#define FLEET_COLUMN_STRIDE     ((FLEET_MAX_MACHINES + 15) / 16 * 16)   // Floats per column: whole cache lines
+
+// Structure-of-arrays store behind every MachineHandle: one contiguous float column per SensorKind
+// with that sensor's latest value for every machine, indexed by handle. Bulk readers stream a
+// column instead of chasing Machine -> Sensor pointers through the heap.
+
+// One past the highest handle in use; sweeps run over [0, fleet_size())
+int fleet_size(void);
+
+// Latest `kind` value of every handle, FLEET_CACHE_LINE aligned; 0 where the machine lacks that
+// sensor or the handle is free
+const float* fleet_column(SensorKind kind);
+
+// Per handle, bit (1 << kind) for each sensor the machine has; 0 for a free handle
+const uint8_t* fleet_sensor_masks(void);
+
+// Machines with a `kind` sensor reading outside [min_value, max_value], in one pass over the column
+int fleet_count_out_of_range(SensorKind kind, float min_value, float max_value);
+
+#ifdef APP_BENCHMARK
+void fleet_run_benchmark(void);
+#endif
+
+#ifdef __cplusplus
+}
+
+class Machine;
+
+// Store bookkeeping for sensor_wrapper.cpp: the lowest free handle (-1 when full), with its cells zeroed
+MachineHandle fleet_add(Machine* machine, MachineType type, uint8_t sensor_mask);
+void fleet_remove(MachineHandle handle);
+Machine* fleet_machine(MachineHandle handle);           // nullptr for a free or out-of-range handle
+MachineType fleet_type(MachineHandle handle);           // NUM_MACHINE_TYPES for a free or out-of-range handle
+float* fleet_cell(SensorKind kind, MachineHandle handle);
+#endif
+
+#endif // FLEET_STORE_H
@@ -0,0 +1,57 @@
+#ifndef MODEL_STORE_H
+#define MODEL_STORE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MODEL_STORE_NUM_SLOTS   2               // model_slot_a / model_slot_b flash partitions
+#define MODEL_IMAGE_MAGIC       0x4c444f4du     // "MODL"
+#define MODEL_IMAGE_ALIGN       16              // TFLM wants 16-byte aligned flatbuffers
+
+// Slot image header, written by scripts/model_image.py; the models follow it in flash
+typedef struct {
+    uint32_t magic;
+    uint32_t version;           // Monotonic; 0 is reserved for the firmware's embedded model
+    uint32_t model_len;         // Single-window model, right after the header
+    uint32_t batch_len;         // Batched model at the next MODEL_IMAGE_ALIGN boundary, 0 if none
+    uint32_t batch_size;        // Rows of the batched model's input
+    uint32_t crc32;             // CRC-32 (IEEE) over everything after the header
+    uint32_t reserved[2];
+} ModelImageHeader;
+
+// A validated slot, read in place from memory-mapped flash
+typedef struct {
+    int slot;
+    uint32_t version;
+    const uint8_t* model;
+    uint32_t model_len;
+    const uint8_t* batch_model; // NULL if the image has no batched model
+    uint32_t batch_len;
+    uint32_t batch_size;
+} ModelImage;
+
+// Returns 0, or -ENODEV when the board has no model slot partitions
+int model_store_init(void);
+
+// Check one slot's header, bounds and CRC and map its models; negative errno if it holds no valid image
+int model_store_load(int slot, ModelImage* image);
+
+// The valid slot with the highest version; -ENOENT if neither slot holds a valid image
+int model_store_newest(ModelImage* image);
+
+// Slot an update should go to: never the one holding the newest valid image
+int model_store_spare_slot(void);
+
+// Erase `slot` and write a complete image (header + models). The header goes in last, so a write
+// cut short by a reset leaves a slot that simply fails validation.
+int model_store_write(int slot, const uint8_t* image, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MODEL_STORE_H
@@ -0,0 +1,89 @@
+#ifndef OBJECT_POOL_H
+#define OBJECT_POOL_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Machines, with their sensors inside, come from a fixed pool of FLEET_MAX_MACHINES sized at
+// compile time, not from the heap: creating or destroying one is O(1) and cannot fragment or
+// exhaust the libc heap. Every malloc(), calloc() and realloc() is counted (operator new goes
+// through malloc()), and the libc heap's in-use bytes are sampled at the seal, so the report
+// can show nothing reaches the heap once boot is over.
+typedef struct {
+    uint32_t machines_used;
+    uint32_t machines_peak;
+    uint32_t machines_capacity;
+    uint32_t pool_bytes;            // Static storage of the pool
+    uint32_t boot_allocs;           // malloc()/calloc()/realloc() calls before object_pool_seal_heap()
+    uint32_t runtime_allocs;        // ... and after it; 0 in a heap-free steady state
+    uint32_t runtime_bytes;
+    int32_t heap_growth;            // libc heap bytes in use now minus at the seal, libc's own buffers included
+} PoolStats;
+
+// End of boot: every later allocation is counted as a runtime allocation
+void object_pool_seal_heap(void);
+
+void object_pool_get_stats(PoolStats* stats);
+
+// One-line footprint report: pool use and peaks, and heap allocations since the seal
+void object_pool_report(void);
+
+#ifdef APP_BENCHMARK
+void object_pool_run_benchmark(void);
+#endif
+
+#ifdef __cplusplus
+}
+
+#include <stddef.h>
+
+// Fixed-capacity storage for up to N objects of type T (or smaller types with no stricter
+// alignment). Never-used slots are handed out in order, freed ones are reused from a free list,
+// so both operations are O(1) and untouched capacity stays in .bss. Not thread-safe: machines
+// are created and destroyed from one thread.
+template <typename T, int N>
+class ObjectPool {
+public:
+    void* allocate()
+    {
+        int32_t slot;
+        if (free_head != 0) {
+            slot = free_head - 1;
+            free_head = next[slot];
+        } else if (fresh < N) {
+            slot = fresh++;
+        } else {
+            return nullptr;
+        }
+        if (++in_use > high) high = in_use;
+        return storage[slot];
+    }
+
+    void release(void* object)
+    {
+        if (object == nullptr) return;
+        int32_t slot = (int32_t)(((unsigned char*)object - storage[0]) / sizeof(T));
+        next[slot] = free_head;
+        free_head = slot + 1;
+        in_use--;
+    }
+
+    int used() const { return in_use; }
+    int peak() const { return high; }
+    static constexpr int capacity() { return N; }
+    static constexpr size_t bytes() { return sizeof(ObjectPool); }
+
+private:
+    alignas(T) unsigned char storage[N][sizeof(T)];
+    int32_t next[N];                // Free-list links, as slot + 1 (0 ends the list)
+    int32_t free_head;              // Slot + 1 of the first freed slot; 0 when none
+    int32_t fresh;                  // Slots below this have been handed out at least once
+    int32_t in_use;
+    int32_t high;
+};
+#endif
+
+#endif // OBJECT_POOL_H
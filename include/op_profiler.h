@@ -0,0 +1,41 @@
+#ifndef OP_PROFILER_H
+#define OP_PROFILER_H
+
+#include "tflite_wrapper.h"
+#include <stdint.h>
+#include <tensorflow/lite/micro/micro_profiler_interface.h>
+
+#ifndef PROFILER_MAX_OPS
+#define PROFILER_MAX_OPS        8       // Ops tracked per interpreter (the autoencoder has 7)
+#endif
+#ifndef PROFILER_WINDOW
+#define PROFILER_WINDOW         64      // Rolling window of Invoke()s per op
+#endif
+
+// Per-op cycle counter attached to a MicroInterpreter. The interpreter reports
+// one BeginEvent/EndEvent pair per op; events are matched to ops by their order
+// within an Invoke(), so beginInvoke() must be called before every Invoke().
+class OpProfiler : public tflite::MicroProfilerInterface {
+public:
+    uint32_t BeginEvent(const char* tag) override;
+    void EndEvent(uint32_t event_handle) override;
+
+    void beginInvoke() { next_event = 0; }
+    void reset();
+    int getStats(OpProfile* out, int max_ops) const;
+
+private:
+    struct OpWindow {
+        const char* tag;
+        uint32_t cycles[PROFILER_WINDOW];
+        uint32_t count;                 // Samples held, up to PROFILER_WINDOW
+        uint32_t next;                  // Ring write position
+    };
+
+    OpWindow ops[PROFILER_MAX_OPS] = {};
+    uint32_t start_cycles[PROFILER_MAX_OPS] = {};
+    int num_ops = 0;
+    int next_event = 0;
+};
+
+#endif // OP_PROFILER_H
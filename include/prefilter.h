@@ -0,0 +1,37 @@
+#ifndef PREFILTER_H
+#define PREFILTER_H
+
+#include "tflite_wrapper.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PREFILTER_MAX_MACHINES  16
+#define PREFILTER_ALPHA         0.05f   // EWMA weight of the newest sample
+#define PREFILTER_Z_GATE        2.5f    // |z| above this against the running mean/stddev is ambiguous
+#define PREFILTER_EDGE_BAND     0.05f   // Normalized distance to the configured range limits that is ambiguous
+#define PREFILTER_WARMUP        8       // Windows always scored while the statistics settle
+#define PREFILTER_REFRESH       16      // Every Nth window is scored anyway so no score goes stale
+
+typedef struct {
+    uint32_t windows;           // Windows seen by the prefilter
+    uint32_t invoked;           // Passed on to the autoencoder
+    uint32_t skipped;           // Clearly normal; no Invoke()
+} PrefilterStats;
+
+// Cheap first stage of the detector: update the machine's per-sensor EWMA mean/variance with one
+// normalized window (O(1) per sample) and return true when the window needs the autoencoder.
+// The statistics start from the SensorConfig ranges: mean at mid-range, range = +/-3 stddev.
+bool prefilter_needs_inference(int machine, const float* window, int num_sensors);
+
+void prefilter_get_stats(PrefilterStats* stats);
+void prefilter_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // PREFILTER_H
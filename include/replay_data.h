@@ -0,0 +1,19 @@
+#ifndef REPLAY_DATA_H
+#define REPLAY_DATA_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define REPLAY_NUM_FEATURES     3
+
+// Normalized windows from data/machine_*/ CSVs, generated by scripts/replay_data.py
+extern const float replay_windows[][REPLAY_NUM_FEATURES];
+extern const unsigned char replay_num_sensors[];
+extern const unsigned int replay_num_windows;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // REPLAY_DATA_H
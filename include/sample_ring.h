@@ -0,0 +1,150 @@
+#ifndef SAMPLE_RING_H
+#define SAMPLE_RING_H
+
+#ifndef SENSOR_WINDOW_LENGTH
+#define SENSOR_WINDOW_LENGTH    1       // Samples per sensor window (set by CMake)
+#endif
+
+#ifndef SENSOR_WINDOW_HOP
+#define SENSOR_WINDOW_HOP       1       // New samples between consecutive windows (set by CMake)
+#endif
+
+#ifndef SENSOR_LOG_LENGTH
+#define SENSOR_LOG_LENGTH       32      // Timestamped samples kept per sensor; a power of two (set by CMake)
+#endif
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    uint32_t timestamp_ms;              // k_uptime_get_32() when the sample was written; wraps after ~49 days
+    float value;
+} TimedSample;
+
+#ifdef __cplusplus
+}
+
+#include <atomic>
+#include <string.h>
+
+static_assert(SENSOR_WINDOW_LENGTH > 0, "SENSOR_WINDOW_LENGTH must be positive");
+static_assert(SENSOR_WINDOW_HOP > 0 && SENSOR_WINDOW_HOP <= SENSOR_WINDOW_LENGTH,
+    "SENSOR_WINDOW_HOP must be in 1..SENSOR_WINDOW_LENGTH");
+
+// Fixed-capacity sliding window over one sensor's samples. Every sample is stored twice, at
+// head and head + Length, so the newest Length samples are always contiguous: a window is a
+// pointer into the ring, and a new sample costs two stores however long the window is.
+template <int Length>
+class SampleRing {
+public:
+    void push(float value) {
+        samples[head] = value;
+        samples[head + Length] = value;
+        head = head + 1 == Length ? 0 : head + 1;
+        if (count < Length) count++;
+        fresh++;
+    }
+
+    const float* window() const { return &samples[head]; }         // Length samples, oldest first
+    float latest() const { return samples[head + Length - 1]; }
+    int size() const { return count; }
+
+    // A window is due once the ring is full and `hop` samples arrived since the last one was taken
+    bool ready(int hop) const { return count == Length && fresh >= hop; }
+    void consume() { fresh = 0; }
+
+private:
+    float samples[2 * Length] = {};     // Mirrored: [head, head + Length) is the current window
+    int head = 0;                       // Next write position
+    int count = 0;                      // Samples held, up to Length
+    int fresh = 0;                      // Samples since the last consume()
+};
+
+typedef SampleRing<SENSOR_WINDOW_LENGTH> SensorHistory;
+
+// Timestamped history of one sensor for trend and windowed queries. One producer (the sampling
+// thread) pushes; any number of readers query at the same time, and nobody takes a lock. The
+// producer overwrites the oldest sample and never waits. A reader copies a snapshot out, then
+// drops the samples the producer may have overwritten while it was copying.
+template <int Capacity>
+class SampleLog {
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "SampleLog capacity must be a power of two");
+
+public:
+    // Wait-free: three relaxed stores and one release store
+    void push(float value, uint32_t timestamp_ms) {
+        uint32_t n = written.load(std::memory_order_relaxed);
+        Slot& slot = slots[n & (Capacity - 1)];
+        // A reader that sees any part of this sample also sees started > n, so it knows the
+        // slot's previous sample is gone
+        started.store(n + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.timestamp_ms.store(timestamp_ms, std::memory_order_relaxed);
+        slot.value.store(value, std::memory_order_relaxed);
+        written.store(n + 1, std::memory_order_release);
+    }
+
+    // The newest samples, up to max_samples, oldest first; returns how many were copied
+    int last(TimedSample* out, int max_samples) const {
+        uint32_t end = written.load(std::memory_order_acquire);
+        uint32_t n = end < (uint32_t)Capacity ? end : (uint32_t)Capacity;
+        if (max_samples < 0) max_samples = 0;
+        if (n > (uint32_t)max_samples) n = (uint32_t)max_samples;
+        uint32_t first = end - n;
+
+        for (uint32_t i = 0; i < n; i++) {
+            const Slot& slot = slots[(first + i) & (Capacity - 1)];
+            out[i].timestamp_ms = slot.timestamp_ms.load(std::memory_order_relaxed);
+            out[i].value = slot.value.load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        // Every sample the producer has started since, up to started - 1, took the slot of the
+        // sample Capacity before it: those copies may be torn
+        uint32_t distance = started.load(std::memory_order_relaxed) - first;
+        uint32_t lost = distance > (uint32_t)Capacity ? distance - Capacity : 0;
+        if (lost >= n) return 0;
+        if (lost > 0) memmove(out, out + lost, (n - lost) * sizeof(TimedSample));
+        return (int)(n - lost);
+    }
+
+    // Samples stamped at or after since_ms (wrap-safe), up to the newest max_samples, oldest first
+    int since(uint32_t since_ms, TimedSample* out, int max_samples) const {
+        int n = last(out, max_samples);
+        int skip = 0;
+        while (skip < n && (int32_t)(out[skip].timestamp_ms - since_ms) < 0) skip++;
+        if (skip > 0) memmove(out, out + skip, (n - skip) * sizeof(TimedSample));
+        return n - skip;
+    }
+
+    uint32_t pushed() const { return written.load(std::memory_order_acquire); }
+
+private:
+    struct Slot {
+        std::atomic<uint32_t> timestamp_ms{0};
+        std::atomic<float> value{0.0f};
+    };
+    Slot slots[Capacity];
+    std::atomic<uint32_t> started{0};   // Samples whose push has begun; only the producer stores it
+    std::atomic<uint32_t> written{0};   // Samples ever pushed; only the producer stores it
+};
+
+typedef SampleLog<SENSOR_LOG_LENGTH> SensorLog;
+
+extern "C" {
+#endif
+
+#ifdef APP_BENCHMARK
+// Per-sample cost of a shifted history buffer vs the ring as the window grows from 8 to 512, then
+// the cost of SampleLog pushes and snapshot queries
+void sample_ring_run_benchmark(void);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SAMPLE_RING_H
@@ -0,0 +1,51 @@
+#ifndef SCORE_CACHE_H
+#define SCORE_CACHE_H
+
+#include "tflite_wrapper.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SCORE_CACHE_MAX_MACHINES    16
+#define SCORE_CACHE_MAX_HITS        12      // Consecutive reuses before the machine is scored anyway
+
+#ifndef SCORE_CACHE_EPSILON
+#define SCORE_CACHE_EPSILON         0.01    // Largest normalized per-sensor change that reuses a score; 0 disables (set by CMake)
+#endif
+
+typedef struct {
+    uint32_t lookups;           // Windows offered to the cache
+    uint32_t hits;              // Previous score reused; no Invoke()
+    uint32_t misses;            // Scored by the model and stored
+    uint32_t refreshes;         // Misses forced by SCORE_CACHE_MAX_HITS
+    uint32_t invoke_us;         // Inference latency of the stored scores
+    uint32_t saved_us;          // hits x mean stored latency: inference time the cache saved
+} ScoreCacheStats;
+
+// Memoization in front of Invoke(): reuse the machine's last score when none of its sensors moved
+// more than SCORE_CACHE_EPSILON from the window that score was computed on. Comparing against the
+// scored window, not the previous one, keeps slow drift from creeping past epsilon unscored.
+// Returns true and fills result (latency 0) on a hit.
+bool score_cache_lookup(int machine, const float* window, int num_sensors, InferenceResult* result);
+
+// Remember a freshly computed score and the window it was computed on
+void score_cache_store(int machine, const float* window, const InferenceResult* result);
+
+void score_cache_get_stats(ScoreCacheStats* stats);
+void score_cache_reset(void);
+
+// Forget every cached score but keep the counters: call when the model changes
+void score_cache_invalidate(void);
+
+#ifdef APP_BENCHMARK
+void score_cache_run_benchmark(void);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SCORE_CACHE_H
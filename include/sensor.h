@@ -2,49 +2,81 @@
 #define SENSOR_H
 
 #include "sensor_wrapper.h"
+#include "sample_ring.h"
 #include <stdint.h>
+#include <stddef.h>
 #include <string>
 #include <stdio.h>
+#include <zephyr/kernel.h>
 
+#include <array>
+#include <utility>
 #include <memory>
 #include <vector>
-#include <iostream>
 
-class Sensor {
-protected:
-    float Value;
-public:
-    virtual void setValue(float value) = 0;
-    virtual float readValue() = 0;
-    virtual std::string getType() = 0;
-    virtual ~Sensor() {}
-};
+#define MACHINE_NAME_LENGTH     32      // Including the terminator; longer names are truncated
 
-class TempSensor : public Sensor {
-public:
-    void setValue(float value) override;
-    float readValue() override;
-    std::string getType() override;
-};
+// One sensor of a machine: its latest value and its sample ring. Every kind behaves the same and
+// only the name differs, so there is one concrete class and no virtual dispatch; the compiler
+// inlines reads and writes.
+class Sensor {
+private:
+    float Value = 0.0f;
+    float* cell = &Value;               // Latest value: the machine's fleet_store cell once bound, else Value
+    SensorHistory history;              // Last SENSOR_WINDOW_LENGTH values, fed by setValue()
+    SensorLog log;                      // Last SENSOR_LOG_LENGTH values with their timestamps, for readers on other threads
+    SensorKind kind;
 
-class PressureSensor : public Sensor {
 public:
-    void setValue(float value) override;
-    float readValue() override;
-    std::string getType() override;
+    explicit Sensor(SensorKind sensorKind) : kind(sensorKind) {}
+    Sensor(const Sensor&) = delete;                         // cell may point at Value
+    Sensor& operator=(const Sensor&) = delete;
+
+    void setValue(float value) { setValue(value, k_uptime_get_32()); }
+    void setValue(float value, uint32_t timestampMs) { *cell = value; history.push(value); log.push(value, timestampMs); }
+    float readValue() const { return *cell; }
+    const char* getType() const { return get_sensor_kind_string(kind); }
+    SensorKind getKind() const { return kind; }
+
+    const SensorHistory& samples() const { return history; }
+    const SensorLog& timedSamples() const { return log; }
+    void consumeWindow() { history.consume(); }
+    void bindCell(float* storeCell) { *storeCell = *cell; cell = storeCell; }
 };
 
-class VibrationSensor : public Sensor {
-public:
-    void setValue(float value) override;
-    float readValue() override;
-    std::string getType() override;
+// Sensor kinds of a machine type in MachineConfig order, fixed at compile time
+template <SensorKind... Kinds>
+struct SensorSet {
+    static constexpr int count = sizeof...(Kinds);
+    static constexpr uint8_t mask = (uint8_t)(0u | ... | (1u << Kinds));    // As fleet_add() takes it
+
+    // f(kind, index) for each sensor, unrolled with constant kinds
+    template <typename F>
+    static void forEach(F&& f)
+    {
+        int index = 0;
+        (f(Kinds, index++), ...);
+        (void)index;
+    }
 };
 
-class SensorFactory {
-public:
-    static std::unique_ptr<Sensor> createSensor(const std::string& type);
-};
+// The machine types: which sensors each one carries
+template <MachineType Type> struct MachineLayout : SensorSet<> {};
+template <> struct MachineLayout<AIR_COMPRESSOR> : SensorSet<SENSOR_TEMPERATURE, SENSOR_PRESSURE, SENSOR_VIBRATION> {};
+template <> struct MachineLayout<STEAM_BOILER> : SensorSet<SENSOR_TEMPERATURE, SENSOR_PRESSURE> {};
+template <> struct MachineLayout<ELECTRIC_MOTOR> : SensorSet<SENSOR_TEMPERATURE> {};
+
+// f(layout) with the MachineLayout of a type known only at run time: one switch, static below it
+template <typename F>
+inline auto withMachineLayout(MachineType type, F&& f) -> decltype(f(MachineLayout<NUM_MACHINE_TYPES>()))
+{
+    switch (type) {
+        case AIR_COMPRESSOR: return f(MachineLayout<AIR_COMPRESSOR>());
+        case STEAM_BOILER: return f(MachineLayout<STEAM_BOILER>());
+        case ELECTRIC_MOTOR: return f(MachineLayout<ELECTRIC_MOTOR>());
+        default: return f(MachineLayout<NUM_MACHINE_TYPES>());
+    }
+}
 
 // class Machine {
 // public:
@@ -57,20 +89,84 @@ public:
 //     float getSensorValue(const std::string& type);
 // };
 
+// One Sensor of every kind, in SensorKind order, each constructed in place with its own kind
+template <size_t... Kinds>
+inline std::array<Sensor, sizeof...(Kinds)> makeSensorsByKind(std::index_sequence<Kinds...>)
+{
+    return {Sensor((SensorKind)Kinds)...};
+}
+
+// Machines live in the static pool of object_pool.cpp: `new` takes a slot (nullptr when the pool
+// is full) and `delete` returns it, with no heap involved. Sensors are members, one per kind,
+// indexed by SensorKind; the type's MachineLayout says which of them are in use. Every pool slot
+// has to fit an Air Compressor, which carries all kinds, so sizing the array per type would not
+// shrink the pool.
 class Machine {
 private:
     MachineType type;  
+    uint8_t mask;                       // Bit (1 << kind) per sensor the type carries
+    std::array<Sensor, NUM_SENSOR_KINDS> sensors = makeSensorsByKind(std::make_index_sequence<NUM_SENSOR_KINDS>());
+
+    void missingSensor(const char* type) const;
 
 public:
-    std::string name;
-    std::vector<std::unique_ptr<Sensor>> sensors;
+    char name[MACHINE_NAME_LENGTH];
+
+    Machine(const char* machineName, MachineType machineType);
 
-    Machine(const std::string& machineName, const std::vector<std::string>& sensorTypes, MachineType machineType);
+    static void* operator new(size_t size) noexcept;
+    static void operator delete(void* machine) noexcept;
     
     void display() const;
-    void setSensorValue(const std::string& type, float value);
-    float getSensorValue(const std::string& type);
+    void setSensorValue(SensorKind kind, float value)
+    {
+        if (!hasSensor(kind)) {
+            missingSensor(get_sensor_kind_string(kind));
+            return;
+        }
+        sensors[kind].setValue(value);
+    }
+    float getSensorValue(SensorKind kind)
+    {
+        if (!hasSensor(kind)) {
+            missingSensor(get_sensor_kind_string(kind));
+            return -1.0f;
+        }
+        return sensors[kind].readValue();
+    }
+    void setSensorValue(const char* type, float value);    // By name: resolved to its SensorKind first
+    float getSensorValue(const char* type);
+    bool hasSensor(SensorKind kind) const { return kind >= 0 && kind < NUM_SENSOR_KINDS && (mask >> kind) & 1; }
+    Sensor* getSensor(SensorKind kind) { return hasSensor(kind) ? &sensors[kind] : nullptr; }
+    const Sensor* getSensor(SensorKind kind) const { return hasSensor(kind) ? &sensors[kind] : nullptr; }
     MachineType getType() const { return type; }
+    uint8_t sensorMask() const { return mask; }
+    void bindStore(MachineHandle handle);                   // Move every sensor's latest value into its fleet_store cell
+
+    // Every sensor at once, values in MachineConfig order, all stamped with the same time: unrolled
+    // for a type known at compile time, or after one switch on the machine's own type
+    template <MachineType Type>
+    void setValues(const float* values, uint32_t timestampMs = k_uptime_get_32())
+    {
+        MachineLayout<Type>::forEach([&](SensorKind kind, int index) { sensors[kind].setValue(values[index], timestampMs); });
+    }
+    void setValues(const float* values, uint32_t timestampMs = k_uptime_get_32());
+
+    // f(sensor) for each sensor the machine carries, in MachineConfig order
+    template <typename F>
+    void forEachSensor(F&& f)
+    {
+        withMachineLayout(type, [&](auto layout) { layout.forEach([&](SensorKind kind, int) { f(sensors[kind]); }); });
+    }
+
+    // Sliding windows: every sensor full and SENSOR_WINDOW_HOP samples past the last window
+    bool windowReady() const;
+    void consumeWindow();
+    const float* sensorWindow(SensorKind kind) const
+    {
+        const Sensor* sensor = getSensor(kind);
+        return sensor ? sensor->samples().window() : nullptr;
+    }
 };
     
 
@@ -1,6 +1,9 @@
 #ifndef SENSOR_WRAPPER_H
 #define SENSOR_WRAPPER_H
 
+#include <stdint.h>
+#include "sample_ring.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -8,9 +11,20 @@ extern "C" {
 typedef enum {
     AIR_COMPRESSOR,
     STEAM_BOILER,
-    ELECTRIC_MOTOR
+    ELECTRIC_MOTOR,
+    NUM_MACHINE_TYPES               // Count, not a machine type
 } MachineType;
 
+typedef enum {
+    SENSOR_UNKNOWN = -1,
+    SENSOR_TEMPERATURE,
+    SENSOR_PRESSURE,
+    SENSOR_VIBRATION,
+    NUM_SENSOR_KINDS                // Count, not a sensor kind
+} SensorKind;
+
+typedef int SensorId;               // Sensor's slot in its machine, from find_sensor(); -1 when absent
+
 typedef struct {
     const char* name;
     float min_value;
@@ -19,13 +33,13 @@ typedef struct {
 
 typedef struct {
     const char* name;
-    SensorConfig sensors[3];
+    SensorConfig sensors[NUM_SENSOR_KINDS];     // At most one sensor of each kind
     int num_sensors;
 } MachineConfig;
 
-typedef void* MachineHandle;
+typedef int32_t MachineHandle;      // Machine's index in the fleet store (fleet_store.h); -1 is no machine
 
-MachineHandle create_machine(const char* machine_name, MachineType type);
+MachineHandle create_machine(const char* machine_name, MachineType type);     // -1 when the fleet store is full
 void destroy_machine(MachineHandle handle);
 void describe_machine(MachineHandle handle);
 void set_sensor_value(MachineHandle handle, const char* sensor_type, float value);
@@ -33,6 +47,38 @@ float get_sensor_value(MachineHandle handle, const char* sensor_type);
 const char* get_machine_type_string(MachineType type);
 MachineType get_machine_type(MachineHandle handle);
 
+// "Temperature", "Pressure" or "Vibration" to its SensorKind; SENSOR_UNKNOWN for anything else
+SensorKind get_sensor_kind(const char* sensor_type);
+const char* get_sensor_kind_string(SensorKind kind);
+
+// Resolve a sensor name to the machine's slot once, then read and write by ID: an array index,
+// no string compares, no allocation. Returns -1 when the machine has no such sensor.
+SensorId find_sensor(MachineHandle handle, const char* sensor_type);
+void set_sensor_value_by_id(MachineHandle handle, SensorId id, float value);
+float get_sensor_value_by_id(MachineHandle handle, SensorId id);
+
+// Write every sensor of the machine in one call, values in its MachineConfig order. One switch on
+// the type, then the compile-time sensor layout: no per-sensor lookup or indirect call.
+void set_machine_values(MachineHandle handle, const float* values);
+
+// Newest SENSOR_WINDOW_LENGTH samples of a sensor, oldest first. The pointer aliases the sensor's
+// ring and stays valid until its next sample. Returns the window length, or 0 (and NULL) when
+// the machine has no such sensor.
+int get_sensor_window(MachineHandle handle, SensorId id, const float** samples);
+int machine_window_ready(MachineHandle handle);     // 1 once every sensor has SENSOR_WINDOW_HOP new samples
+void machine_consume_window(MachineHandle handle);
+
+// Timestamped samples of a sensor, oldest first, copied into samples[]: the newest max_samples
+// (up to SENSOR_LOG_LENGTH), or only those stamped at or after since_ms. Safe to call from any
+// thread while the sampling thread keeps writing; neither side blocks, and samples overwritten
+// during the copy are dropped from the front. Returns the count copied.
+int get_sensor_samples(MachineHandle handle, SensorId id, TimedSample* samples, int max_samples);
+int get_sensor_samples_since(MachineHandle handle, SensorId id, uint32_t since_ms, TimedSample* samples, int max_samples);
+
+#ifdef APP_BENCHMARK
+void sensor_run_benchmark(void);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,14 @@
+#ifndef SPARSE_FULLY_CONNECTED_H
+#define SPARSE_FULLY_CONNECTED_H
+
+#include <tensorflow/lite/micro/micro_common.h>
+
+// Custom op name written by scripts/sparse_model.py and registered by the generated resolver
+#define SPARSE_FULLY_CONNECTED_OP   "SPARSE_FULLY_CONNECTED"
+
+// FullyConnected over block-sparse weights (include/sparse_kernels.h). Inputs: float activations
+// [batch, in_features], uint8 packed weights, optional float bias; custom option byte 0 is the
+// fused ReLU flag.
+TFLMRegistration* register_sparse_fully_connected();
+
+#endif // SPARSE_FULLY_CONNECTED_H
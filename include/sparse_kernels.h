@@ -0,0 +1,106 @@
+#ifndef SPARSE_KERNELS_H
+#define SPARSE_KERNELS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef __cplusplus
+
+// Block-sparse FullyConnected weights as packed by scripts/sparse_model.py. Each output row keeps
+// only its non-zero blocks of kBlockSize consecutive inputs (block-CSR), so the kernel skips
+// pruned blocks entirely instead of multiplying by zero.
+namespace sparse_kernels {
+
+constexpr int kBlockSize = 4;
+constexpr size_t kHeaderBytes = 8;      // u16 out_features, in_features, block_size, num_blocks
+
+struct BlockSparseMatrix {
+    int out_features;
+    int in_features;
+    int block_size;
+    int num_blocks;
+    const uint16_t* row_ptr;            // [out_features + 1] first block of each row
+    const uint16_t* block_col;          // [num_blocks] input column / block_size
+    const float* values;                // [num_blocks * block_size]
+};
+
+// View a packed weight blob in place; false if it is truncated or inconsistent
+inline bool unpack(const uint8_t* blob, size_t len, BlockSparseMatrix* m)
+{
+    uint16_t header[4];
+    if (blob == nullptr || len < kHeaderBytes || ((uintptr_t)blob & 3) != 0) return false;
+    memcpy(header, blob, sizeof(header));
+
+    m->out_features = header[0];
+    m->in_features = header[1];
+    m->block_size = header[2];
+    m->num_blocks = header[3];
+    if (m->block_size != kBlockSize || m->in_features == 0 || m->out_features == 0 ||
+        m->in_features % kBlockSize != 0) {
+        return false;
+    }
+
+    size_t index_bytes = kHeaderBytes + 2 * (size_t)(m->out_features + 1 + m->num_blocks);
+    size_t values_at = (index_bytes + 3) & ~(size_t)3;
+    if (len != values_at + sizeof(float) * (size_t)m->num_blocks * kBlockSize) return false;
+
+    m->row_ptr = (const uint16_t*)(blob + kHeaderBytes);
+    m->block_col = m->row_ptr + m->out_features + 1;
+    m->values = (const float*)(blob + values_at);
+    // Every index sparse_dense() follows must stay inside the blob: rows never run backwards or
+    // past the last block, and every block starts inside the input row
+    if (m->row_ptr[0] != 0 || m->row_ptr[m->out_features] != m->num_blocks) return false;
+    for (int o = 0; o < m->out_features; o++) {
+        if (m->row_ptr[o + 1] < m->row_ptr[o] || m->row_ptr[o + 1] > m->num_blocks) return false;
+    }
+    for (int b = 0; b < m->num_blocks; b++) {
+        if ((m->block_col[b] + 1) * kBlockSize > m->in_features) return false;
+    }
+    return true;
+}
+
+// y = x * W^T + b over the stored blocks only; bias may be null
+inline void sparse_dense(const float* __restrict x, const BlockSparseMatrix& w, const float* bias, bool relu,
+                         float* __restrict y)
+{
+    for (int o = 0; o < w.out_features; o++) {
+        float acc = bias != nullptr ? bias[o] : 0.0f;
+        for (int b = w.row_ptr[o]; b < w.row_ptr[o + 1]; b++) {
+            const float* v = w.values + b * kBlockSize;
+            const float* xs = x + w.block_col[b] * kBlockSize;
+            acc += v[0] * xs[0] + v[1] * xs[1] + v[2] * xs[2] + v[3] * xs[3];
+        }
+        y[o] = (relu && acc < 0.0f) ? 0.0f : acc;
+    }
+}
+
+// Dense reference with the same runtime shapes, W stored [out][in]
+inline void dense(const float* __restrict x, const float* w, const float* bias, int in_features, int out_features,
+                  bool relu, float* __restrict y)
+{
+    for (int o = 0; o < out_features; o++) {
+        const float* row = w + o * in_features;
+        float acc = bias != nullptr ? bias[o] : 0.0f;
+        for (int i = 0; i < in_features; i++) {
+            acc += row[i] * x[i];
+        }
+        y[o] = (relu && acc < 0.0f) ? 0.0f : acc;
+    }
+}
+
+}  // namespace sparse_kernels
+
+extern "C" {
+#endif
+
+#ifdef APP_BENCHMARK
+// Dense vs block-sparse forward pass latency at 50/75/90% sparsity
+void sparse_run_benchmark(void);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SPARSE_KERNELS_H
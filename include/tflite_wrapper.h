@@ -1,12 +1,74 @@
 #ifndef TFLITE_WRAPPER_H
 #define TFLITE_WRAPPER_H
 
+#include "sensor_wrapper.h"
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+#define MODEL_NUM_FEATURES      3       // Model input: Temperature, Pressure, Vibration
+
+#ifndef INFERENCE_BATCH_SIZE
+#define INFERENCE_BATCH_SIZE    8       // Machines scored per Invoke() in batched mode (set by CMake)
+#endif
+
+typedef struct {
+    float score;                // Reconstruction error (MSE) over the machine's sensors
+    float mae;                  // Mean absolute reconstruction error over the same sensors
+    uint32_t latency_us;        // Window packing + Invoke() time
+} InferenceResult;
+
+typedef enum {
+    INFERENCE_PATH_SINGLE,      // tflite_run_inference()
+    INFERENCE_PATH_BATCH        // tflite_run_batch_inference()
+} InferencePath;
+
+typedef struct {
+    int op_index;               // Position of the op in the graph
+    const char* tag;            // Kernel name, e.g. "FULLY_CONNECTED"
+    uint32_t samples;           // Invoke()s in the rolling window
+    uint32_t min_cycles;
+    uint32_t avg_cycles;
+    uint32_t max_cycles;
+    uint32_t p99_cycles;
+} OpProfile;
+
 void tflite_setup(void);
-void tflite_run_inference(void);
+int tflite_run_inference(MachineHandle handle, const MachineConfig* config, InferenceResult* result);
+int tflite_run_batch_inference(const MachineHandle* handles, const MachineConfig* const* configs,
+                               int count, InferenceResult* results);
+
+// Same as tflite_run_batch_inference(), but scores pre-packed windows (windows[i] is machine i's
+// MODEL_NUM_FEATURES normalized features) instead of reading the machines' sensors. Each window is
+// copied once, from where it lies (e.g. a held window_buffer frame) into its row of the model
+// input, and is scored against the caller's copy. The input sits at a fixed planned offset in the
+// arena, so that one copy remains.
+int tflite_run_window_inference(const MachineHandle* handles, const MachineConfig* const* configs,
+                                const float* const* windows, int count, InferenceResult* results);
+
+typedef struct {
+    uint32_t setup_us;          // Last tflite_setup(): interpreter construction + AllocateTensors()
+    uint32_t allocate_us;       // Part of setup_us spent in AllocateTensors()
+    uint32_t first_inference_us; // Uptime when the first window was scored; 0 until then
+    uint8_t offline_plan;       // 1 when every model in use carries an offline memory plan
+} StartupStats;
+
+// Per-op cycle statistics over the last PROFILER_WINDOW Invoke()s; returns the number of ops filled
+int tflite_get_op_profile(InferencePath path, OpProfile* profiles, int max_ops);
+void tflite_reset_op_profile(InferencePath path);
+
+// Boot cost of the inference path: how long setup took and when the first window was scored
+void tflite_get_startup_stats(StartupStats* stats);
+
+// Version of the model new windows run on: 0 for the embedded model, else the flash image's.
+// Changes when tflite_setup() switches models, so scores from before the switch can be dropped.
+uint32_t tflite_model_version(void);
+
+#ifdef APP_BENCHMARK
+void tflite_run_benchmarks(void);
+#endif
 
 #ifdef __cplusplus
 }
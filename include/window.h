@@ -0,0 +1,19 @@
+#ifndef WINDOW_H
+#define WINDOW_H
+
+#include "fleet_store.h"
+#include "sensor_wrapper.h"
+#include "tflite_wrapper.h"
+
+// Pack the machine's latest sensor samples into dst, scaled to [0, 1] by the configured ranges.
+// Reads the fleet store columns at the handle's index; no Machine or Sensor object is touched.
+// config->sensors must follow the machine type's MachineLayout order, as machine_configs does.
+void pack_window(MachineHandle handle, const MachineConfig* config, float* dst);
+
+// Reconstruction error (MSE) over the first num_sensors features of one window
+float reconstruction_error(const float* in, const float* out, int num_sensors);
+
+// MSE and MAE over the first num_sensors features in one pass (CMSIS-DSP on target)
+void reconstruction_scores(const float* in, const float* out, int num_sensors, float* mse, float* mae);
+
+#endif // WINDOW_H
@@ -0,0 +1,40 @@
+#ifndef WINDOW_BUFFER_H
+#define WINDOW_BUFFER_H
+
+#include "tflite_wrapper.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <zephyr/kernel.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define WINDOW_BUFFER_MAX_MACHINES  16      // Machines one frame holds
+
+// One frame: a normalized window per machine, indexed like the machines[] array
+typedef float WindowFrame[WINDOW_BUFFER_MAX_MACHINES][MODEL_NUM_FEATURES];
+
+typedef struct {
+    uint32_t published;         // Windows handed over to the consumer
+    uint32_t deferred;          // Publishes refused because the consumer still held the front frame
+    uint32_t overwritten;       // Published windows replaced before the consumer took them
+} WindowBufferStats;
+
+// Sampler side (one thread): fill the back frame, then swap it to the front at the window boundary.
+// Never blocks; returns false when the consumer holds the front frame, and the caller retries.
+void window_buffer_write(int machine, int feature, float value);
+bool window_buffer_publish(void);
+
+// Consumer side (one thread): take the newest front frame, score it, release it.
+// Returns NULL on timeout. The sampler does not swap while a frame is held.
+const WindowFrame* window_buffer_acquire(k_timeout_t timeout);
+void window_buffer_release(void);
+
+void window_buffer_get_stats(WindowBufferStats* stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // WINDOW_BUFFER_H
@@ -0,0 +1,113 @@
+"""
+arena_size.py - Size each model's tensor arena from its graph at build time
+
+Replays TFLM's memory planning offline: every non-constant tensor lives from
+the op that produces it (or graph start, for inputs) to the last op that
+reads it (or graph end, for inputs and outputs: the firmware packs windows
+straight into the input and scores the reconstruction against it after
+Invoke(), so the input must not be reused for activations). The peak sum of
+live, 16-byte aligned tensors is the smallest non-persistent region
+AllocateTensors() can succeed with. Persistent overhead (eval tensors,
+node/registration arrays, op data, interpreter bookkeeping) is estimated per
+tensor and per op. The firmware asserts the arena holds persistent plus
+non-persistent bytes at build time, and checks that sum against the
+allocator's measured use at setup; APP_ARENA_REPORT=ON prints the real
+RecordingMicroAllocator breakdown.
+
+Emits a header with, for every model passed in:
+  <NAME>_ARENA_MIN_BYTES            activation high-water mark
+  <NAME>_ARENA_PERSISTENT_BYTES     persistent estimate (per interpreter, never shared)
+  <NAME>_ARENA_NON_PERSISTENT_BYTES planned scratch; shared when interpreters share an arena
+  <NAME>_ARENA_SIZE                 recommended size of a dedicated arena
+
+Usage: python3 arena_size.py <out.h> FLOAT=<model.tflite> INT8=<model.tflite> ...
+"""
+
+import argparse
+
+import tflite_model as tfl
+
+ALIGNMENT = 16                  # TFLM aligns every arena buffer to 16 bytes
+PERSISTENT_PER_TENSOR = 64      # TfLiteEvalTensor + dims/quantization bookkeeping
+PERSISTENT_PER_OP = 96          # NodeAndRegistration, builtin data and kernel OpData
+PERSISTENT_FIXED = 512          # Subgraph allocations, I/O TfLiteTensors, planner handles
+PLANNER_PER_BUFFER = 48         # Greedy planner scratch per planned buffer (transient)
+MARGIN = 1.10                   # Headroom on top of the estimate
+ROUND_TO = 256
+
+
+def align(n):
+    return (n + ALIGNMENT - 1) // ALIGNMENT * ALIGNMENT
+
+
+def lifetimes(model):
+    """Return {tensor index: (first step, last step, aligned bytes)} for every planned tensor."""
+    subgraph = model['subgraphs'][0]
+    tensors = subgraph['tensors']
+    operators = subgraph['operators']
+    last = len(operators) - 1
+
+    first_use, last_use = {}, {}
+    for index in subgraph['inputs']:
+        first_use[index] = 0
+    for step, op in enumerate(operators):
+        for index in op['outputs']:
+            first_use.setdefault(index, step)
+        for index in op['inputs']:
+            if index >= 0:
+                last_use[index] = step
+    for index in subgraph['inputs'] + subgraph['outputs']:
+        last_use[index] = last
+
+    planned = {}
+    for index, tensor in enumerate(tensors):
+        if index in first_use and not tfl.is_constant(model, tensor):
+            size = align(tfl.num_elements(tensor) * tfl.TYPE_SIZE[tensor.get('type', tfl.FLOAT32)])
+            planned[index] = (first_use[index], last_use.get(index, last), size)
+    return planned
+
+
+def activation_peak(model):
+    planned = lifetimes(model)
+    peak = 0
+    for step in range(len(model['subgraphs'][0]['operators'])):
+        live = sum(size for first, last, size in planned.values() if first <= step <= last)
+        peak = max(peak, live)
+    return peak, len(planned)
+
+
+def arena_size(model):
+    """Return (activation peak, persistent, non-persistent, recommended dedicated arena size)."""
+    peak, buffers = activation_peak(model)
+    subgraph = model['subgraphs'][0]
+    persistent = (PERSISTENT_PER_TENSOR * len(subgraph['tensors'])
+                  + PERSISTENT_PER_OP * len(subgraph['operators']) + PERSISTENT_FIXED)
+    non_persistent = max(peak, PLANNER_PER_BUFFER * buffers)
+    total = int((persistent + non_persistent) * MARGIN)
+    return peak, persistent, non_persistent, (total + ROUND_TO - 1) // ROUND_TO * ROUND_TO
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('output')
+    parser.add_argument('models', nargs='+', metavar='NAME=MODEL')
+    args = parser.parse_args()
+
+    lines = ['// Generated by scripts/arena_size.py - do not edit', '',
+             '#ifndef ARENA_SIZES_H', '#define ARENA_SIZES_H', '']
+    for entry in args.models:
+        name, path = entry.split('=', 1)
+        peak, persistent, non_persistent, size = arena_size(tfl.load(path))
+        prefix = name.upper() + '_ARENA_'
+        lines.append('#define %-36s %d' % (prefix + 'MIN_BYTES', peak))
+        lines.append('#define %-36s %d' % (prefix + 'PERSISTENT_BYTES', persistent))
+        lines.append('#define %-36s %d' % (prefix + 'NON_PERSISTENT_BYTES', non_persistent))
+        lines.append('#define %-36s %d' % (prefix + 'SIZE', size))
+    lines += ['', '#endif // ARENA_SIZES_H', '']
+
+    with open(args.output, 'w') as f:
+        f.write('\n'.join(lines))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,43 @@
+"""
+batch_model.py - Rewrite a model's batch dimension so one Invoke() scores many windows
+
+TFLM cannot resize tensors at runtime, so the batched inference path needs a
+model whose activations are already shaped [batch, features]. Constant tensors
+(weights, biases) are left untouched; FullyConnected and Logistic compute over
+every row of a larger leading dimension.
+
+Usage: python3 batch_model.py <model.tflite> <out.tflite> --batch 8
+"""
+
+import argparse
+import tflite_model
+
+
+def batch_model(model, batch):
+    for subgraph in model['subgraphs']:
+        for tensor in subgraph['tensors']:
+            shape = tensor.get('shape', [])
+            if tflite_model.is_constant(model, tensor) or not shape:
+                continue
+            if shape[0] != 1:
+                raise ValueError('tensor %s has batch dimension %d, expected 1' % (tensor.get('name'), shape[0]))
+            tensor['shape'] = [batch] + shape[1:]
+    return model
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('model')
+    parser.add_argument('output')
+    parser.add_argument('--batch', type=int, required=True)
+    args = parser.parse_args()
+
+    if args.batch < 1:
+        parser.error('--batch must be >= 1')
+
+    model = batch_model(tflite_model.load(args.model), args.batch)
+    tflite_model.save(model, args.output)
+
+
+if __name__ == '__main__':
+    main()
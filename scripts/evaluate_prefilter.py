@@ -0,0 +1,122 @@
+"""
+evaluate_prefilter.py - Check that the prefilter cascade keeps the autoencoder's detections
+
+Replays the data/machine_*/ CSVs machine by machine through the same rules as
+src/prefilter.cpp (constants are read from include/prefilter.h) and through
+the float autoencoder. A fraction of windows get a synthetic fault: one
+sensor pushed by 30-80% of its range. The alarm threshold is the given
+percentile of the clean windows' scores.
+
+Reports, for the always-on detector and for the cascade (skipped windows
+count as normal): invocations, faults caught, false alarms and verdict
+agreement between the two.
+
+Usage: python3 evaluate_prefilter.py <model.tflite> <data_dir> [--header include/prefilter.h]
+"""
+
+import argparse
+import math
+import os
+import random
+import re
+
+import quantize_model
+import replay_data
+import tflite_model as tfl
+
+
+def read_constants(header):
+    constants = {}
+    with open(header) as f:
+        for line in f:
+            match = re.match(r'#define\s+PREFILTER_(\w+)\s+([0-9.]+)f?\b', line)
+            if match:
+                constants[match.group(1)] = float(match.group(2))
+    return constants
+
+
+class Prefilter:
+    """Mirror of prefilter_needs_inference() for one machine."""
+
+    def __init__(self, c):
+        self.c = c
+        self.mean = [0.5] * replay_data.NUM_FEATURES
+        self.var = [1.0 / 36.0] * replay_data.NUM_FEATURES
+        self.windows = 0
+
+    def needs_inference(self, window, num_sensors):
+        c = self.c
+        needed = self.windows < c['WARMUP'] or self.windows % int(c['REFRESH']) == 0
+        for f in range(min(num_sensors, replay_data.NUM_FEATURES)):
+            x = window[f]
+            diff = x - self.mean[f]
+            if abs(diff) > c['Z_GATE'] * math.sqrt(self.var[f]) or x < c['EDGE_BAND'] or x > 1.0 - c['EDGE_BAND']:
+                needed = True
+            self.mean[f] += c['ALPHA'] * diff
+            self.var[f] = (1.0 - c['ALPHA']) * (self.var[f] + c['ALPHA'] * diff * diff)
+        self.windows += 1
+        return needed
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('model')
+    parser.add_argument('data_dir')
+    parser.add_argument('--header', default=os.path.join(here, '..', 'include', 'prefilter.h'))
+    parser.add_argument('--fault-rate', type=float, default=0.05)
+    parser.add_argument('--percentile', type=float, default=99.0)
+    parser.add_argument('--seed', type=int, default=1)
+    args = parser.parse_args()
+
+    constants = read_constants(args.header)
+    model = tfl.load(args.model)
+    output = model['subgraphs'][0]['outputs'][0]
+
+    def score(window, num_sensors):
+        return quantize_model.reconstruction_error(
+            window, quantize_model.forward_float(model, window)[output], num_sensors)
+
+    windows = replay_data.load_windows(args.data_dir)
+    clean = sorted(score(window, n) for window, n in windows)
+    threshold = clean[min(len(clean) - 1, int(args.percentile / 100.0 * len(clean)))]
+
+    rng = random.Random(args.seed)
+    prefilters = {}                                     # Machines are told apart by their sensor count
+    totals = {'faults': 0, 'invoked': 0, 'agree': 0}
+    caught = {'always': 0, 'cascade': 0}
+    false_alarms = {'always': 0, 'cascade': 0}
+
+    for window, num_sensors in windows:
+        window = list(window)
+        fault = rng.random() < args.fault_rate
+        if fault:
+            f = rng.randrange(num_sensors)
+            window[f] += rng.choice((-1.0, 1.0)) * rng.uniform(0.3, 0.8)
+
+        prefilter = prefilters.setdefault(num_sensors, Prefilter(constants))
+        needed = prefilter.needs_inference(window, num_sensors)
+
+        alarm = score(window, num_sensors) > threshold
+        verdicts = {'always': alarm, 'cascade': alarm if needed else False}
+
+        totals['faults'] += fault
+        totals['invoked'] += needed
+        totals['agree'] += verdicts['always'] == verdicts['cascade']
+        for name, verdict in verdicts.items():
+            caught[name] += fault and verdict
+            false_alarms[name] += (not fault) and verdict
+
+    n = len(windows)
+    print('%d replayed windows, %d with injected faults, alarm threshold %.6f (p%g of clean scores)'
+          % (n, totals['faults'], threshold, args.percentile))
+    print('%10s %12s %14s %13s' % ('detector', 'invocations', 'faults caught', 'false alarms'))
+    for name, label, invoked in (('always', 'always-on', n), ('cascade', 'cascade', totals['invoked'])):
+        ratio = '%d/%d' % (caught[name], totals['faults'])
+        print('%10s %12d %14s %13d' % (label, invoked, ratio, false_alarms[name]))
+    print('Skipped %d of %d invocations (%.1f%%), verdict agreement %.2f%%'
+          % (n - totals['invoked'], n, 100.0 * (n - totals['invoked']) / n, 100.0 * totals['agree'] / n))
+
+
+if __name__ == '__main__':
+    main()
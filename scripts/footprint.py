@@ -0,0 +1,124 @@
+"""
+footprint.py - Report where the embedded models ended up in the firmware image
+
+Reads the linked ELF and classifies every allocated section by its flags:
+
+  flash  read-only (code, .rodata): executed or read in place, no RAM cost
+  data   writable with contents (.data and friends): stored in flash AND
+         copied into RAM by the startup code before main() runs
+  bss    writable, no contents: RAM only, zeroed at boot
+
+Then locates the model symbols (autoencoder_*_tflite) and prints which class
+each one lives in. A const model shows up as flash; a non-const array would
+show up as data and cost its full size in RAM plus a boot-time copy.
+
+Usage: python3 footprint.py <zephyr.elf> [--symbol-prefix autoencoder_]
+"""
+
+import argparse
+import struct
+
+SHT_SYMTAB = 2
+SHT_NOBITS = 8
+SHF_WRITE = 0x1
+SHF_ALLOC = 0x2
+
+
+def read_elf(path):
+    """Return (sections, symbols); each section is a dict, each symbol (name, value, size, section index)."""
+    with open(path, 'rb') as f:
+        image = f.read()
+    if image[:4] != b'\x7fELF':
+        raise ValueError('%s is not an ELF file' % path)
+
+    is64 = image[4] == 2
+    endian = '<' if image[5] == 1 else '>'
+    if is64:
+        shoff, = struct.unpack_from(endian + 'Q', image, 0x28)
+        shentsize, shnum, shstrndx = struct.unpack_from(endian + 'HHH', image, 0x3a)
+        section_fmt, symbol_fmt = endian + 'IIQQQQIIQQ', endian + 'IBBHQQ'
+    else:
+        shoff, = struct.unpack_from(endian + 'I', image, 0x20)
+        shentsize, shnum, shstrndx = struct.unpack_from(endian + 'HHH', image, 0x2e)
+        section_fmt, symbol_fmt = endian + 'IIIIIIIIII', endian + 'IIIBBH'
+
+    sections = []
+    for i in range(shnum):
+        name, kind, flags, addr, offset, size, link, _, _, entsize = struct.unpack_from(
+            section_fmt, image, shoff + i * shentsize)
+        sections.append({'name_offset': name, 'type': kind, 'flags': flags, 'addr': addr,
+                         'offset': offset, 'size': size, 'link': link, 'entsize': entsize})
+
+    def string_at(table, offset):
+        start = table['offset'] + offset
+        return image[start:image.index(b'\0', start)].decode()
+
+    for section in sections:
+        section['name'] = string_at(sections[shstrndx], section['name_offset'])
+
+    symbols = []
+    for section in sections:
+        if section['type'] != SHT_SYMTAB:
+            continue
+        strings = sections[section['link']]
+        for i in range(section['size'] // section['entsize']):
+            entry = struct.unpack_from(symbol_fmt, image, section['offset'] + i * section['entsize'])
+            if is64:
+                name, _, _, shndx, value, size = entry
+            else:
+                name, value, size, _, _, shndx = entry
+            symbols.append((string_at(strings, name), value, size, shndx))
+    return sections, symbols
+
+
+def classify(section):
+    if not section['flags'] & SHF_ALLOC:
+        return None
+    if not section['flags'] & SHF_WRITE:
+        return 'flash'
+    return 'bss' if section['type'] == SHT_NOBITS else 'data'
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('elf')
+    parser.add_argument('--symbol-prefix', default='autoencoder_')
+    args = parser.parse_args()
+
+    sections, symbols = read_elf(args.elf)
+
+    totals = {'flash': 0, 'data': 0, 'bss': 0}
+    for section in sections:
+        kind = classify(section)
+        if kind is not None:
+            totals[kind] += section['size']
+
+    print('Image footprint (%s)' % args.elf)
+    print('  flash  %8d bytes  code and read-only data' % totals['flash'])
+    print('  data   %8d bytes  initialized RAM, copied from flash at boot' % totals['data'])
+    print('  bss    %8d bytes  zeroed RAM' % totals['bss'])
+    print('  total  flash %d bytes, RAM %d bytes' % (totals['flash'] + totals['data'], totals['data'] + totals['bss']))
+
+    models = sorted((s for s in symbols if s[0].startswith(args.symbol_prefix) and s[0].endswith('_tflite')),
+                    key=lambda s: s[0])
+    if not models:
+        print('No %s*_tflite symbols found' % args.symbol_prefix)
+        return
+
+    print('\nModel placement')
+    in_ram = 0
+    for name, _, size, shndx in models:
+        section = sections[shndx] if 0 < shndx < len(sections) else None
+        kind = classify(section) if section else None
+        if kind != 'flash':
+            in_ram += size
+        print('  %-36s %7d bytes  %-6s %s' % (name, size, kind or '?', section['name'] if section else ''))
+
+    if in_ram:
+        print('WARNING: %d model bytes in RAM; each is also copied from flash at boot' % in_ram)
+    else:
+        print('All models are read in place from flash: 0 bytes of RAM, 0 bytes added to the boot .data copy')
+
+
+if __name__ == '__main__':
+    main()
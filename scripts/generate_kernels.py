@@ -0,0 +1,121 @@
+"""
+generate_kernels.py - Compile a FullyConnected/Logistic .tflite into a straight-line C++ forward pass
+
+Emits a header with every weight and bias as an `inline constexpr` array
+(flash-resident) and a forward() that calls the fixed-size templates in
+include/compiled_kernels.h layer by layer. No flatbuffer parsing, op
+resolver, arena planning or per-op dispatch is left at runtime.
+
+Activations ping-pong between two halves of a caller-provided scratch
+buffer of kScratchSize floats.
+
+Usage: python3 generate_kernels.py <model.tflite> <out.h>
+"""
+
+import argparse
+import os
+
+import tflite_model as tfl
+
+
+def c_float(value):
+    text = '%.9g' % value                                   # 9 significant digits round-trip float32
+    if '.' not in text and 'e' not in text:
+        text += '.0'
+    return text + 'f'
+
+
+def c_array(values, per_line=8):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append('    ' + ', '.join(c_float(v) for v in values[i:i + per_line]) + ',')
+    return '\n'.join(lines)
+
+
+def generate(model, source_name):
+    subgraph = model['subgraphs'][0]
+    tensors = subgraph['tensors']
+    if any(t.get('type', tfl.FLOAT32) != tfl.FLOAT32 for t in tensors):
+        raise ValueError('only float32 models can be compiled')
+
+    input_size = tensors[subgraph['inputs'][0]]['shape'][-1]
+    output_size = tensors[subgraph['outputs'][0]]['shape'][-1]
+
+    arrays, calls, widths = [], [], []
+    parameter_bytes = 0
+    for op in subgraph['operators']:
+        name = tfl.op_name(model, op)
+        if name == 'FULLY_CONNECTED':
+            inputs = op['inputs']
+            out_features, in_features = tensors[inputs[1]]['shape']
+            relu = op.get('builtin_options', {}).get('fused_activation_function', 0) == tfl.ACT_RELU
+            layer = len(arrays)
+            parameter_bytes += 4 * (out_features * in_features + out_features)
+            arrays.append('alignas(16) inline constexpr float kDense%dWeights[%d][%d] = {\n%s\n};\n'
+                          'alignas(16) inline constexpr float kDense%dBias[%d] = {\n%s\n};\n'
+                          % (layer, out_features, in_features, c_array(tfl.tensor_floats(model, tensors[inputs[1]])),
+                             layer, out_features, c_array(tfl.tensor_floats(model, tensors[inputs[2]]))))
+            calls.append(('dense<%d, %d, %s>' % (in_features, out_features, 'true' if relu else 'false'),
+                          ', kDense%dWeights, kDense%dBias' % (layer, layer), out_features))
+        elif name == 'LOGISTIC':
+            size = tfl.num_elements(tensors[op['outputs'][0]])
+            calls.append(('logistic<%d>' % size, '', size))
+        else:
+            raise ValueError('op %s has no compiled kernel' % name)
+        widths.append(calls[-1][2])
+
+    half = max(widths[:-1] + [input_size])
+
+    body = []
+    src = 'input'
+    for i, (kernel, params, _) in enumerate(calls):
+        dst = 'output' if i == len(calls) - 1 else ('a' if i % 2 == 0 else 'b')
+        body.append('    compiled_kernels::%s(%s%s, %s);' % (kernel, src, params, dst))
+        src = dst
+    if len(calls) < 3:
+        body.insert(0, '    (void)b;')
+
+    guard = 'AUTOENCODER_COMPILED_H'
+    return '\n'.join([
+        '// Generated by scripts/generate_kernels.py from %s - do not edit' % source_name,
+        '',
+        '#ifndef %s' % guard,
+        '#define %s' % guard,
+        '',
+        '#include "compiled_kernels.h"',
+        '',
+        'namespace autoencoder_compiled {',
+        '',
+        'constexpr int kInputSize = %d;' % input_size,
+        'constexpr int kOutputSize = %d;' % output_size,
+        'constexpr int kScratchSize = %d;' % (2 * half),
+        'constexpr unsigned kParameterBytes = %d;' % parameter_bytes,
+        '',
+        ''.join(arrays),
+        'inline void forward(const float* input, float* output, float* scratch)',
+        '{',
+        '    float* a = scratch;',
+        '    float* b = scratch + %d;' % half,
+        '\n'.join(body),
+        '}',
+        '',
+        '}  // namespace autoencoder_compiled',
+        '',
+        '#endif // %s' % guard,
+        '',
+    ])
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('model')
+    parser.add_argument('output')
+    args = parser.parse_args()
+
+    source = generate(tfl.load(args.model), os.path.basename(args.model))
+    with open(args.output, 'w') as f:
+        f.write(source)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,80 @@
+"""
+generate_resolver.py - Generate an op resolver holding exactly the ops the models use
+
+Scans every operator of every model passed in and emits a header with a
+MicroMutableOpResolver sized to the distinct ops, plus the function that
+registers them. An op with no known TFLM registration stops the build here,
+and a registration this TFLM tree lacks fails to compile, so a retrained
+model can no longer reach AllocateTensors() with an unregistered op.
+
+Usage: python3 generate_resolver.py <out.h> <model.tflite> [<model.tflite> ...]
+"""
+
+import argparse
+import os
+import sys
+
+import tflite_model as tfl
+
+# Op name (as reported by tflite_model.op_name) -> MicroMutableOpResolver call
+REGISTRATIONS = {
+    'DEQUANTIZE': 'AddDequantize()',
+    'FULLY_CONNECTED': 'AddFullyConnected()',
+    'LOGISTIC': 'AddLogistic()',
+    'QUANTIZE': 'AddQuantize()',
+    'RELU': 'AddRelu()',
+    'RESHAPE': 'AddReshape()',
+    'SOFTMAX': 'AddSoftmax()',
+    'SPARSE_FULLY_CONNECTED': 'AddCustom(SPARSE_FULLY_CONNECTED_OP, register_sparse_fully_connected())',
+}
+
+# Custom ops: header declaring the registration function
+CUSTOM_HEADERS = {
+    'SPARSE_FULLY_CONNECTED': 'sparse_fully_connected.h',
+}
+
+
+def model_ops(model):
+    ops = []
+    for subgraph in model['subgraphs']:
+        for op in subgraph['operators']:
+            name = tfl.op_name(model, op)
+            if name not in ops:
+                ops.append(name)
+    return ops
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('output')
+    parser.add_argument('models', nargs='+')
+    args = parser.parse_args()
+
+    ops = []
+    for path in args.models:
+        for name in model_ops(tfl.load(path)):
+            if name not in REGISTRATIONS:
+                sys.exit('%s: op %s has no known TFLM registration; add it to REGISTRATIONS in %s'
+                         % (os.path.basename(path), name, os.path.basename(__file__)))
+            if name not in ops:
+                ops.append(name)
+
+    lines = ['// Generated by scripts/generate_resolver.py - do not edit', '',
+             '#ifndef MODEL_OP_RESOLVER_H', '#define MODEL_OP_RESOLVER_H', '',
+             '#include <tensorflow/lite/micro/micro_mutable_op_resolver.h>']
+    lines += ['#include "%s"' % CUSTOM_HEADERS[name] for name in ops if name in CUSTOM_HEADERS]
+    lines += ['',
+              '// Ops used by: %s' % ', '.join(os.path.basename(path) for path in args.models),
+              '#define MODEL_OP_COUNT %d' % len(ops), '',
+              'using ModelOpResolver = tflite::MicroMutableOpResolver<MODEL_OP_COUNT>;', '',
+              'inline TfLiteStatus register_model_ops(ModelOpResolver& resolver)', '{']
+    for name in ops:
+        lines.append('    if (resolver.%s != kTfLiteOk) return kTfLiteError;' % REGISTRATIONS[name])
+    lines += ['    return kTfLiteOk;', '}', '', '#endif // MODEL_OP_RESOLVER_H', '']
+
+    with open(args.output, 'w') as f:
+        f.write('\n'.join(lines))
+
+
+if __name__ == '__main__':
+    main()
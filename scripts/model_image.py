@@ -0,0 +1,64 @@
+"""
+model_image.py - Package a model for a flash model slot
+
+Image layout (little-endian), read back by src/model_store.cpp:
+
+    0   magic       'MODL' (0x4c444f4d)
+    4   version     Monotonic; the newest valid slot is the one tflite_setup() runs
+    8   model_len   Single-window model, starting at offset 32
+    12  batch_len   Batched model (0 if none), starting at the next 16-byte boundary
+    16  batch_size  Rows of the batched model's input
+    20  crc32       CRC-32 (IEEE, zlib.crc32) over everything after the header
+    24  reserved    Zero, pads the header to 32 bytes
+
+Usage: python3 model_image.py <model.tflite> <out.bin> --version 2 [--batch-model b.tflite --batch-size 8]
+"""
+
+import argparse
+import struct
+import zlib
+
+MAGIC = 0x4c444f4d
+HEADER = struct.Struct('<6I8x')
+ALIGN = 16
+
+
+def build_image(model, version, batch_model=b'', batch_size=0):
+    payload = model
+    if batch_model:
+        payload += b'\0' * (-len(payload) % ALIGN)
+        payload += batch_model
+    header = HEADER.pack(MAGIC, version, len(model), len(batch_model), batch_size, zlib.crc32(payload) & 0xffffffff)
+    return header + payload
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('model')
+    parser.add_argument('output')
+    parser.add_argument('--version', type=int, required=True)
+    parser.add_argument('--batch-model')
+    parser.add_argument('--batch-size', type=int, default=0)
+    args = parser.parse_args()
+
+    if args.version < 1:
+        parser.error('--version must be >= 1; 0 is the firmware\'s embedded model')
+    if args.batch_model and args.batch_size < 1:
+        parser.error('--batch-model needs --batch-size')
+
+    with open(args.model, 'rb') as f:
+        model = f.read()
+    batch_model = b''
+    if args.batch_model:
+        with open(args.batch_model, 'rb') as f:
+            batch_model = f.read()
+
+    image = build_image(model, args.version, batch_model, args.batch_size if batch_model else 0)
+    with open(args.output, 'wb') as f:
+        f.write(image)
+    print('%s: version %d, %d + %d model bytes, %d bytes total'
+          % (args.output, args.version, len(model), len(batch_model), len(image)))
+
+
+if __name__ == '__main__':
+    main()
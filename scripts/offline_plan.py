@@ -0,0 +1,90 @@
+"""
+offline_plan.py - Embed TFLM's offline memory plan in a model
+
+AllocateTensors() normally plans every activation's arena offset at boot.
+When a model carries "OfflineMemoryAllocation" metadata, TFLM places each
+tensor at the offset listed there instead, so allocation is a table lookup.
+The plan is made here with the same lifetimes scripts/arena_size.py uses and
+a greedy-by-size placement: largest buffers first, each at the lowest offset
+that does not overlap a buffer alive at the same time. The graph input is
+alive for the whole graph, so its region is never reused: the firmware packs
+sensor windows straight into it and scores against them after Invoke().
+
+Metadata buffer (int32, little-endian): [version 1, subgraph 0, tensor count,
+offset per tensor]; constant tensors get -1 (not planned).
+
+--strip removes an existing plan instead, for comparing boot time without one.
+
+Usage: python3 offline_plan.py <model.tflite> <out.tflite> [--strip]
+"""
+
+import argparse
+import struct
+
+import arena_size
+import tflite_model as tfl
+
+METADATA_NAME = 'OfflineMemoryAllocation'
+PLAN_VERSION = 1
+ONLINE = -1                     # TFLM: tensor is planned at runtime (or not at all)
+
+
+def greedy_offsets(planned):
+    """Return ({tensor index: offset}, extent) for {index: (first, last, size)}."""
+    placed = []
+    offsets = {}
+    for index in sorted(planned, key=lambda i: (-planned[i][2], i)):
+        first, last, size = planned[index]
+        offset = 0
+        for other_offset, other_first, other_last, other_size in sorted(placed):
+            if other_last < first or other_first > last:
+                continue                                # Never alive together
+            if offset + size <= other_offset:
+                break                                   # Fits in the gap below this one
+            offset = max(offset, other_offset + other_size)
+        placed.append((offset, first, last, size))
+        offsets[index] = offset
+    extent = max((offset + size for offset, _, _, size in placed), default=0)
+    return offsets, extent
+
+
+def strip_plan(model):
+    metadata = model.get('metadata', [])
+    model['metadata'] = [entry for entry in metadata if entry.get('name') != METADATA_NAME]
+    for entry in metadata:
+        if entry.get('name') == METADATA_NAME:
+            model['buffers'][entry['buffer']] = {}      # Leave buffer indices stable
+    return model
+
+
+def add_plan(model):
+    strip_plan(model)
+    offsets, extent = greedy_offsets(arena_size.lifetimes(model))
+    tensors = model['subgraphs'][0]['tensors']
+    table = [PLAN_VERSION, 0, len(tensors)] + [offsets.get(i, ONLINE) for i in range(len(tensors))]
+
+    model['buffers'].append({'data': struct.pack('<%di' % len(table), *table)})
+    model.setdefault('metadata', []).append({'name': METADATA_NAME, 'buffer': len(model['buffers']) - 1})
+    return extent, len(offsets)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('model')
+    parser.add_argument('output')
+    parser.add_argument('--strip', action='store_true', help='remove the plan instead of adding one')
+    args = parser.parse_args()
+
+    model = tfl.load(args.model)
+    if args.strip:
+        strip_plan(model)
+        print('%s: no offline plan' % args.output)
+    else:
+        extent, buffers = add_plan(model)
+        peak, _ = arena_size.activation_peak(model)
+        print('%s: offline plan for %d buffers, %d bytes (live peak %d)' % (args.output, buffers, extent, peak))
+    tfl.save(model, args.output)
+
+
+if __name__ == '__main__':
+    main()
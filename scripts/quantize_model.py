@@ -0,0 +1,201 @@
+"""
+quantize_model.py - Full-integer (int8) post-training quantization of the autoencoder
+
+Calibrates activation ranges on a representative dataset built from the
+data/machine_*/ CSVs, then rewrites the float model as an int8 model that
+TFLM runs on its integer (CMSIS-NN) kernels:
+
+  - weights:     int8, symmetric per-tensor (zero point 0)
+  - biases:      int32, scale = input_scale * weight_scale
+  - activations: int8, asymmetric per-tensor from the calibrated min/max
+  - Logistic:    output fixed at scale 1/256, zero point -128 as TFLM requires
+
+Model input and output become int8; tflite_wrapper.cpp quantizes the window
+and dequantizes the reconstruction at the edges. The script also simulates
+the integer model and prints the reconstruction-error drift against float.
+
+Usage: python3 quantize_model.py <float.tflite> <data_dir> <out.tflite>
+"""
+
+import argparse
+import math
+import struct
+
+import replay_data
+import tflite_model as tfl
+
+
+# --- Float reference ------------------------------------------------------------
+def fully_connected(x, weights, bias, out_features, relu):
+    in_features = len(x)
+    y = []
+    for o in range(out_features):
+        row = weights[o * in_features:(o + 1) * in_features]
+        acc = bias[o] if bias else 0.0
+        for i in range(in_features):
+            acc += row[i] * x[i]
+        y.append(max(acc, 0.0) if relu else acc)
+    return y
+
+
+def sigmoid(v):
+    return 1.0 / (1.0 + math.exp(-v)) if v >= 0 else math.exp(v) / (1.0 + math.exp(v))
+
+
+def forward_float(model, window):
+    """Run one window through the float graph; return every tensor's values by index."""
+    subgraph = model['subgraphs'][0]
+    tensors = subgraph['tensors']
+    values = {subgraph['inputs'][0]: list(window)}
+
+    for op in subgraph['operators']:
+        name = tfl.op_name(model, op)
+        inputs, outputs = op['inputs'], op['outputs']
+        x = values[inputs[0]]
+        if name == 'FULLY_CONNECTED':
+            weights = tfl.tensor_floats(model, tensors[inputs[1]])
+            bias = tfl.tensor_floats(model, tensors[inputs[2]]) if len(inputs) > 2 and inputs[2] >= 0 else None
+            relu = op.get('builtin_options', {}).get('fused_activation_function', 0) == tfl.ACT_RELU
+            values[outputs[0]] = fully_connected(x, weights, bias, tensors[inputs[1]]['shape'][0], relu)
+        elif name == 'LOGISTIC':
+            values[outputs[0]] = [sigmoid(v) for v in x]
+        else:
+            raise ValueError('unsupported op %s' % name)
+    return values
+
+
+def reconstruction_error(window, output, num_sensors):
+    n = min(num_sensors, len(window))
+    return sum((output[i] - window[i]) ** 2 for i in range(n)) / n if n else 0.0
+
+
+# --- Quantization -------------------------------------------------------------
+def activation_params(lo, hi):
+    lo, hi = min(lo, 0.0), max(hi, 0.0)                 # Range must contain 0
+    scale = (hi - lo) / 255.0 if hi > lo else 1.0
+    zero_point = int(round(-128 - lo / scale))
+    return scale, max(-128, min(127, zero_point))
+
+
+def quantize(model, windows):
+    subgraph = model['subgraphs'][0]
+    tensors = subgraph['tensors']
+
+    # Calibrate every activation tensor on the representative dataset
+    ranges = {}
+    for window, _ in windows:
+        for index, values in forward_float(model, window).items():
+            lo, hi = ranges.get(index, (float('inf'), float('-inf')))
+            ranges[index] = (min(lo, min(values)), max(hi, max(values)))
+
+    params = {}
+    for index, (lo, hi) in ranges.items():
+        params[index] = activation_params(lo, hi)
+    for op in subgraph['operators']:
+        if tfl.op_name(model, op) == 'LOGISTIC':
+            params[op['outputs'][0]] = (1.0 / 256.0, -128)
+
+    for index, (scale, zero_point) in params.items():
+        tensors[index]['type'] = tfl.INT8
+        tensors[index]['quantization'] = {'scale': [scale], 'zero_point': [zero_point]}
+
+    # Weights (int8, symmetric) and biases (int32) of every FullyConnected
+    for op in subgraph['operators']:
+        if tfl.op_name(model, op) != 'FULLY_CONNECTED':
+            continue
+        inputs = op['inputs']
+        input_scale = params[inputs[0]][0]
+
+        weight_tensor = tensors[inputs[1]]
+        weights = tfl.tensor_floats(model, weight_tensor)
+        weight_scale = max(abs(w) for w in weights) / 127.0 or 1.0
+        q_weights = [max(-127, min(127, int(round(w / weight_scale)))) for w in weights]
+        model['buffers'][weight_tensor['buffer']]['data'] = struct.pack('<%db' % len(q_weights), *q_weights)
+        weight_tensor['type'] = tfl.INT8
+        weight_tensor['quantization'] = {'scale': [weight_scale], 'zero_point': [0]}
+
+        if len(inputs) > 2 and inputs[2] >= 0:
+            bias_tensor = tensors[inputs[2]]
+            bias_scale = input_scale * weight_scale
+            q_bias = [int(round(b / bias_scale)) for b in tfl.tensor_floats(model, bias_tensor)]
+            model['buffers'][bias_tensor['buffer']]['data'] = struct.pack('<%di' % len(q_bias), *q_bias)
+            bias_tensor['type'] = tfl.INT32
+            bias_tensor['quantization'] = {'scale': [bias_scale], 'zero_point': [0]}
+
+    return model
+
+
+# --- Integer simulation (accuracy check only; rounding differs slightly from TFLM) ---
+def qparams(tensor):
+    q = tensor['quantization']
+    return q['scale'][0], q['zero_point'][0]
+
+
+def forward_int8(model, window):
+    subgraph = model['subgraphs'][0]
+    tensors = subgraph['tensors']
+    in_scale, in_zp = qparams(tensors[subgraph['inputs'][0]])
+    values = {subgraph['inputs'][0]: [max(-128, min(127, int(round(v / in_scale)) + in_zp)) for v in window]}
+
+    for op in subgraph['operators']:
+        inputs, outputs = op['inputs'], op['outputs']
+        x = values[inputs[0]]
+        x_scale, x_zp = qparams(tensors[inputs[0]])
+        y_scale, y_zp = qparams(tensors[outputs[0]])
+
+        if tfl.op_name(model, op) == 'FULLY_CONNECTED':
+            w_tensor = tensors[inputs[1]]
+            w_scale, _ = qparams(w_tensor)
+            data = tfl.buffer_data(model, w_tensor)
+            weights = struct.unpack('<%db' % len(data), data)
+            bias_data = tfl.buffer_data(model, tensors[inputs[2]])
+            bias = struct.unpack('<%di' % (len(bias_data) // 4), bias_data)
+            relu = op.get('builtin_options', {}).get('fused_activation_function', 0) == tfl.ACT_RELU
+            multiplier = x_scale * w_scale / y_scale
+            lo = y_zp if relu else -128
+
+            in_features = len(x)
+            y = []
+            for o in range(w_tensor['shape'][0]):
+                acc = bias[o]
+                for i in range(in_features):
+                    acc += (x[i] - x_zp) * weights[o * in_features + i]
+                y.append(max(lo, min(127, int(round(acc * multiplier)) + y_zp)))
+            values[outputs[0]] = y
+        else:
+            y = [sigmoid((v - x_zp) * x_scale) for v in x]
+            values[outputs[0]] = [max(-128, min(127, int(round(v / y_scale)) + y_zp)) for v in y]
+
+    out_scale, out_zp = qparams(tensors[subgraph['outputs'][0]])
+    return [(q - out_zp) * out_scale for q in values[subgraph['outputs'][0]]]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('model')
+    parser.add_argument('data_dir')
+    parser.add_argument('output')
+    parser.add_argument('--rows', type=int, default=200, help='representative rows per machine')
+    args = parser.parse_args()
+
+    windows = replay_data.load_windows(args.data_dir, args.rows)
+    float_model = tfl.load(args.model)
+    int8_model = quantize(tfl.load(args.model), windows)
+    tfl.save(int8_model, args.output)
+
+    # Report the reconstruction-error drift the quantization introduces
+    output_index = float_model['subgraphs'][0]['outputs'][0]
+    drift, worst = 0.0, 0.0
+    for window, num_sensors in windows:
+        float_score = reconstruction_error(window, forward_float(float_model, window)[output_index], num_sensors)
+        int8_score = reconstruction_error(window, forward_int8(int8_model, window), num_sensors)
+        drift += abs(int8_score - float_score)
+        worst = max(worst, abs(int8_score - float_score))
+
+    print('int8 model: %d bytes (float %d bytes), %d calibration windows, '
+          'score drift mean %.6f max %.6f' % (len(tfl.serialize(int8_model)), len(tfl.serialize(float_model)),
+                                               len(windows), drift / len(windows), worst))
+
+
+if __name__ == '__main__':
+    main()
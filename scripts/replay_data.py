@@ -0,0 +1,89 @@
+"""
+replay_data.py - Turn the simulated machine CSVs into normalized model windows
+
+Each window is one row of [Temperature, Pressure, Vibration] scaled to [0, 1]
+with the same per-machine ranges as machine_configs in src/main.c. Sensors a
+machine does not have stay at 0, exactly like pack_window() in
+src/tflite_wrapper.cpp.
+
+Used as a module by the model tools (representative dataset, accuracy
+checks) and as a CLI to embed a replay set in the firmware.
+
+Usage: python3 replay_data.py <data_dir> <out.cc> --rows 128
+"""
+
+import argparse
+import csv
+import os
+
+NUM_FEATURES = 3
+
+# Mirrors machine_configs in src/main.c: (csv suffix, min, max) per model feature
+MACHINES = [
+    ('machine_1', [('temp', 60.0, 100.0), ('pressure', 72.0, 145.0), ('vibration', 0.5, 2.0)]),
+    ('machine_2', [('temp', 150.0, 250.0), ('pressure', 87.0, 360.0)]),
+    ('machine_3', [('temp', 60.0, 105.0)]),
+]
+
+
+def read_column(path):
+    with open(path, newline='') as f:
+        rows = csv.reader(f)
+        next(rows)                                      # Skip header
+        return [float(row[1]) for row in rows if len(row) > 1]
+
+
+def load_windows(data_dir, rows=None):
+    """Return a list of (window, num_sensors) tuples, machines interleaved by row."""
+    per_machine = []
+    for machine, sensors in MACHINES:
+        columns = []
+        for suffix, lo, hi in sensors:
+            path = os.path.join(data_dir, machine, '%s_%s.csv' % (machine, suffix))
+            columns.append([(value - lo) / (hi - lo) for value in read_column(path)])
+
+        length = min(len(column) for column in columns)
+        if rows is not None:
+            length = min(length, rows)
+
+        windows = []
+        for r in range(length):
+            window = [0.0] * NUM_FEATURES
+            for f, column in enumerate(columns):
+                window[f] = column[r]
+            windows.append((window, len(sensors)))
+        per_machine.append(windows)
+
+    interleaved = []
+    for r in range(max(len(windows) for windows in per_machine)):
+        for windows in per_machine:
+            if r < len(windows):
+                interleaved.append(windows[r])
+    return interleaved
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('data_dir')
+    parser.add_argument('output')
+    parser.add_argument('--rows', type=int, default=128, help='rows replayed per machine')
+    args = parser.parse_args()
+
+    windows = load_windows(args.data_dir, args.rows)
+
+    with open(args.output, 'w') as f:
+        f.write('// Generated by scripts/replay_data.py from %s - do not edit\n\n' % os.path.basename(os.path.normpath(args.data_dir)))
+        f.write('#include "replay_data.h"\n\n')
+        f.write('const float replay_windows[][REPLAY_NUM_FEATURES] = {\n')
+        for window, _ in windows:
+            f.write('  {%s},\n' % ', '.join('%.8ff' % value for value in window))
+        f.write('};\n\n')
+        f.write('const unsigned char replay_num_sensors[] = {\n')
+        for i in range(0, len(windows), 24):
+            f.write('  ' + ', '.join(str(n) for _, n in windows[i:i + 24]) + ',\n')
+        f.write('};\n\n')
+        f.write('const unsigned int replay_num_windows = %d;\n' % len(windows))
+
+
+if __name__ == '__main__':
+    main()
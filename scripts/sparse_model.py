@@ -0,0 +1,277 @@
+"""
+sparse_model.py - Magnitude-prune FullyConnected weights and pack them block-sparse
+
+Weights are pruned in blocks of BLOCK_SIZE consecutive inputs of one output
+row: the blocks with the smallest L2 norm in each layer are zeroed until the
+requested sparsity is reached. Layers whose input width is not a multiple of
+BLOCK_SIZE (the 3-feature input layer) stay dense.
+
+A pruned layer is rewritten as the custom op SPARSE_FULLY_CONNECTED
+(src/sparse_fully_connected.cpp). Its weight tensor becomes a uint8 blob in
+the block-CSR layout of include/sparse_kernels.h:
+
+  u16 out_features, in_features, block_size, num_blocks
+  u16 row_ptr[out_features + 1]      first block of each output row
+  u16 block_col[num_blocks]          input column / block_size of each block
+  (zero padding to 4 bytes)
+  f32 values[num_blocks * block_size]
+
+Only float models are supported. Modes:
+  --output OUT --sparsity S   write the pruned, packed model
+  --report DATA_DIR           flash, MACs and replay accuracy at 50/75/90%
+  --benchmark-header OUT.h    dense and packed weights for the firmware benchmark
+
+Usage: python3 sparse_model.py <model.tflite> [--output OUT --sparsity S]
+                               [--report DATA_DIR] [--benchmark-header OUT.h]
+"""
+
+import argparse
+import copy
+import os
+import struct
+
+import generate_kernels
+import quantize_model
+import replay_data
+import tflite_model as tfl
+
+BLOCK_SIZE = 4
+OP_NAME = 'SPARSE_FULLY_CONNECTED'
+REPORT_SPARSITIES = (50, 75, 90)
+
+
+def fc_layers(model):
+    """(operator, weight tensor) of every FullyConnected in graph order."""
+    subgraph = model['subgraphs'][0]
+    return [(op, subgraph['tensors'][op['inputs'][1]]) for op in subgraph['operators']
+            if tfl.op_name(model, op) == 'FULLY_CONNECTED']
+
+
+def prunable(weight_tensor):
+    return weight_tensor['shape'][1] % BLOCK_SIZE == 0
+
+
+def prune_weights(weights, out_features, in_features, sparsity):
+    """Zero the lowest-norm blocks of one layer; returns the pruned weights."""
+    blocks_per_row = in_features // BLOCK_SIZE
+    norms = []
+    for o in range(out_features):
+        for b in range(blocks_per_row):
+            start = o * in_features + b * BLOCK_SIZE
+            norms.append((sum(w * w for w in weights[start:start + BLOCK_SIZE]), o, b))
+
+    pruned = list(weights)
+    for _, o, b in sorted(norms)[:int(round(len(norms) * sparsity / 100.0))]:
+        start = o * in_features + b * BLOCK_SIZE
+        pruned[start:start + BLOCK_SIZE] = [0.0] * BLOCK_SIZE
+    return pruned
+
+
+def prune(model, sparsity):
+    """Copy of the model with every prunable FullyConnected pruned in place (still dense)."""
+    model = copy.deepcopy(model)
+    for op, weight_tensor in fc_layers(model):
+        if not prunable(weight_tensor):
+            continue
+        out_features, in_features = weight_tensor['shape']
+        weights = prune_weights(tfl.tensor_floats(model, weight_tensor), out_features, in_features, sparsity)
+        model['buffers'][weight_tensor['buffer']]['data'] = struct.pack('<%df' % len(weights), *weights)
+    return model
+
+
+def block_csr(weights, out_features, in_features):
+    """Return (row_ptr, block_col, values) of the non-zero blocks."""
+    row_ptr, block_col, values = [0], [], []
+    for o in range(out_features):
+        for b in range(in_features // BLOCK_SIZE):
+            start = o * in_features + b * BLOCK_SIZE
+            block = weights[start:start + BLOCK_SIZE]
+            if any(w != 0.0 for w in block):
+                block_col.append(b)
+                values.extend(block)
+        row_ptr.append(len(block_col))
+    return row_ptr, block_col, values
+
+
+def pack(weights, out_features, in_features):
+    row_ptr, block_col, values = block_csr(weights, out_features, in_features)
+    index = struct.pack('<4H', out_features, in_features, BLOCK_SIZE, len(block_col))
+    index += struct.pack('<%dH' % len(row_ptr), *row_ptr) + struct.pack('<%dH' % len(block_col), *block_col)
+    index += bytes(-len(index) % 4)
+    return index + struct.pack('<%df' % len(values), *values)
+
+
+def sparsify(pruned):
+    """Rewrite the pruned FullyConnected layers as SPARSE_FULLY_CONNECTED with packed weights."""
+    model = copy.deepcopy(pruned)
+    codes = model['operator_codes']
+    opcode = next((i for i, code in enumerate(codes) if code.get('custom_code') == OP_NAME), None)
+
+    for op, weight_tensor in fc_layers(model):
+        if not prunable(weight_tensor):
+            continue
+        if opcode is None:
+            codes.append({'deprecated_builtin_code': 32, 'builtin_code': 32, 'custom_code': OP_NAME, 'version': 1})
+            opcode = len(codes) - 1
+
+        out_features, in_features = weight_tensor['shape']
+        blob = pack(tfl.tensor_floats(model, weight_tensor), out_features, in_features)
+        model['buffers'][weight_tensor['buffer']]['data'] = blob
+        weight_tensor['type'] = tfl.UINT8
+        weight_tensor['shape'] = [len(blob)]
+        weight_tensor.pop('shape_signature', None)
+
+        relu = op.get('builtin_options', {}).get('fused_activation_function', 0) == tfl.ACT_RELU
+        op['opcode_index'] = opcode
+        op.pop('builtin_options', None)
+        op.pop('builtin_options_type', None)
+        op['custom_options'] = bytes([1 if relu else 0, 0, 0, 0])      # Fused ReLU, reserved
+        op['custom_options_format'] = 0
+    return model
+
+
+def macs(model):
+    """Multiply-accumulates per window: dense layers in full, sparse ones per stored weight."""
+    total = 0
+    for op, weight_tensor in fc_layers(model):
+        total += tfl.num_elements(weight_tensor)
+    subgraph = model['subgraphs'][0]
+    for op in subgraph['operators']:
+        if tfl.op_name(model, op) == OP_NAME:
+            blob = tfl.buffer_data(model, subgraph['tensors'][op['inputs'][1]])
+            total += struct.unpack_from('<H', blob, 6)[0] * BLOCK_SIZE
+    return total
+
+
+def weight_bytes(model):
+    subgraph = model['subgraphs'][0]
+    total = 0
+    for op in subgraph['operators']:
+        if tfl.op_name(model, op) in ('FULLY_CONNECTED', OP_NAME):
+            total += len(tfl.buffer_data(model, subgraph['tensors'][op['inputs'][1]]))
+    return total
+
+
+def report(dense, data_dir, rows):
+    windows = replay_data.load_windows(data_dir, rows)
+    output = dense['subgraphs'][0]['outputs'][0]
+
+    def scores(model):
+        return [quantize_model.reconstruction_error(window, quantize_model.forward_float(model, window)[output], n)
+                for window, n in windows]
+
+    dense_scores = scores(dense)
+    threshold = sorted(dense_scores)[min(len(windows) - 1, int(0.99 * len(windows)))]
+    dense_size, dense_weights, dense_macs = len(tfl.serialize(dense)), weight_bytes(dense), macs(dense)
+
+    print('%d replayed windows, alarm threshold %.6f (p99 of dense scores)' % (len(windows), threshold))
+    print('%8s %11s %13s %11s %9s %12s %11s %10s'
+          % ('sparsity', 'model bytes', 'weight bytes', 'flash saved', 'MACs', 'MAC speedup',
+             'mean drift', 'agreement'))
+    print('%8s %11d %13d %11s %9d %12s %11s %10s' % ('dense', dense_size, dense_weights, '-', dense_macs, '1.00x',
+                                                     '-', '-'))
+    for sparsity in REPORT_SPARSITIES:
+        pruned = prune(dense, sparsity)
+        sparse = sparsify(pruned)
+        pruned_scores = scores(pruned)                  # Same arithmetic as the packed model
+        drift = sum(abs(p - d) for p, d in zip(pruned_scores, dense_scores)) / len(windows)
+        agree = sum((p > threshold) == (d > threshold) for p, d in zip(pruned_scores, dense_scores))
+        size = len(tfl.serialize(sparse))
+        print('%7d%% %11d %13d %10.1f%% %9d %11.2fx %11.6f %9.2f%%'
+              % (sparsity, size, weight_bytes(sparse), 100.0 * (dense_size - size) / dense_size, macs(sparse),
+                 dense_macs / float(macs(sparse)), drift, 100.0 * agree / len(windows)))
+    print('MAC speedup counts weights only; run the firmware with APP_BENCHMARK for measured latency.')
+    print('Pruning is one-shot: fine-tune the remaining weights with the block mask before deploying a level')
+    print('whose verdict agreement has dropped.')
+
+
+def c_u16(values, per_line=16):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append('    ' + ', '.join('%d' % v for v in values[i:i + per_line]) + ',')
+    return '\n'.join(lines)
+
+
+def benchmark_header(dense, source_name):
+    """Dense layers plus their block-CSR form at each report sparsity, for sparse_run_benchmark()."""
+    layers = fc_layers(dense)
+    parts, dense_rows, sparse_rows = [], [], {s: [] for s in REPORT_SPARSITIES}
+
+    for layer, (op, weight_tensor) in enumerate(layers):
+        out_features, in_features = weight_tensor['shape']
+        weights = tfl.tensor_floats(dense, weight_tensor)
+        bias = tfl.tensor_floats(dense, dense['subgraphs'][0]['tensors'][op['inputs'][2]])
+        relu = op.get('builtin_options', {}).get('fused_activation_function', 0) == tfl.ACT_RELU
+        parts.append('alignas(16) inline const float kLayer%dWeights[] = {\n%s\n};\n'
+                     'inline const float kLayer%dBias[] = {\n%s\n};\n'
+                     % (layer, generate_kernels.c_array(weights), layer, generate_kernels.c_array(bias)))
+        dense_rows.append('    {%d, %d, %s, kLayer%dWeights, kLayer%dBias},'
+                          % (in_features, out_features, 'true' if relu else 'false', layer, layer))
+
+        for sparsity in REPORT_SPARSITIES:
+            if not prunable(weight_tensor):
+                sparse_rows[sparsity].append('    {0, 0, 0, 0, nullptr, nullptr, nullptr},')
+                continue
+            row_ptr, block_col, values = block_csr(prune_weights(weights, out_features, in_features, sparsity),
+                                                   out_features, in_features)
+            name = 'kLayer%dS%d' % (layer, sparsity)
+            parts.append('inline const uint16_t %sRows[] = {\n%s\n};\n'
+                         'inline const uint16_t %sCols[] = {\n%s\n};\n'
+                         'alignas(16) inline const float %sValues[] = {\n%s\n};\n'
+                         % (name, c_u16(row_ptr), name, c_u16(block_col) or '    0,',
+                            name, generate_kernels.c_array(values) or '    0.0f,'))
+            sparse_rows[sparsity].append('    {%d, %d, %d, %d, %sRows, %sCols, %sValues},'
+                                         % (out_features, in_features, BLOCK_SIZE, len(block_col), name, name, name))
+
+    lines = ['// Generated by scripts/sparse_model.py from %s - do not edit' % source_name, '',
+             '#ifndef SPARSE_BENCHMARK_H', '#define SPARSE_BENCHMARK_H', '',
+             '#include "sparse_kernels.h"', '', 'namespace sparse_benchmark {', '',
+             'struct DenseLayer {', '    int in_features;', '    int out_features;', '    bool relu;',
+             '    const float* weights;', '    const float* bias;', '};', '',
+             'constexpr int kLayers = %d;' % len(layers),
+             'constexpr int kSparsities[] = {%s};' % ', '.join(str(s) for s in REPORT_SPARSITIES),
+             'constexpr int kNumSparsities = %d;' % len(REPORT_SPARSITIES), '',
+             ''.join(parts),
+             'inline const DenseLayer kDense[kLayers] = {', '\n'.join(dense_rows), '};', '',
+             '// Per sparsity and layer; out_features == 0 keeps that layer dense',
+             'inline const sparse_kernels::BlockSparseMatrix kSparse[kNumSparsities][kLayers] = {']
+    for sparsity in REPORT_SPARSITIES:
+        lines += ['  {', '\n'.join(sparse_rows[sparsity]), '  },']
+    lines += ['};', '', '}  // namespace sparse_benchmark', '', '#endif // SPARSE_BENCHMARK_H', '']
+    return '\n'.join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('model')
+    parser.add_argument('--output')
+    parser.add_argument('--sparsity', type=float, default=75.0, help='percent of weight blocks zeroed per layer')
+    parser.add_argument('--report', metavar='DATA_DIR')
+    parser.add_argument('--rows', type=int, default=200, help='replayed rows per machine for --report')
+    parser.add_argument('--benchmark-header', metavar='OUT_H')
+    args = parser.parse_args()
+
+    if not (args.output or args.report or args.benchmark_header):
+        parser.error('nothing to do: give --output, --report and/or --benchmark-header')
+    if not 0.0 <= args.sparsity < 100.0:
+        parser.error('--sparsity must be in [0, 100)')
+
+    dense = tfl.load(args.model)
+    if any(t.get('type', tfl.FLOAT32) != tfl.FLOAT32 for t in dense['subgraphs'][0]['tensors']):
+        parser.error('only float models can be pruned')
+
+    if args.output:
+        sparse = sparsify(prune(dense, args.sparsity))
+        tfl.save(sparse, args.output)
+        print('%s: %d%% block sparsity, weights %d -> %d bytes, %d -> %d MACs per window'
+              % (os.path.basename(args.output), args.sparsity, weight_bytes(dense), weight_bytes(sparse),
+                 macs(dense), macs(sparse)))
+    if args.benchmark_header:
+        with open(args.benchmark_header, 'w') as f:
+            f.write(benchmark_header(dense, os.path.basename(args.model)))
+    if args.report:
+        report(dense, args.report, args.rows)
+
+
+if __name__ == '__main__':
+    main()
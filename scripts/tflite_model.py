@@ -0,0 +1,341 @@
+"""
+tflite_model.py - Minimal, dependency-free reader/writer for .tflite flatbuffers
+
+Only the part of the TFLite schema our build tools need is described here.
+A model is loaded into plain dicts/lists (field name -> value), edited in
+Python and serialized back to a valid flatbuffer with the "TFL3" identifier.
+"""
+
+import struct
+
+# --- Schema subset (field index, name, kind) ---------------------------------
+# kinds: scalar ('u8', 'i8', 'bool', 'u16', 'i32', 'u32', 'i64', 'u64', 'f32'),
+#        'str', 'T:<Table>', 'V:<scalar>', 'V:str', 'VT:<Table>', 'U:<union field>'
+SCHEMA = {
+    'Model': [
+        (0, 'version', 'u32'),
+        (1, 'operator_codes', 'VT:OperatorCode'),
+        (2, 'subgraphs', 'VT:SubGraph'),
+        (3, 'description', 'str'),
+        (4, 'buffers', 'VT:Buffer'),
+        (5, 'metadata_buffer', 'V:i32'),
+        (6, 'metadata', 'VT:Metadata'),
+        (7, 'signature_defs', 'VT:SignatureDef'),
+    ],
+    'OperatorCode': [
+        (0, 'deprecated_builtin_code', 'i8'),
+        (1, 'custom_code', 'str'),
+        (2, 'version', 'i32'),
+        (3, 'builtin_code', 'i32'),
+    ],
+    'SubGraph': [
+        (0, 'tensors', 'VT:Tensor'),
+        (1, 'inputs', 'V:i32'),
+        (2, 'outputs', 'V:i32'),
+        (3, 'operators', 'VT:Operator'),
+        (4, 'name', 'str'),
+    ],
+    'Tensor': [
+        (0, 'shape', 'V:i32'),
+        (1, 'type', 'i8'),
+        (2, 'buffer', 'u32'),
+        (3, 'name', 'str'),
+        (4, 'quantization', 'T:QuantizationParameters'),
+        (5, 'is_variable', 'bool'),
+        (7, 'shape_signature', 'V:i32'),
+        (8, 'has_rank', 'bool'),
+    ],
+    'QuantizationParameters': [
+        (0, 'min', 'V:f32'),
+        (1, 'max', 'V:f32'),
+        (2, 'scale', 'V:f32'),
+        (3, 'zero_point', 'V:i64'),
+        (6, 'quantized_dimension', 'i32'),
+    ],
+    'Operator': [
+        (0, 'opcode_index', 'u32'),
+        (1, 'inputs', 'V:i32'),
+        (2, 'outputs', 'V:i32'),
+        (3, 'builtin_options_type', 'u8'),
+        (4, 'builtin_options', 'U:builtin_options_type'),
+        (5, 'custom_options', 'V:u8'),
+        (6, 'custom_options_format', 'i8'),
+        (8, 'intermediates', 'V:i32'),
+    ],
+    'FullyConnectedOptions': [
+        (0, 'fused_activation_function', 'i8'),
+        (1, 'weights_format', 'i8'),
+        (2, 'keep_num_dims', 'bool'),
+        (3, 'asymmetric_quantize_inputs', 'bool'),
+    ],
+    'Buffer': [
+        (0, 'data', 'V:u8'),
+        (1, 'offset', 'u64'),
+        (2, 'size', 'u64'),
+    ],
+    'Metadata': [
+        (0, 'name', 'str'),
+        (1, 'buffer', 'u32'),
+    ],
+    'SignatureDef': [
+        (0, 'inputs', 'VT:TensorMap'),
+        (1, 'outputs', 'VT:TensorMap'),
+        (2, 'signature_key', 'str'),
+        (4, 'subgraph_index', 'u32'),
+    ],
+    'TensorMap': [
+        (0, 'name', 'str'),
+        (1, 'tensor_index', 'u32'),
+    ],
+}
+
+# BuiltinOptions union members we understand (union type -> table)
+BUILTIN_OPTIONS = {
+    8: 'FullyConnectedOptions',
+}
+
+# BuiltinOperator codes used by our models
+BUILTIN_OPS = {
+    6: 'DEQUANTIZE',
+    9: 'FULLY_CONNECTED',
+    14: 'LOGISTIC',
+    19: 'RELU',
+    22: 'RESHAPE',
+    25: 'SOFTMAX',
+    32: 'CUSTOM',
+    114: 'QUANTIZE',
+}
+
+# TensorType
+FLOAT32, INT32, UINT8, INT64, INT16, INT8 = 0, 2, 3, 4, 7, 9
+TYPE_SIZE = {FLOAT32: 4, INT32: 4, UINT8: 1, INT64: 8, INT16: 2, INT8: 1}
+
+# ActivationFunctionType
+ACT_NONE, ACT_RELU = 0, 1
+
+SCALARS = {
+    'u8': ('<B', 1), 'i8': ('<b', 1), 'bool': ('<?', 1), 'u16': ('<H', 2),
+    'i32': ('<i', 4), 'u32': ('<I', 4), 'i64': ('<q', 8), 'u64': ('<Q', 8),
+    'f32': ('<f', 4),
+}
+
+FILE_IDENTIFIER = b'TFL3'
+BUFFER_ALIGNMENT = 16       # Schema: Buffer.data has force_align: 16
+
+
+# --- Reader -------------------------------------------------------------------
+class _Reader:
+    def __init__(self, data):
+        self.b = data
+
+    def u32(self, pos):
+        return struct.unpack_from('<I', self.b, pos)[0]
+
+    def deref(self, pos):
+        return pos + self.u32(pos)
+
+    def table(self, pos, name):
+        vt = pos - struct.unpack_from('<i', self.b, pos)[0]
+        vt_len = struct.unpack_from('<H', self.b, vt)[0]
+        slots = [struct.unpack_from('<H', self.b, vt + 4 + 2 * i)[0] for i in range((vt_len - 4) // 2)]
+        known = {index: (fname, kind) for index, fname, kind in SCHEMA[name]}
+
+        out = {}
+        for index, off in enumerate(slots):
+            if off == 0:
+                continue
+            if index not in known:
+                raise ValueError('%s: unsupported field %d' % (name, index))
+            fname, kind = known[index]
+            out[fname] = self.value(pos + off, kind, out)
+        return out
+
+    def value(self, pos, kind, siblings):
+        if kind in SCALARS:
+            return struct.unpack_from(SCALARS[kind][0], self.b, pos)[0]
+        if kind == 'str':
+            p = self.deref(pos)
+            return self.b[p + 4:p + 4 + self.u32(p)].decode('utf-8')
+        if kind.startswith('T:'):
+            return self.table(self.deref(pos), kind[2:])
+        if kind.startswith('U:'):
+            union_type = siblings.get(kind[2:], 0)
+            if union_type not in BUILTIN_OPTIONS:
+                raise ValueError('unsupported builtin options type %d' % union_type)
+            return self.table(self.deref(pos), BUILTIN_OPTIONS[union_type])
+
+        p = self.deref(pos)
+        n = self.u32(p)
+        elem = kind.split(':', 1)[1]
+        if kind == 'V:u8':
+            return bytes(self.b[p + 4:p + 4 + n])
+        if elem in SCALARS:
+            fmt, size = SCALARS[elem]
+            return list(struct.unpack_from('<%d%s' % (n, fmt[1]), self.b, p + 4))
+        if elem == 'str':
+            return [self.value(p + 4 + 4 * i, 'str', None) for i in range(n)]
+        return [self.table(self.deref(p + 4 + 4 * i), kind[3:]) for i in range(n)]
+
+
+def parse(data):
+    """Parse a .tflite flatbuffer into a dict tree."""
+    if data[4:8] != FILE_IDENTIFIER:
+        raise ValueError('not a TFLite model (missing TFL3 identifier)')
+    reader = _Reader(bytes(data))
+    return reader.table(reader.u32(0), 'Model')
+
+
+def load(path):
+    with open(path, 'rb') as f:
+        return parse(f.read())
+
+
+# --- Writer -------------------------------------------------------------------
+class _Builder:
+    """Back-to-front flatbuffer builder; offsets are measured from the end."""
+
+    def __init__(self):
+        self.buf = bytearray()
+        self.minalign = 1
+
+    def offset(self):
+        return len(self.buf)
+
+    def pad(self, n):
+        self.buf[0:0] = bytes(n)
+
+    def prep(self, size, additional):
+        self.minalign = max(self.minalign, size)
+        self.pad((-(len(self.buf) + additional)) % size)
+
+    def prepend(self, fmt, value):
+        size = struct.calcsize(fmt)
+        self.prep(size, 0)
+        self.buf[0:0] = struct.pack(fmt, value)
+
+    def prepend_uoffset(self, off):
+        self.prep(4, 0)
+        self.buf[0:0] = struct.pack('<I', self.offset() - off + 4)
+
+    def string(self, s):
+        data = s.encode('utf-8')
+        self.prep(4, len(data) + 1)
+        self.buf[0:0] = data + b'\0'
+        self.buf[0:0] = struct.pack('<I', len(data))
+        return self.offset()
+
+    def raw_vector(self, data, elem_size, count, alignment=4):
+        self.prep(4, len(data))
+        self.prep(max(alignment, elem_size), len(data))
+        self.buf[0:0] = data
+        self.buf[0:0] = struct.pack('<I', count)
+        return self.offset()
+
+    def offset_vector(self, offsets):
+        self.prep(4, 4 * len(offsets))
+        for off in reversed(offsets):
+            self.prepend_uoffset(off)
+        self.buf[0:0] = struct.pack('<I', len(offsets))
+        return self.offset()
+
+    def table(self, name, obj):
+        fields = SCHEMA[name]
+
+        # Children first: they must live after (below) the table that points at them
+        children = {}
+        for index, fname, kind in fields:
+            if fname not in obj or kind in SCALARS:
+                continue
+            children[index] = self.child(kind, obj[fname], obj, fname)
+
+        start = self.offset()
+        slots = {}
+        scalars = [(i, f, k) for i, f, k in fields if f in obj and k in SCALARS]
+        scalars.sort(key=lambda field: SCALARS[field[2]][1])        # Largest ends up first in memory
+        for index, fname, kind in scalars:
+            value = obj[fname]
+            self.prepend(SCALARS[kind][0], value)
+            slots[index] = self.offset()
+        for index, off in children.items():
+            self.prepend_uoffset(off)
+            slots[index] = self.offset()
+
+        self.prepend('<i', 0)                                       # soffset to vtable, patched below
+        table_off = self.offset()
+
+        num_slots = max(slots) + 1 if slots else 0
+        vtable = [4 + 2 * num_slots, table_off - start]
+        vtable += [table_off - slots[i] if i in slots else 0 for i in range(num_slots)]
+        for entry in reversed(vtable):
+            self.buf[0:0] = struct.pack('<H', entry)
+        vtable_off = self.offset()
+
+        table_pos = len(self.buf) - table_off
+        struct.pack_into('<i', self.buf, table_pos, vtable_off - table_off)
+        return table_off
+
+    def child(self, kind, value, siblings, fname):
+        if kind == 'str':
+            return self.string(value)
+        if kind.startswith('T:'):
+            return self.table(kind[2:], value)
+        if kind.startswith('U:'):
+            return self.table(BUILTIN_OPTIONS[siblings[kind[2:]]], value)
+        if kind == 'V:u8':
+            align = BUFFER_ALIGNMENT if fname == 'data' else 4
+            return self.raw_vector(bytes(value), 1, len(value), align)
+        elem = kind.split(':', 1)[1]
+        if elem in SCALARS:
+            fmt, size = SCALARS[elem]
+            return self.raw_vector(struct.pack('<%d%s' % (len(value), fmt[1]), *value), size, len(value))
+        if elem == 'str':
+            return self.offset_vector([self.string(s) for s in value])
+        table_name = kind[3:]
+        return self.offset_vector([self.table(table_name, item) for item in value])
+
+    def finish(self, root):
+        self.prep(self.minalign, 8)
+        self.buf[0:0] = FILE_IDENTIFIER
+        self.prepend_uoffset(root)
+        return bytes(self.buf)
+
+
+def serialize(model):
+    """Serialize a dict tree produced by parse() back into .tflite bytes."""
+    builder = _Builder()
+    root = builder.table('Model', model)
+    return builder.finish(root)
+
+
+def save(model, path):
+    with open(path, 'wb') as f:
+        f.write(serialize(model))
+
+
+# --- Helpers ------------------------------------------------------------------
+def op_name(model, op):
+    code = model['operator_codes'][op.get('opcode_index', 0)]
+    builtin = max(code.get('builtin_code', 0), code.get('deprecated_builtin_code', 0))
+    if builtin == 32:
+        return code.get('custom_code', 'CUSTOM')
+    return BUILTIN_OPS.get(builtin, 'BUILTIN_%d' % builtin)
+
+
+def buffer_data(model, tensor):
+    return model['buffers'][tensor.get('buffer', 0)].get('data', b'')
+
+
+def is_constant(model, tensor):
+    return len(buffer_data(model, tensor)) > 0
+
+
+def tensor_floats(model, tensor):
+    data = buffer_data(model, tensor)
+    return list(struct.unpack('<%df' % (len(data) // 4), data))
+
+
+def num_elements(tensor):
+    n = 1
+    for dim in tensor.get('shape', []):
+        n *= dim
+    return n
@@ -0,0 +1,40 @@
+"""
+tflite_to_c.py - Embed a .tflite file as a const, 16-byte aligned C++ array
+
+The array is const so it stays in flash (.rodata) instead of being copied
+into .data RAM at boot, and 16-byte aligned as TFLM expects for the
+flatbuffer's tensor buffers.
+
+Usage: python3 tflite_to_c.py <model.tflite> <out.cc> --symbol autoencoder_model_tflite
+"""
+
+import argparse
+import os
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('model')
+    parser.add_argument('output')
+    parser.add_argument('--symbol', required=True)
+    parser.add_argument('--header', default='autoencoder_model.h')
+    args = parser.parse_args()
+
+    with open(args.model, 'rb') as f:
+        data = f.read()
+
+    lines = []
+    for i in range(0, len(data), 12):
+        lines.append('  ' + ', '.join('0x%02x' % byte for byte in data[i:i + 12]) + ',')
+
+    with open(args.output, 'w') as f:
+        f.write('// Generated by scripts/tflite_to_c.py from %s - do not edit\n\n' % os.path.basename(args.model))
+        f.write('#include "%s"\n\n' % args.header)
+        f.write('alignas(16) const unsigned char %s[] = {\n' % args.symbol)
+        f.write('\n'.join(lines) + '\n')
+        f.write('};\n')
+        f.write('const unsigned int %s_len = %d;\n' % (args.symbol, len(data)))
+
+
+if __name__ == '__main__':
+    main()
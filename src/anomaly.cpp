@@ -0,0 +1,71 @@
+/*
+//  anomaly.cpp - Per-machine adaptive thresholds over the reconstruction error
+*/
+
+#include "anomaly.h"
+#include <math.h>
+#include <string.h>
+
+typedef struct {
+    float mean;
+    float var;
+    uint32_t scores;
+} ScoreStats;
+
+static ScoreStats machines[ANOMALY_MAX_MACHINES];
+
+static void judge(int machine, const InferenceResult* result, AnomalyVerdict* verdict, bool learn)
+{
+    if (result == NULL || verdict == NULL) {
+        return;
+    }
+
+    verdict->mse = result->score;
+    verdict->mae = result->mae;
+    verdict->machine = (uint8_t)machine;
+    verdict->anomalous = 0;
+    verdict->warming_up = 0;
+    verdict->threshold = ANOMALY_MIN_THRESHOLD;
+
+    if (machine < 0 || machine >= ANOMALY_MAX_MACHINES) {
+        verdict->anomalous = result->score > ANOMALY_MIN_THRESHOLD;     // No history: fixed floor only
+        return;
+    }
+
+    ScoreStats* s = &machines[machine];
+    float threshold = s->mean + ANOMALY_K * sqrtf(s->var);
+    verdict->threshold = threshold > ANOMALY_MIN_THRESHOLD ? threshold : ANOMALY_MIN_THRESHOLD;
+
+    if (s->scores < ANOMALY_WARMUP) {
+        verdict->warming_up = 1;
+    } else if (result->score > verdict->threshold) {
+        verdict->anomalous = 1;
+        return;                                                         // Keep faults out of the baseline
+    }
+    if (!learn) return;
+
+    if (s->scores == 0) {
+        s->mean = result->score;
+        s->var = 0.0f;
+    } else {
+        float diff = result->score - s->mean;
+        s->mean += ANOMALY_ALPHA * diff;
+        s->var = (1.0f - ANOMALY_ALPHA) * (s->var + ANOMALY_ALPHA * diff * diff);
+    }
+    s->scores++;
+}
+
+extern "C" void anomaly_judge(int machine, const InferenceResult* result, AnomalyVerdict* verdict)
+{
+    judge(machine, result, verdict, true);
+}
+
+extern "C" void anomaly_check(int machine, const InferenceResult* result, AnomalyVerdict* verdict)
+{
+    judge(machine, result, verdict, false);
+}
+
+extern "C" void anomaly_reset(void)
+{
+    memset(machines, 0, sizeof(machines));
+}
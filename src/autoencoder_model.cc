@@ -1,2193 +0,0 @@
-unsigned char autoencoder_tflite[] = {
-  0x1c, 0x00, 0x00, 0x00, 0x54, 0x46, 0x4c, 0x33, 0x14, 0x00, 0x20, 0x00,
-  0x1c, 0x00, 0x18, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x8c, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00, 0xd0, 0x5b, 0x00, 0x00,
-  0xe0, 0x5b, 0x00, 0x00, 0x44, 0x66, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xd6, 0xa3, 0xff, 0xff,
-  0x0c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
-  0x0f, 0x00, 0x00, 0x00, 0x73, 0x65, 0x72, 0x76, 0x69, 0x6e, 0x67, 0x5f,
-  0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x90, 0xff, 0xff, 0xff, 0x13, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x6f, 0x75, 0x74, 0x70,
-  0x75, 0x74, 0x5f, 0x30, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0xb2, 0xa7, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x0f, 0x00, 0x00, 0x00, 0x6b, 0x65, 0x72, 0x61, 0x73, 0x5f, 0x74, 0x65,
-  0x6e, 0x73, 0x6f, 0x72, 0x5f, 0x31, 0x34, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x34, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xdc, 0xff, 0xff, 0xff,
-  0x16, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
-  0x43, 0x4f, 0x4e, 0x56, 0x45, 0x52, 0x53, 0x49, 0x4f, 0x4e, 0x5f, 0x4d,
-  0x45, 0x54, 0x41, 0x44, 0x41, 0x54, 0x41, 0x00, 0x08, 0x00, 0x0c, 0x00,
-  0x08, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x6d, 0x69, 0x6e, 0x5f,
-  0x72, 0x75, 0x6e, 0x74, 0x69, 0x6d, 0x65, 0x5f, 0x76, 0x65, 0x72, 0x73,
-  0x69, 0x6f, 0x6e, 0x00, 0x17, 0x00, 0x00, 0x00, 0xe8, 0x5a, 0x00, 0x00,
-  0xe0, 0x5a, 0x00, 0x00, 0xd0, 0x57, 0x00, 0x00, 0xb8, 0x37, 0x00, 0x00,
-  0xa8, 0x2f, 0x00, 0x00, 0x98, 0x27, 0x00, 0x00, 0x88, 0x07, 0x00, 0x00,
-  0x78, 0x06, 0x00, 0x00, 0xe8, 0x05, 0x00, 0x00, 0x98, 0x05, 0x00, 0x00,
-  0x08, 0x05, 0x00, 0x00, 0xf8, 0x03, 0x00, 0x00, 0xdc, 0x03, 0x00, 0x00,
-  0xcc, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x00,
-  0xb4, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00,
-  0x9c, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x8a, 0xa8, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x60, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x0e, 0x00, 0x08, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
-  0x08, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x14, 0x00, 0x10, 0x00,
-  0x0c, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x7c, 0xc0, 0x5b, 0xae,
-  0x0b, 0x0b, 0xdc, 0x58, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x32, 0x2e, 0x31, 0x39,
-  0x2e, 0x30, 0x00, 0x00, 0xf6, 0xa8, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x31, 0x2e, 0x31, 0x34, 0x2e, 0x30, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x9b, 0xff, 0xff,
-  0xbc, 0x9b, 0xff, 0xff, 0xc0, 0x9b, 0xff, 0xff, 0xc4, 0x9b, 0xff, 0xff,
-  0xc8, 0x9b, 0xff, 0xff, 0xcc, 0x9b, 0xff, 0xff, 0xd0, 0x9b, 0xff, 0xff,
-  0x2e, 0xa9, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
-  0xe9, 0xb2, 0x03, 0xbe, 0x80, 0x0d, 0xad, 0x3e, 0x6e, 0x9e, 0x58, 0x3d,
-  0x6c, 0x00, 0x57, 0x3e, 0xc7, 0xf9, 0x73, 0x3e, 0xc3, 0x09, 0x54, 0x3e,
-  0x2e, 0x6b, 0xb9, 0xbd, 0xa8, 0xad, 0xa8, 0xbd, 0x5c, 0x48, 0x86, 0xbe,
-  0x64, 0xd4, 0x54, 0x3e, 0x1b, 0x21, 0xb5, 0x3e, 0xc6, 0x5a, 0xb2, 0x3c,
-  0x70, 0x7d, 0xee, 0x3d, 0x28, 0xb5, 0x74, 0x3e, 0x58, 0x09, 0x80, 0xbe,
-  0x72, 0x5a, 0xb2, 0x3e, 0xa1, 0x68, 0xe8, 0xbd, 0xcc, 0xbd, 0x85, 0x3e,
-  0x4b, 0x73, 0x3a, 0x3d, 0x40, 0x40, 0x10, 0x3e, 0xa7, 0x52, 0xb0, 0x3e,
-  0x52, 0x44, 0x3e, 0x3d, 0x7d, 0xe3, 0x95, 0x3e, 0x91, 0x5d, 0x52, 0x3d,
-  0x17, 0xab, 0x8f, 0x3e, 0x3f, 0x16, 0x4b, 0x3e, 0x71, 0x28, 0x97, 0xbd,
-  0xa8, 0x6b, 0x21, 0x3e, 0xe4, 0x90, 0x93, 0xbe, 0x1e, 0x23, 0x8a, 0x3e,
-  0xc5, 0x20, 0xd4, 0x3b, 0x3d, 0x54, 0xe8, 0xbd, 0x1b, 0xfa, 0x08, 0xbd,
-  0x33, 0x89, 0x48, 0x3e, 0x1d, 0x6c, 0xb8, 0x3c, 0x27, 0x67, 0xbd, 0x3e,
-  0x42, 0x40, 0xc5, 0xbd, 0x90, 0xd7, 0x05, 0xbd, 0x38, 0xd9, 0x23, 0xbe,
-  0x42, 0x87, 0xf9, 0x3d, 0x64, 0xb5, 0x80, 0x3e, 0xe7, 0x3a, 0x3e, 0xbe,
-  0x23, 0xc5, 0x7d, 0x3e, 0xef, 0x70, 0x53, 0xbc, 0xd6, 0x29, 0x80, 0xbe,
-  0x71, 0x04, 0xe9, 0xbd, 0xd7, 0xb9, 0x63, 0xbd, 0x0e, 0x7f, 0xfd, 0x3c,
-  0xb7, 0x87, 0x48, 0xbe, 0xdf, 0x6e, 0x31, 0xbe, 0x10, 0x28, 0x70, 0xbd,
-  0xc2, 0xdc, 0xc8, 0x3d, 0x1b, 0x99, 0x66, 0x3d, 0xfc, 0x6e, 0x8a, 0x3e,
-  0x7a, 0x78, 0xc6, 0xbe, 0xf3, 0x24, 0x89, 0x3d, 0x6d, 0x00, 0x6e, 0x3d,
-  0xc3, 0x87, 0x84, 0x3e, 0x4d, 0x01, 0x84, 0x3d, 0x58, 0x33, 0x42, 0x3e,
-  0x00, 0x83, 0xc2, 0x3e, 0x5d, 0x69, 0xad, 0x3e, 0xaf, 0x38, 0x36, 0xbe,
-  0xfc, 0x99, 0x6b, 0x3e, 0x5b, 0xfa, 0x92, 0x3e, 0xb0, 0x16, 0x5d, 0x3e,
-  0x80, 0xfa, 0x22, 0x3e, 0x00, 0x43, 0xeb, 0x3d, 0x24, 0x5e, 0x5d, 0x3e,
-  0x43, 0x84, 0x31, 0x3e, 0x67, 0xce, 0xed, 0xbd, 0x67, 0xcf, 0x29, 0xbd,
-  0x15, 0xf7, 0xb9, 0x3d, 0x40, 0x3c, 0x9d, 0x3e, 0xc5, 0xa3, 0xac, 0xbe,
-  0xbf, 0xc9, 0x06, 0x3e, 0x51, 0x9e, 0xfc, 0xbc, 0x1b, 0xb7, 0xa2, 0xbd,
-  0xd0, 0x3f, 0x86, 0xbe, 0x44, 0xdf, 0x8d, 0xbe, 0xd8, 0x97, 0x39, 0xbe,
-  0xde, 0x9c, 0xfa, 0xbc, 0x72, 0x96, 0x98, 0x3e, 0x27, 0x1f, 0x9f, 0xbd,
-  0x0f, 0x96, 0x4e, 0xbe, 0xf9, 0x62, 0xc0, 0xbe, 0xe1, 0xad, 0x82, 0x3e,
-  0x58, 0x07, 0xb9, 0x3e, 0x00, 0x8e, 0x6c, 0x3e, 0x63, 0x9f, 0x65, 0xbe,
-  0x49, 0x9b, 0x0e, 0xbd, 0x19, 0x06, 0x27, 0x3e, 0x61, 0x53, 0x43, 0xbd,
-  0x6a, 0x56, 0xbc, 0x3d, 0x85, 0xc1, 0x51, 0x3e, 0x8e, 0xe3, 0xa1, 0x3e,
-  0x5f, 0x73, 0x0f, 0xbd, 0x53, 0xfe, 0xb4, 0x3d, 0x06, 0xdd, 0x00, 0x3e,
-  0x2e, 0xad, 0x77, 0xbe, 0x28, 0x5c, 0x6e, 0xbe, 0x72, 0x20, 0x47, 0xbe,
-  0xf5, 0xda, 0xc9, 0x3e, 0xf2, 0xec, 0x7c, 0x3e, 0xf6, 0x83, 0xf4, 0x3c,
-  0x38, 0xa2, 0x92, 0x3e, 0xa3, 0xc7, 0xc6, 0x3d, 0xfa, 0xef, 0x74, 0x3e,
-  0xc9, 0xcd, 0x31, 0x3e, 0x07, 0xe8, 0x93, 0x3e, 0xbe, 0xfa, 0x77, 0x3d,
-  0x62, 0x42, 0x29, 0x3e, 0x60, 0x99, 0x25, 0x3e, 0x50, 0x04, 0x39, 0x3e,
-  0x5a, 0x47, 0x94, 0x3e, 0x3c, 0xf9, 0xfd, 0x3d, 0x49, 0x8e, 0x9b, 0xbc,
-  0x0d, 0x31, 0xe9, 0x3d, 0x27, 0x82, 0xd2, 0x3d, 0x4f, 0x97, 0x65, 0x3e,
-  0xec, 0xd0, 0x2b, 0x3e, 0xdc, 0xc8, 0x5c, 0x3e, 0x0e, 0x4e, 0x48, 0xbe,
-  0x24, 0xa6, 0xd4, 0xbd, 0xf2, 0xb0, 0xc9, 0xbd, 0x1a, 0xd8, 0x8d, 0x3e,
-  0xbd, 0x5e, 0x51, 0xbd, 0x99, 0x5e, 0x3a, 0xbe, 0xbd, 0xab, 0x9f, 0x3e,
-  0x98, 0x79, 0x1a, 0x3d, 0x83, 0xb4, 0xc7, 0xbe, 0x58, 0x1d, 0x10, 0x3e,
-  0x31, 0x50, 0x3b, 0xbe, 0x39, 0x48, 0x4b, 0x3d, 0xd0, 0x27, 0xf9, 0xbd,
-  0xa4, 0x37, 0x09, 0xbe, 0xc4, 0x42, 0x0c, 0xbe, 0xd6, 0x71, 0xe2, 0xbd,
-  0x52, 0x07, 0xa1, 0xbd, 0x35, 0x60, 0x89, 0x3e, 0xad, 0xff, 0x51, 0x3e,
-  0x05, 0xde, 0x6d, 0xbe, 0x3c, 0x42, 0x1f, 0xbe, 0x9e, 0xb2, 0xc7, 0x3d,
-  0xb4, 0x5b, 0xce, 0x3d, 0x00, 0x35, 0x7c, 0x3b, 0xcb, 0xef, 0xda, 0x3d,
-  0x53, 0x1d, 0xc8, 0xbd, 0x5a, 0x70, 0xf1, 0xbc, 0xd0, 0x42, 0x5e, 0x3e,
-  0x83, 0x46, 0x88, 0xbd, 0xfb, 0xb0, 0x7f, 0x3e, 0xac, 0x5a, 0x4b, 0xbd,
-  0x5f, 0x24, 0x85, 0x3e, 0x4e, 0xa6, 0x0b, 0xb9, 0x1f, 0xa9, 0x50, 0xbe,
-  0x1c, 0xc7, 0x6f, 0xbd, 0xb8, 0xc9, 0x85, 0xbe, 0x88, 0xaa, 0x93, 0xbe,
-  0xbb, 0xb6, 0x88, 0x3d, 0xf1, 0xb0, 0xe6, 0x3d, 0x01, 0xc7, 0x28, 0xbf,
-  0x4e, 0xe1, 0x0b, 0x3e, 0xa1, 0x85, 0xde, 0x3d, 0x0c, 0xf6, 0xcb, 0xbc,
-  0xe8, 0xfb, 0x7b, 0x3e, 0xea, 0xd1, 0xaf, 0xbd, 0xce, 0x53, 0x3e, 0xbe,
-  0x28, 0xb3, 0x40, 0xbd, 0x24, 0xff, 0x75, 0xbd, 0x66, 0x59, 0xe5, 0xbd,
-  0x81, 0xf4, 0x48, 0xbe, 0x30, 0xf8, 0x9d, 0x3e, 0x4e, 0x50, 0xf4, 0x3d,
-  0x6a, 0x03, 0x94, 0x3d, 0x64, 0xca, 0x0e, 0x3d, 0x5c, 0x24, 0x8b, 0x3e,
-  0x88, 0xdf, 0xb3, 0xbd, 0xa3, 0x46, 0xc9, 0x3d, 0x56, 0x0f, 0x8c, 0x3e,
-  0x2e, 0xa3, 0x01, 0xbe, 0x5a, 0x6c, 0x45, 0x3e, 0xc5, 0xdf, 0x1b, 0x3e,
-  0xc2, 0xc7, 0x8c, 0x3d, 0xbc, 0xa4, 0x04, 0xbd, 0xce, 0xd2, 0x07, 0xbf,
-  0x30, 0x3c, 0x30, 0xbe, 0xb3, 0xa2, 0xd5, 0x3d, 0x89, 0x6a, 0xb2, 0xbe,
-  0x25, 0xa1, 0x82, 0x3e, 0x6e, 0xf2, 0x06, 0xbe, 0x81, 0x68, 0x84, 0x3d,
-  0x3a, 0xac, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0xed, 0x67, 0xa2, 0xbd, 0x37, 0x7e, 0x6c, 0xbc, 0x01, 0xc6, 0xe4, 0xbc,
-  0x52, 0xac, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-  0x7d, 0xf8, 0xd2, 0x3c, 0xa7, 0xdd, 0x54, 0xbb, 0x72, 0x37, 0x05, 0x3d,
-  0xd9, 0xb5, 0x99, 0xbc, 0x68, 0x85, 0x3a, 0xbc, 0x73, 0x10, 0xed, 0x3c,
-  0xf1, 0xdb, 0x4c, 0x3c, 0xe8, 0x4f, 0xa4, 0x3d, 0xa6, 0xca, 0x33, 0x3d,
-  0x9c, 0xe4, 0xb4, 0xbb, 0xac, 0x6e, 0xa9, 0x3d, 0x51, 0x52, 0x9b, 0x3d,
-  0xe9, 0x37, 0x4e, 0x3d, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x39, 0x66, 0x3d,
-  0xa4, 0x3c, 0x39, 0x3d, 0xfb, 0x41, 0xe6, 0xbc, 0x93, 0x05, 0x38, 0xbd,
-  0x20, 0xa8, 0x1c, 0x3d, 0x1e, 0x8e, 0x46, 0x3d, 0x35, 0x33, 0x11, 0x3d,
-  0x2e, 0xaa, 0x0c, 0xbd, 0x3f, 0x04, 0xe9, 0xbb, 0x76, 0x26, 0x58, 0x3d,
-  0x7d, 0x4c, 0x71, 0x3d, 0xfc, 0x8e, 0x84, 0x3d, 0xfb, 0xa8, 0x41, 0xbc,
-  0x07, 0x51, 0x29, 0x3d, 0x38, 0xab, 0x61, 0xbb, 0xe8, 0x54, 0xa5, 0x3d,
-  0x4c, 0xf4, 0x92, 0xbd, 0x24, 0x01, 0x39, 0xbc, 0x68, 0x22, 0x8d, 0x3d,
-  0xe3, 0x4b, 0x84, 0x3d, 0x15, 0x52, 0x21, 0x3d, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x7c, 0x22, 0x55, 0xbd, 0xef, 0xfa, 0x09, 0xbc,
-  0x51, 0xcc, 0x34, 0xbc, 0x10, 0x76, 0x4a, 0x3d, 0x89, 0x88, 0x87, 0xbc,
-  0x33, 0xb5, 0xa7, 0xbc, 0x1b, 0x71, 0x99, 0x3d, 0xb2, 0xa4, 0xde, 0x3c,
-  0x40, 0xf2, 0x05, 0x3d, 0xd2, 0xb7, 0xe0, 0xb9, 0xef, 0xb3, 0xe3, 0xbb,
-  0xfa, 0x43, 0x45, 0x3d, 0x4c, 0x23, 0xff, 0x3c, 0xc7, 0x97, 0x7b, 0x3d,
-  0x54, 0xed, 0x8d, 0xbd, 0xe0, 0x5b, 0xeb, 0xbb, 0x4a, 0x74, 0x8c, 0xbc,
-  0x46, 0xc7, 0x12, 0xbc, 0x25, 0x62, 0x5e, 0xbb, 0x52, 0x9c, 0x83, 0x3d,
-  0xb8, 0xe0, 0xa9, 0x3d, 0x7e, 0xb1, 0x89, 0x3d, 0x4f, 0x90, 0x5d, 0x3d,
-  0x00, 0x00, 0x00, 0x00, 0xed, 0x33, 0x31, 0xbd, 0x03, 0x36, 0xe0, 0x3c,
-  0xeb, 0x91, 0xd0, 0x3c, 0x5e, 0xad, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x80, 0x00, 0x00, 0x00, 0xc8, 0x68, 0x97, 0x3d, 0x9d, 0xde, 0x3e, 0x3d,
-  0x00, 0x00, 0x00, 0x00, 0x1a, 0x01, 0x13, 0xbc, 0x2d, 0x7b, 0x80, 0x3d,
-  0x72, 0x13, 0x13, 0x3d, 0x5b, 0x02, 0xab, 0x3d, 0x7a, 0x4c, 0x17, 0xbd,
-  0x17, 0x8f, 0x60, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x72, 0xec, 0x0a, 0x3c,
-  0x0e, 0x71, 0x51, 0xbd, 0xaf, 0x70, 0xce, 0xbc, 0x00, 0x00, 0x00, 0x00,
-  0x58, 0x8d, 0xe8, 0xbc, 0xf4, 0xf2, 0x9c, 0x3d, 0x3d, 0x9b, 0xf6, 0x3c,
-  0xbd, 0x07, 0x5e, 0x3d, 0x84, 0x4d, 0x43, 0x3d, 0x1b, 0xcc, 0xaf, 0x3c,
-  0xfb, 0xb5, 0x22, 0x3d, 0xd9, 0x3f, 0xa8, 0x3c, 0x18, 0xfd, 0x08, 0xbd,
-  0x73, 0x7e, 0x00, 0x3d, 0x61, 0x91, 0x25, 0x3d, 0xfc, 0xea, 0xb6, 0x3c,
-  0x57, 0x11, 0x96, 0x3d, 0xda, 0xca, 0x89, 0x3d, 0x00, 0x00, 0x00, 0x00,
-  0xa2, 0x52, 0x8c, 0x3d, 0xe5, 0xf5, 0xa8, 0x3d, 0x00, 0x00, 0x00, 0x00,
-  0xea, 0xad, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x5b, 0x36, 0xad, 0x3d, 0xec, 0x9f, 0x89, 0x3d, 0xde, 0x82, 0x71, 0xbc,
-  0x00, 0x00, 0x00, 0x00, 0x13, 0xc1, 0x8d, 0x3d, 0xeb, 0x4e, 0x97, 0x3d,
-  0xe9, 0x32, 0xff, 0x3c, 0x37, 0x84, 0x97, 0xbd, 0x43, 0x74, 0xd2, 0x3c,
-  0x88, 0xfa, 0x22, 0x3c, 0xe6, 0x24, 0x9d, 0x3d, 0x6f, 0xe8, 0xa4, 0x3d,
-  0x4b, 0x80, 0xb6, 0xbc, 0x9f, 0xef, 0x8e, 0x3d, 0x1d, 0x1d, 0x6c, 0xbd,
-  0xf7, 0xb7, 0x99, 0x3d, 0x36, 0xae, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x80, 0x00, 0x00, 0x00, 0xcd, 0x7c, 0x8a, 0xbd, 0xf5, 0x76, 0xd2, 0x3d,
-  0xb4, 0xc0, 0xe7, 0xbc, 0xb7, 0x6f, 0x9f, 0x3d, 0x00, 0x00, 0x00, 0x00,
-  0xc0, 0x9b, 0x6b, 0xbd, 0xc9, 0x23, 0xc2, 0x3c, 0xfa, 0xc0, 0x9a, 0x3d,
-  0x32, 0x75, 0x82, 0x3d, 0xf4, 0x73, 0x99, 0x3d, 0xcb, 0xe7, 0xe5, 0xbb,
-  0xb8, 0xa4, 0xb9, 0x3c, 0x79, 0x6b, 0x81, 0xbd, 0x0e, 0x5f, 0x17, 0xbc,
-  0x81, 0xe5, 0x61, 0x3d, 0xc3, 0xd2, 0xac, 0x3d, 0xc4, 0xda, 0x0f, 0x3d,
-  0x00, 0x00, 0x00, 0x00, 0x18, 0xa4, 0x9a, 0x3d, 0xe7, 0x82, 0xcd, 0xbc,
-  0x39, 0xc1, 0x34, 0x3d, 0xf1, 0x3c, 0xe5, 0x3c, 0x27, 0x0d, 0x22, 0xbd,
-  0x26, 0x03, 0xb2, 0x3d, 0x64, 0xce, 0x9a, 0x3d, 0x48, 0x7e, 0xb5, 0x3d,
-  0x00, 0x00, 0x00, 0x00, 0x63, 0x2f, 0xc0, 0x3d, 0xd4, 0x1a, 0x20, 0xbc,
-  0x00, 0x00, 0x00, 0x00, 0x13, 0x0d, 0xb2, 0xbc, 0xd9, 0x33, 0x8f, 0xbc,
-  0xc2, 0xae, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-  0x16, 0xe9, 0xfb, 0x3d, 0x38, 0x89, 0x1b, 0xbd, 0x00, 0x00, 0x00, 0x00,
-  0xc7, 0x53, 0x7b, 0x3d, 0x33, 0x12, 0xc6, 0x3d, 0xca, 0x2d, 0xca, 0x3d,
-  0x30, 0xf7, 0x02, 0xba, 0xba, 0x01, 0xbd, 0xba, 0x0b, 0xb8, 0x33, 0xbd,
-  0x49, 0x9b, 0x6d, 0x3d, 0xec, 0xee, 0xa1, 0xbc, 0x28, 0x88, 0xf4, 0xba,
-  0x00, 0x00, 0x00, 0x00, 0x23, 0xf4, 0xb4, 0x3d, 0x4e, 0x87, 0x57, 0x3d,
-  0xf3, 0xfb, 0xa9, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x77, 0x5a, 0xae, 0xbb,
-  0x7e, 0x75, 0x23, 0x3d, 0xc4, 0x99, 0xa0, 0x3d, 0xf3, 0x1f, 0x9a, 0x3d,
-  0x0f, 0xb1, 0xbc, 0xbb, 0x30, 0x14, 0x62, 0x3a, 0x11, 0x8c, 0xee, 0x3d,
-  0x3a, 0xb5, 0xea, 0x3c, 0xce, 0xc2, 0xd0, 0x3d, 0x00, 0x00, 0x00, 0x00,
-  0xe0, 0x3a, 0xaa, 0x3d, 0x42, 0x3d, 0x30, 0x3d, 0x3b, 0x02, 0xb8, 0x3d,
-  0x6f, 0xef, 0x91, 0x3d, 0x87, 0xb2, 0xa2, 0xbc, 0x0e, 0x56, 0x66, 0x3d,
-  0x00, 0x00, 0x00, 0x00, 0x79, 0xf0, 0xcb, 0x3d, 0x87, 0x8b, 0xa6, 0x3d,
-  0x4b, 0xab, 0xc2, 0x3d, 0x99, 0x61, 0x8e, 0x3d, 0x7c, 0x31, 0x6a, 0xbc,
-  0x41, 0x32, 0x78, 0xbd, 0x91, 0x24, 0xdf, 0x3d, 0x1b, 0x84, 0x07, 0x3e,
-  0x33, 0x67, 0x83, 0x3d, 0xc3, 0xd9, 0x23, 0x3d, 0x08, 0xe0, 0x85, 0x3c,
-  0x00, 0x00, 0x00, 0x00, 0x49, 0xc1, 0x9f, 0x3d, 0xa7, 0x67, 0x4b, 0xbd,
-  0x2c, 0xe8, 0xae, 0x3d, 0xfe, 0x7b, 0xfc, 0x3d, 0x5f, 0x05, 0xbf, 0x3d,
-  0x54, 0x74, 0xcd, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x60, 0x84, 0x08, 0x3d,
-  0xd2, 0x18, 0xc8, 0x3d, 0x18, 0xfb, 0xb2, 0x3d, 0x00, 0x00, 0x00, 0x00,
-  0x39, 0x6d, 0xf3, 0x3d, 0x8a, 0xfc, 0x75, 0x3d, 0x39, 0x45, 0xb3, 0x3d,
-  0xea, 0xa0, 0x00, 0x3e, 0x4f, 0xff, 0xbe, 0x3d, 0x3e, 0x4d, 0x3e, 0xba,
-  0xdb, 0x33, 0xd6, 0x3d, 0xce, 0xaf, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x20, 0x00, 0x00, 0xf0, 0xb4, 0x31, 0xbe, 0xe2, 0x47, 0xe2, 0x3d,
-  0xb0, 0x7f, 0x0e, 0x3d, 0x2d, 0xf9, 0xa8, 0x3e, 0xd0, 0xce, 0x18, 0xbe,
-  0xbd, 0x5b, 0x8f, 0x3e, 0x3f, 0x80, 0x98, 0x3e, 0xc4, 0xe1, 0xda, 0x3d,
-  0xde, 0xc6, 0x52, 0x3e, 0x77, 0xdb, 0xaf, 0xbd, 0x2c, 0x66, 0x04, 0x3e,
-  0xdc, 0xac, 0xb2, 0x3c, 0xdc, 0x33, 0x07, 0xbe, 0x8f, 0xdf, 0x23, 0xbe,
-  0x73, 0xa6, 0x05, 0x3e, 0x21, 0x80, 0xe3, 0xbc, 0x60, 0xc4, 0x70, 0x3e,
-  0x6a, 0x48, 0x4b, 0x3e, 0xff, 0x3f, 0x6e, 0xbe, 0x00, 0x5e, 0x09, 0xbc,
-  0xd4, 0x20, 0x4b, 0x3e, 0x94, 0x9c, 0x9e, 0x3e, 0xe3, 0x52, 0x52, 0x3e,
-  0x95, 0xbd, 0xba, 0x3d, 0x92, 0x3c, 0x3d, 0x3e, 0xf5, 0xf4, 0x31, 0x3e,
-  0xc0, 0xb7, 0xa4, 0x3c, 0x1f, 0x89, 0x4d, 0xbe, 0x78, 0x5c, 0x55, 0x3e,
-  0xd6, 0x85, 0x67, 0x3e, 0x79, 0x49, 0x15, 0xbe, 0x68, 0x04, 0x1e, 0x3e,
-  0x8f, 0xaf, 0xb9, 0xbc, 0xc0, 0x5f, 0xa7, 0xbd, 0xcf, 0x36, 0x9f, 0x3e,
-  0x98, 0x97, 0x44, 0x3e, 0xe0, 0x84, 0xba, 0x3d, 0x29, 0x26, 0x95, 0x3e,
-  0xfa, 0x1f, 0x86, 0x3e, 0xdb, 0x48, 0xa0, 0x3d, 0x90, 0xe7, 0x19, 0xbe,
-  0xc3, 0x43, 0x35, 0xbe, 0x45, 0xdf, 0xb9, 0xbc, 0xf0, 0x91, 0xac, 0xbd,
-  0x90, 0x03, 0x82, 0xbc, 0xc0, 0x6c, 0xa4, 0x3d, 0x35, 0xec, 0x17, 0xbe,
-  0xb2, 0x1a, 0x6f, 0xbc, 0x09, 0xde, 0x8f, 0x3e, 0x15, 0xba, 0x56, 0xbd,
-  0xb3, 0xdc, 0xcc, 0x3c, 0xd8, 0x44, 0x4c, 0x3e, 0x48, 0x80, 0x7d, 0xbe,
-  0xb5, 0x8a, 0xe7, 0x3d, 0x5b, 0x12, 0x2c, 0xbe, 0xb5, 0xad, 0x23, 0xbe,
-  0x00, 0xd5, 0xb1, 0xbd, 0x94, 0x8c, 0x18, 0xbd, 0xed, 0x52, 0x1c, 0x3e,
-  0x4c, 0xcc, 0x51, 0xbe, 0xb0, 0x17, 0xd8, 0xbd, 0x4b, 0x38, 0xf3, 0xbd,
-  0x86, 0x3c, 0x93, 0xbe, 0x2d, 0x20, 0xca, 0xbc, 0xb5, 0x99, 0x88, 0x3e,
-  0xea, 0x6a, 0x2e, 0x3e, 0xc8, 0x73, 0x8e, 0xbd, 0x1a, 0xa1, 0x8f, 0x3c,
-  0x22, 0x49, 0x64, 0x3e, 0x4e, 0xed, 0xa5, 0xbd, 0x25, 0xf5, 0x97, 0x3e,
-  0x00, 0xd6, 0x2d, 0xbb, 0xc1, 0x08, 0xbb, 0xbd, 0x7b, 0x5b, 0xae, 0xbd,
-  0xfd, 0x12, 0x32, 0x3e, 0x6c, 0x94, 0xf7, 0x3d, 0xec, 0x21, 0x42, 0x3e,
-  0x34, 0xb4, 0x65, 0x3d, 0x4b, 0xc1, 0xc1, 0xbd, 0xa1, 0xe5, 0x67, 0xbe,
-  0xc0, 0xca, 0x59, 0x3c, 0xf5, 0x43, 0x44, 0xbe, 0x67, 0xa0, 0x11, 0x3e,
-  0x79, 0x11, 0x2f, 0xbe, 0xe2, 0xfc, 0xe3, 0xbd, 0xab, 0x1d, 0xf5, 0x3d,
-  0xc7, 0xd1, 0x1f, 0xbe, 0x23, 0x97, 0x0b, 0x3e, 0xb0, 0x53, 0xca, 0x3d,
-  0xad, 0x52, 0x83, 0xbd, 0xc4, 0x53, 0x70, 0xbe, 0x88, 0x15, 0x8b, 0x3e,
-  0x2e, 0xdd, 0xa2, 0x3e, 0x84, 0x5e, 0xb4, 0xbd, 0x94, 0x61, 0x1d, 0x3e,
-  0x00, 0x22, 0x8a, 0xbd, 0x31, 0xc0, 0x5a, 0x3e, 0xa8, 0x27, 0x1a, 0x3e,
-  0xee, 0xd6, 0xd1, 0x3d, 0xb2, 0x08, 0x1a, 0xbd, 0xee, 0xdb, 0x21, 0x3e,
-  0xaf, 0x37, 0xdd, 0xbc, 0xf8, 0x4c, 0x57, 0xbe, 0x5a, 0xf2, 0x8d, 0x3d,
-  0x25, 0xab, 0x4b, 0x3e, 0x88, 0x62, 0x75, 0x3e, 0xeb, 0xba, 0x06, 0x3e,
-  0x63, 0xd6, 0x85, 0xbd, 0x0f, 0x2f, 0x5d, 0x3e, 0x7c, 0x4a, 0x5a, 0x3e,
-  0x33, 0xaa, 0x1d, 0x3e, 0x82, 0xbe, 0x6c, 0x3e, 0xcc, 0xd5, 0x39, 0xbe,
-  0x80, 0xa6, 0x71, 0x3e, 0xc8, 0x5d, 0xd2, 0xbd, 0xea, 0x32, 0xa8, 0xba,
-  0x70, 0x93, 0x05, 0x3d, 0x85, 0x33, 0x31, 0x3c, 0x75, 0x68, 0x60, 0x3e,
-  0x2d, 0xa1, 0x71, 0xbe, 0x28, 0xcf, 0x29, 0xbe, 0x79, 0x07, 0x04, 0x3e,
-  0xa1, 0x89, 0xcc, 0xbd, 0xa7, 0xfb, 0xae, 0x3e, 0x71, 0x56, 0xf1, 0x3d,
-  0x07, 0x12, 0x09, 0x3e, 0xd6, 0xcc, 0x70, 0x3d, 0x85, 0x0f, 0x05, 0x3e,
-  0x98, 0x02, 0x13, 0x3e, 0x12, 0xbc, 0x6a, 0x3e, 0x18, 0xcf, 0xbf, 0x3d,
-  0xf7, 0x99, 0x89, 0x3e, 0x0b, 0xca, 0x1e, 0xbe, 0xdd, 0xc8, 0x56, 0xbe,
-  0x17, 0xb4, 0x6b, 0x3e, 0x33, 0x9b, 0xcc, 0x3d, 0x29, 0xc4, 0x2e, 0x3d,
-  0xfb, 0xb4, 0x08, 0x3e, 0xdf, 0x4a, 0x8a, 0xbb, 0xe6, 0xe7, 0x00, 0x3e,
-  0x68, 0x59, 0x9e, 0x3d, 0x40, 0x81, 0x08, 0x3e, 0xc8, 0x93, 0x08, 0xbd,
-  0xef, 0xd7, 0xed, 0x3d, 0x00, 0x28, 0x5d, 0xbb, 0x11, 0xe6, 0x11, 0x3e,
-  0x78, 0xbd, 0x70, 0xbc, 0x7a, 0xf0, 0xce, 0xbd, 0x87, 0x78, 0x83, 0x3e,
-  0x8e, 0x04, 0x86, 0x3e, 0xf7, 0xa1, 0x01, 0xbe, 0xd5, 0x64, 0x9e, 0xbc,
-  0x33, 0x3f, 0x56, 0x3e, 0x4d, 0x59, 0xb9, 0xbd, 0x00, 0xa3, 0x3c, 0x3e,
-  0x88, 0x53, 0x08, 0xbe, 0x31, 0x35, 0x19, 0xbe, 0x1b, 0x90, 0xa8, 0xbd,
-  0x25, 0xc8, 0xc3, 0x3d, 0xa3, 0x23, 0x8d, 0x3e, 0x3b, 0x70, 0xcc, 0xbd,
-  0xc0, 0x8e, 0x55, 0xbc, 0x16, 0xe7, 0x63, 0x3e, 0x1b, 0xfa, 0x5f, 0x3d,
-  0x86, 0x63, 0x9b, 0x3e, 0x8b, 0x69, 0x36, 0xbe, 0x68, 0xf2, 0x12, 0x3e,
-  0x6f, 0xb6, 0x16, 0x3e, 0xfc, 0x5f, 0x4f, 0x3e, 0x6c, 0x0a, 0x40, 0xbd,
-  0xed, 0x51, 0x72, 0x3a, 0x25, 0x8d, 0x7b, 0xbe, 0x56, 0x54, 0x7c, 0xbe,
-  0x00, 0x17, 0xc7, 0xbb, 0x87, 0x71, 0x44, 0x3e, 0x6b, 0xd7, 0xc1, 0x3d,
-  0x07, 0xe9, 0x45, 0x3d, 0xfd, 0xaf, 0x6b, 0x3d, 0x8e, 0x13, 0x30, 0xbe,
-  0x60, 0xf7, 0xb1, 0xbc, 0x54, 0x0a, 0x0b, 0x3e, 0x04, 0x0d, 0x12, 0xbe,
-  0xfc, 0x26, 0x3a, 0x3e, 0xb8, 0xa6, 0x4f, 0x3e, 0x78, 0xa9, 0x34, 0xbe,
-  0x15, 0x92, 0x69, 0xbe, 0x08, 0x24, 0x01, 0x3e, 0x1b, 0x9c, 0x07, 0xbd,
-  0xc2, 0x2e, 0xe3, 0xbd, 0x27, 0x7b, 0x5e, 0xbe, 0x3b, 0x92, 0xde, 0x3b,
-  0x56, 0xc0, 0x81, 0xbd, 0x4d, 0x79, 0xcb, 0xbc, 0xbb, 0x57, 0xf7, 0xbd,
-  0xe0, 0xd3, 0xec, 0xbd, 0xcc, 0x4e, 0x58, 0x3e, 0x99, 0xae, 0x5f, 0x3e,
-  0xa0, 0xf3, 0x76, 0x3e, 0xdb, 0x6c, 0x37, 0xbd, 0x86, 0xb5, 0x56, 0x3e,
-  0xc3, 0xcd, 0xbd, 0x3c, 0xc5, 0x6d, 0x1f, 0xbe, 0x68, 0x59, 0x85, 0xbd,
-  0x5f, 0x67, 0x99, 0xbd, 0x40, 0xfb, 0xd6, 0xbc, 0x90, 0x0c, 0x2e, 0xbe,
-  0x5b, 0x8d, 0xbd, 0x3d, 0x82, 0x25, 0x21, 0xbe, 0x60, 0x69, 0xef, 0x3c,
-  0xb6, 0x90, 0x35, 0x3c, 0x43, 0x54, 0x01, 0xbb, 0x05, 0xac, 0x8e, 0x3e,
-  0x45, 0x92, 0xda, 0xbc, 0x21, 0x98, 0x99, 0x3c, 0xfa, 0xf5, 0x83, 0x3e,
-  0x80, 0x02, 0x67, 0xbc, 0x59, 0x8d, 0xde, 0xbd, 0x06, 0x4c, 0x8e, 0x3e,
-  0xb0, 0x4c, 0x6e, 0x3d, 0x90, 0xdf, 0x9e, 0x3d, 0xac, 0x49, 0x4f, 0x3e,
-  0x3e, 0x37, 0x9c, 0x3e, 0xb0, 0x6a, 0x36, 0x3e, 0x50, 0x34, 0x2f, 0xbe,
-  0x09, 0x62, 0xd6, 0x3b, 0x60, 0x1b, 0x8d, 0x3d, 0xc7, 0x52, 0x9e, 0x3e,
-  0x03, 0x0f, 0x01, 0x3e, 0x1f, 0xea, 0xbc, 0x3d, 0xa5, 0xb7, 0x2e, 0x3d,
-  0xb0, 0x9b, 0x3c, 0xbe, 0x9e, 0x8f, 0x37, 0xbe, 0x59, 0xcf, 0x8d, 0x3e,
-  0xfb, 0xd1, 0xcb, 0x3d, 0xf5, 0x2c, 0xba, 0xbd, 0xd5, 0x7c, 0x81, 0x3e,
-  0x36, 0x45, 0xc6, 0x3d, 0x28, 0x10, 0x21, 0xbe, 0x87, 0xec, 0x55, 0x3e,
-  0x43, 0x8d, 0xdb, 0xbd, 0xfb, 0xbe, 0x09, 0xbc, 0x49, 0x6b, 0x1c, 0xbe,
-  0x5c, 0xce, 0x1e, 0x3e, 0x72, 0x23, 0x65, 0x3e, 0x48, 0xcc, 0x49, 0xbe,
-  0xa5, 0x9f, 0xf1, 0xbc, 0x01, 0xf8, 0x6b, 0xbd, 0x3b, 0x40, 0x91, 0x3c,
-  0xc0, 0xca, 0x53, 0x3c, 0x97, 0x1f, 0x33, 0xbd, 0xa9, 0xce, 0xc9, 0x3d,
-  0xe3, 0x5e, 0x4f, 0xbe, 0x91, 0xa2, 0xa3, 0xbd, 0x94, 0x1f, 0x9c, 0x3e,
-  0xb6, 0xd2, 0x17, 0xbe, 0x51, 0xe6, 0x9c, 0x3e, 0xe8, 0xbd, 0x9c, 0xbd,
-  0xa8, 0x5b, 0x75, 0xbe, 0x20, 0x43, 0xeb, 0xbd, 0xe8, 0x14, 0x08, 0x3e,
-  0x88, 0x90, 0xb1, 0xbd, 0x40, 0xda, 0x4c, 0x3d, 0x00, 0xce, 0xd2, 0x3d,
-  0x80, 0x01, 0xe7, 0x3c, 0xa0, 0xf3, 0xf5, 0x3c, 0x98, 0x5d, 0x19, 0xbe,
-  0xec, 0x3a, 0x3d, 0xbe, 0x80, 0x87, 0x32, 0x3e, 0x2c, 0x97, 0x76, 0xbe,
-  0xac, 0x7b, 0x3c, 0x3e, 0xec, 0x50, 0x7d, 0x3e, 0xc8, 0xcf, 0xce, 0xbd,
-  0x90, 0x44, 0x30, 0xbd, 0xf4, 0xd1, 0x50, 0xbe, 0xb8, 0x49, 0xc8, 0xbd,
-  0x8c, 0xc4, 0x5d, 0xbe, 0x9c, 0xed, 0x72, 0xbe, 0xa0, 0x99, 0xc4, 0xbc,
-  0x40, 0x47, 0x7c, 0xbd, 0xc4, 0xcc, 0x03, 0xbe, 0x00, 0xe7, 0x50, 0x3b,
-  0x40, 0x1f, 0x34, 0x3e, 0xe8, 0x2d, 0x61, 0xbe, 0x88, 0x85, 0x9e, 0x3d,
-  0xe4, 0xe3, 0x37, 0x3e, 0x20, 0x28, 0x57, 0xbe, 0x28, 0x6d, 0x67, 0x3e,
-  0x00, 0x1a, 0x49, 0x3b, 0x20, 0xc0, 0x35, 0x3e, 0x6c, 0xa1, 0x4b, 0xbe,
-  0x80, 0x29, 0xb4, 0xbb, 0x50, 0x8c, 0xa5, 0x3d, 0xd0, 0x6f, 0x33, 0xbe,
-  0xe0, 0x8d, 0x0a, 0x3e, 0xa0, 0x7e, 0x44, 0xbd, 0xf0, 0x9a, 0x9a, 0x3d,
-  0x20, 0x22, 0x5c, 0xbd, 0xf0, 0x59, 0x7c, 0x3e, 0x30, 0xee, 0x2b, 0x3e,
-  0xc0, 0xe7, 0x6e, 0x3d, 0x20, 0x2b, 0xaa, 0xbd, 0xe8, 0xd0, 0x95, 0x3d,
-  0x1c, 0x30, 0x4d, 0xbe, 0xc0, 0x38, 0x3f, 0xbc, 0x64, 0xe4, 0x28, 0xbe,
-  0xc8, 0x9a, 0x68, 0xbe, 0x40, 0x2b, 0x14, 0x3d, 0xfc, 0xc3, 0x20, 0xbe,
-  0x30, 0x3c, 0x4c, 0xbe, 0xb8, 0xb2, 0x8e, 0xbd, 0x4c, 0x07, 0x22, 0xbe,
-  0xc8, 0x7d, 0xbc, 0xbd, 0x50, 0x07, 0xde, 0xbd, 0x9c, 0x62, 0x0b, 0xbe,
-  0xe0, 0xa3, 0x32, 0xbd, 0x30, 0x81, 0x35, 0xbd, 0xb4, 0x67, 0x74, 0xbe,
-  0xe8, 0xa2, 0x7d, 0x3e, 0x38, 0x67, 0x1b, 0x3e, 0x58, 0xd7, 0x21, 0x3e,
-  0x1b, 0xee, 0x8b, 0x3b, 0xbf, 0x0b, 0x70, 0x3e, 0xe0, 0xa3, 0xb0, 0x3c,
-  0x5f, 0x0b, 0x70, 0x3e, 0x88, 0x41, 0xc7, 0xbd, 0xaa, 0x50, 0x5f, 0x3e,
-  0x6f, 0x6d, 0x5c, 0x3e, 0xad, 0x7b, 0xb6, 0xbd, 0x71, 0xcf, 0x76, 0x3d,
-  0xd1, 0x44, 0x6a, 0x3c, 0xc2, 0xe2, 0x66, 0x3d, 0x6f, 0x20, 0x5b, 0x3e,
-  0xb0, 0x59, 0x31, 0x3d, 0x7d, 0xe0, 0x23, 0xbe, 0x79, 0x45, 0x35, 0xbe,
-  0xfb, 0xb8, 0x3c, 0xbd, 0x88, 0xf5, 0xe2, 0xbd, 0x86, 0x08, 0x50, 0x3e,
-  0x96, 0x5b, 0xd7, 0xbd, 0x3d, 0xfa, 0x40, 0x3e, 0xa8, 0xd1, 0xa5, 0x3d,
-  0xd0, 0x2a, 0x87, 0xbd, 0xbf, 0x2d, 0x2c, 0x3e, 0xc7, 0x67, 0x9b, 0xbd,
-  0x2e, 0x88, 0xf3, 0x3d, 0xf3, 0x76, 0x69, 0xbc, 0x80, 0x19, 0xc1, 0xbb,
-  0x34, 0xe9, 0x83, 0x3d, 0xa8, 0x1d, 0xa8, 0x3e, 0x38, 0x32, 0x8c, 0xbe,
-  0x67, 0x24, 0xff, 0xbd, 0x7c, 0x7e, 0x9f, 0x3e, 0x6d, 0xd2, 0x53, 0x3d,
-  0x1c, 0x1a, 0x2b, 0xbe, 0x71, 0x5c, 0x81, 0x3e, 0x29, 0x22, 0x30, 0xbe,
-  0xe6, 0x6a, 0x80, 0x3e, 0x26, 0x67, 0x83, 0x3e, 0xb1, 0x65, 0x98, 0xbc,
-  0xb6, 0x92, 0x56, 0x3e, 0x29, 0x73, 0x34, 0xbe, 0x55, 0x3d, 0x40, 0x3e,
-  0xc3, 0x9e, 0xe6, 0xbd, 0xe5, 0xe9, 0x95, 0x3e, 0xc6, 0xd9, 0x3e, 0xbe,
-  0x38, 0x47, 0x1f, 0x3e, 0xd9, 0x09, 0x8e, 0x3d, 0x26, 0x98, 0xfb, 0xbb,
-  0x71, 0x50, 0xde, 0xbd, 0x61, 0x91, 0x67, 0x3e, 0x68, 0x06, 0x92, 0xbe,
-  0xb6, 0x43, 0x88, 0xbe, 0x60, 0x46, 0xd8, 0xbc, 0xce, 0xe1, 0x43, 0xbe,
-  0xe2, 0x41, 0x17, 0xbe, 0xb8, 0x87, 0x4a, 0xbe, 0xa0, 0xab, 0xd1, 0xbd,
-  0x39, 0x33, 0x23, 0x3e, 0x94, 0x9a, 0xc5, 0xbb, 0x42, 0x60, 0x42, 0xbd,
-  0xf6, 0xd5, 0x54, 0x3e, 0xe4, 0x88, 0xea, 0x3b, 0xa9, 0x37, 0xce, 0x3d,
-  0x1a, 0xf9, 0x36, 0x3e, 0x66, 0x61, 0x84, 0x3e, 0x3c, 0x4f, 0x1f, 0x3e,
-  0x68, 0x02, 0x2c, 0x3e, 0x4c, 0x41, 0x04, 0x3e, 0xd5, 0xa7, 0x98, 0xbd,
-  0xc3, 0x89, 0xd7, 0x3d, 0x15, 0x7e, 0xe9, 0x3d, 0x60, 0x39, 0x2b, 0xbe,
-  0x87, 0x90, 0x0d, 0x3e, 0x54, 0xc2, 0x27, 0xbe, 0xee, 0x0b, 0x32, 0x3e,
-  0x0b, 0x7b, 0x68, 0x3d, 0x30, 0xf0, 0x9b, 0x3d, 0x9b, 0x1e, 0x63, 0x3e,
-  0xdd, 0x9d, 0x04, 0x3d, 0xe8, 0x98, 0xb3, 0xbd, 0xa0, 0x44, 0xaf, 0xbd,
-  0xad, 0x4a, 0x3b, 0x3e, 0xc6, 0x5e, 0xe1, 0x3d, 0xe1, 0x40, 0x35, 0x3d,
-  0x0e, 0xe3, 0x23, 0x3d, 0x9e, 0xf9, 0x2b, 0xbd, 0x8f, 0xc9, 0x1c, 0xbe,
-  0x5f, 0x1a, 0x8b, 0xbd, 0x9c, 0xdd, 0x8d, 0x3e, 0xaf, 0xa0, 0x39, 0xbe,
-  0x00, 0xbe, 0xe8, 0x3b, 0x41, 0x4c, 0x71, 0x3e, 0x01, 0x80, 0x78, 0xbb,
-  0x76, 0x19, 0x87, 0xbd, 0x18, 0x93, 0x4a, 0x3e, 0xa7, 0x7b, 0xcb, 0xbd,
-  0x65, 0x9b, 0x0a, 0x3d, 0x04, 0xa4, 0x35, 0xbe, 0xc8, 0xce, 0x20, 0x3e,
-  0x86, 0x62, 0x29, 0xbe, 0x8a, 0xcb, 0xd0, 0x3d, 0x44, 0xeb, 0x0f, 0xbd,
-  0xfa, 0xef, 0x8f, 0x3c, 0xad, 0x7b, 0x02, 0xbe, 0x9a, 0x50, 0x0e, 0x3e,
-  0x36, 0xdf, 0x3b, 0xbd, 0x11, 0x5e, 0x3b, 0xbe, 0xea, 0xa8, 0x1d, 0xbe,
-  0x79, 0x07, 0x99, 0xbd, 0x00, 0xfe, 0x22, 0xbc, 0x32, 0x5b, 0x1e, 0x3e,
-  0xb9, 0x41, 0xae, 0x3d, 0x79, 0xce, 0x92, 0xbd, 0x0f, 0x9f, 0x9b, 0x3c,
-  0xdf, 0xc9, 0xea, 0x3d, 0x7a, 0xe8, 0x78, 0xbe, 0x20, 0xf7, 0x0c, 0x3d,
-  0xff, 0xbf, 0x80, 0x3d, 0xc3, 0x1f, 0xa7, 0x3d, 0x81, 0x50, 0x88, 0xbe,
-  0x00, 0x90, 0x4c, 0xbc, 0x96, 0xbc, 0x34, 0x3e, 0x30, 0x3e, 0xc0, 0xbd,
-  0x4c, 0x43, 0x1d, 0x3e, 0x94, 0x8b, 0x16, 0xbc, 0x56, 0x75, 0xf3, 0x3c,
-  0x8f, 0x60, 0x75, 0xbd, 0xc6, 0x8a, 0x16, 0x3c, 0xa4, 0x4b, 0x27, 0x3e,
-  0x4b, 0x7d, 0x28, 0x3d, 0x38, 0xbc, 0x57, 0x3e, 0x58, 0x90, 0x8c, 0x3e,
-  0xf8, 0xc4, 0x09, 0xbe, 0x17, 0x4c, 0xb4, 0xbc, 0xa4, 0xa3, 0xcf, 0xbd,
-  0x6a, 0xd3, 0xac, 0xbc, 0xeb, 0x28, 0x3f, 0xbd, 0x0f, 0x45, 0xf7, 0x3d,
-  0x99, 0xdb, 0x66, 0x3e, 0xad, 0xcd, 0x80, 0xbe, 0x80, 0x3e, 0xcc, 0x3d,
-  0x84, 0xda, 0x59, 0x3e, 0xa9, 0xfe, 0x93, 0xbc, 0xb1, 0xe5, 0x64, 0x3d,
-  0x60, 0x33, 0xa3, 0xbc, 0xd9, 0x02, 0x19, 0xbd, 0x2b, 0x22, 0xf5, 0x3c,
-  0x27, 0x27, 0x77, 0x3b, 0x03, 0x00, 0xd4, 0x3c, 0x40, 0xb9, 0xf5, 0x3d,
-  0x0e, 0xf6, 0x00, 0xbe, 0x4c, 0xf9, 0xe8, 0xba, 0x86, 0x09, 0x99, 0x3e,
-  0x88, 0xb8, 0x19, 0xbe, 0x08, 0xc9, 0x23, 0xbe, 0x47, 0x0e, 0xd3, 0x3c,
-  0x3e, 0x27, 0xde, 0x3c, 0x2d, 0x87, 0x30, 0x3d, 0x36, 0x35, 0x12, 0x3b,
-  0x83, 0xb9, 0xd9, 0xbc, 0x5c, 0x62, 0x3e, 0x3e, 0x98, 0x1d, 0x0e, 0x3e,
-  0xbc, 0xd6, 0x02, 0x3e, 0xf0, 0x5f, 0x50, 0xbe, 0xe9, 0x10, 0x0f, 0xbe,
-  0x73, 0x31, 0x36, 0x3d, 0xa5, 0x8f, 0x03, 0x3e, 0x7e, 0x90, 0x7b, 0xbe,
-  0x6f, 0x81, 0x40, 0x3e, 0x2b, 0x66, 0x0f, 0x3e, 0x93, 0x33, 0xdb, 0xbb,
-  0xee, 0x30, 0x86, 0xbe, 0x11, 0x6f, 0xc2, 0x3d, 0x18, 0xd4, 0xee, 0x3d,
-  0x6e, 0x4e, 0xe2, 0xbd, 0x67, 0x75, 0xc0, 0x3c, 0x29, 0x70, 0x97, 0x3d,
-  0x04, 0x5f, 0x02, 0xbe, 0x37, 0x65, 0x53, 0x3e, 0x8f, 0x27, 0x9d, 0x3e,
-  0x40, 0xf8, 0x20, 0xbe, 0x4d, 0x63, 0x53, 0x3e, 0x9f, 0xa7, 0x7b, 0x3e,
-  0xc1, 0x6b, 0x19, 0xbd, 0x30, 0x05, 0xb5, 0xbd, 0x8a, 0x29, 0x83, 0x3e,
-  0x1d, 0x11, 0x41, 0x3e, 0x91, 0x59, 0xb2, 0x3d, 0x79, 0x48, 0x14, 0x3e,
-  0x01, 0x14, 0x97, 0x3e, 0x36, 0xdf, 0x17, 0x3e, 0x8e, 0x13, 0x12, 0xbe,
-  0x6e, 0x41, 0xb8, 0x3d, 0xed, 0x9f, 0xbe, 0xbd, 0x00, 0x57, 0x7d, 0xbb,
-  0x9e, 0x26, 0x87, 0x3e, 0x8d, 0x56, 0x5d, 0x3e, 0x4c, 0x4b, 0x1b, 0xbe,
-  0x39, 0xd8, 0xd2, 0xbd, 0x95, 0x66, 0x0f, 0x3e, 0xfa, 0x3f, 0xb0, 0xbd,
-  0x94, 0xc5, 0x1c, 0xbd, 0x09, 0x33, 0x9f, 0xbd, 0x36, 0x21, 0x53, 0xbd,
-  0x60, 0xdb, 0x16, 0x3e, 0xc1, 0xc8, 0xa4, 0x3e, 0xb1, 0x41, 0x58, 0x3e,
-  0xa1, 0x35, 0x12, 0xbe, 0xe0, 0x27, 0x6e, 0x3d, 0x9d, 0xcd, 0x13, 0x3e,
-  0x48, 0xa4, 0x6a, 0xbe, 0x7a, 0x69, 0x76, 0xbd, 0x4b, 0x7b, 0x57, 0x3e,
-  0x6e, 0x04, 0x1a, 0x3e, 0x24, 0x7c, 0x8d, 0xbd, 0xc8, 0x07, 0x95, 0xbc,
-  0xbb, 0xb6, 0x98, 0x3e, 0x50, 0x20, 0x6b, 0x3e, 0x78, 0xd5, 0xbe, 0xbd,
-  0x52, 0x4d, 0x75, 0x3e, 0xbe, 0xc4, 0xa9, 0xbe, 0xb0, 0x56, 0x51, 0x3d,
-  0x17, 0x8c, 0xb1, 0xbd, 0xb0, 0x1f, 0x47, 0xbe, 0xaf, 0xe9, 0x53, 0x3c,
-  0xc0, 0xb8, 0x5d, 0x3d, 0x7f, 0x8d, 0x43, 0x3e, 0x79, 0x52, 0x5a, 0x3e,
-  0x10, 0x18, 0x86, 0x3e, 0x87, 0xa1, 0x39, 0x3e, 0x26, 0xf7, 0xe7, 0xbd,
-  0xd4, 0xcf, 0xbe, 0xbd, 0x67, 0x9b, 0x6e, 0x3d, 0x9e, 0x33, 0x78, 0x3d,
-  0xa3, 0xc5, 0xd7, 0x3d, 0x9f, 0xdc, 0xd2, 0x3d, 0x50, 0x59, 0xbf, 0x3d,
-  0x20, 0xd3, 0x29, 0x3d, 0xb0, 0xba, 0x1f, 0xbe, 0x28, 0x91, 0x3d, 0x3e,
-  0x28, 0xea, 0x2c, 0xbe, 0x83, 0xa3, 0x53, 0x3e, 0x36, 0xe6, 0xa5, 0x3d,
-  0x62, 0x0c, 0x85, 0xbd, 0x70, 0x9e, 0x1a, 0x3e, 0xb5, 0x92, 0x79, 0x3e,
-  0x37, 0x75, 0xc0, 0xbd, 0x8e, 0xd5, 0xa7, 0x3c, 0x38, 0xc3, 0xc3, 0xbd,
-  0x09, 0xcd, 0x03, 0x3e, 0xca, 0xeb, 0x8b, 0xbe, 0x76, 0x22, 0x85, 0xbe,
-  0x39, 0x46, 0x84, 0x3e, 0xe0, 0x15, 0xbc, 0x3e, 0x22, 0x6e, 0x8d, 0xbc,
-  0x3c, 0x65, 0x42, 0xbe, 0xca, 0x84, 0x8d, 0x3d, 0x55, 0x2e, 0x3a, 0xbe,
-  0x70, 0x0c, 0xc1, 0x3d, 0x3c, 0x01, 0x4c, 0xbd, 0x44, 0xc7, 0x4d, 0xbd,
-  0x51, 0xe0, 0x89, 0x3e, 0x36, 0xd0, 0xf4, 0x3b, 0x16, 0x61, 0x7b, 0xbe,
-  0xa8, 0x06, 0x1c, 0xbc, 0xf3, 0x56, 0xbc, 0x3d, 0xfe, 0xbd, 0x3b, 0xbe,
-  0xd5, 0xbd, 0x8a, 0xbd, 0xb0, 0x66, 0xf8, 0xbd, 0xe2, 0xd4, 0xeb, 0xbd,
-  0xb4, 0x87, 0x98, 0x3d, 0x20, 0x23, 0x0d, 0xbd, 0x6c, 0x8c, 0x6d, 0x3e,
-  0xf1, 0x18, 0xa3, 0xbd, 0xb9, 0x38, 0xeb, 0xbe, 0x22, 0x55, 0x85, 0x3e,
-  0x3f, 0x25, 0x8d, 0x3d, 0x0c, 0xc6, 0x5e, 0xbe, 0x64, 0x04, 0x99, 0xbd,
-  0xfe, 0x8f, 0x8e, 0x3e, 0xb2, 0xed, 0x35, 0x3d, 0x83, 0x43, 0x20, 0x3e,
-  0x50, 0xb2, 0x13, 0xbe, 0x9f, 0xd6, 0x10, 0x3d, 0xa3, 0x46, 0xf4, 0x3d,
-  0xc6, 0x65, 0x9a, 0x3e, 0x19, 0x9e, 0xfe, 0xbd, 0xa4, 0xf0, 0x81, 0xbe,
-  0x34, 0x0e, 0x7e, 0x3e, 0xf8, 0x35, 0x12, 0x3e, 0xd6, 0xd4, 0xa3, 0x3e,
-  0x34, 0xc4, 0x81, 0x3e, 0x4e, 0xb9, 0x01, 0x3e, 0xdf, 0x99, 0x38, 0x3e,
-  0x1d, 0x5a, 0xc6, 0x3b, 0x01, 0x3f, 0x0e, 0x3d, 0xc5, 0xd3, 0x96, 0x3e,
-  0x68, 0xbe, 0xa2, 0xbd, 0xa7, 0x01, 0x2f, 0xbe, 0xc1, 0x68, 0xaa, 0x3e,
-  0x76, 0x86, 0xc3, 0xbd, 0x70, 0xae, 0x58, 0x3d, 0x88, 0x3c, 0xe3, 0xbd,
-  0xd3, 0x03, 0xd7, 0xbd, 0x4a, 0x10, 0x51, 0x3e, 0x19, 0xe9, 0x90, 0x3e,
-  0x47, 0x66, 0xd6, 0xbd, 0x8d, 0xf2, 0x05, 0x3d, 0xd8, 0x01, 0x9e, 0x3d,
-  0x4f, 0xf9, 0xe3, 0xbd, 0x42, 0x98, 0x6b, 0xbd, 0x08, 0xf5, 0x00, 0xbb,
-  0xc8, 0xe9, 0xbc, 0x3d, 0x16, 0x43, 0x7e, 0xbe, 0xe9, 0x59, 0x25, 0x3e,
-  0xcf, 0xe5, 0x01, 0xbd, 0x04, 0xbc, 0x4d, 0xbe, 0xef, 0xed, 0x33, 0x3e,
-  0xc5, 0xc0, 0xd2, 0x3b, 0x9e, 0x28, 0x59, 0xbc, 0x84, 0x32, 0x17, 0x3e,
-  0x58, 0x59, 0x19, 0xbe, 0xd8, 0x7d, 0x84, 0xbd, 0x84, 0x9c, 0xe0, 0x3c,
-  0xa0, 0x87, 0x75, 0xbe, 0xc3, 0xe6, 0x13, 0x3b, 0xe6, 0x60, 0x5b, 0x3e,
-  0x83, 0x97, 0xf3, 0x3d, 0x27, 0x23, 0x6c, 0xbe, 0xa4, 0x55, 0x18, 0x3e,
-  0x30, 0xc7, 0x1e, 0x3e, 0x87, 0x31, 0x0b, 0xbe, 0x28, 0x9d, 0x8f, 0xbd,
-  0x74, 0x30, 0x50, 0x3e, 0x88, 0x4e, 0x3d, 0xbe, 0x50, 0x5f, 0x0e, 0x3e,
-  0x38, 0x4d, 0x00, 0x3e, 0xd0, 0xb5, 0x0d, 0xbd, 0xd8, 0x75, 0x37, 0xbe,
-  0xeb, 0xfb, 0x11, 0x3e, 0x4e, 0x78, 0xdd, 0x3d, 0x76, 0x23, 0x74, 0xbe,
-  0x8e, 0xf7, 0x0e, 0x3e, 0xf2, 0xb1, 0x09, 0xbd, 0x80, 0x84, 0xa2, 0xbb,
-  0x5c, 0xf4, 0x4c, 0xbe, 0x60, 0x22, 0xf6, 0xbd, 0xa4, 0xe4, 0x44, 0xbe,
-  0x9e, 0x0f, 0xad, 0xbd, 0xba, 0xd8, 0xe4, 0xbd, 0xdc, 0x18, 0x65, 0x3e,
-  0xf7, 0xbb, 0xcf, 0xbd, 0x74, 0x05, 0x62, 0x3e, 0xd0, 0xf7, 0x61, 0x3e,
-  0x8d, 0xd0, 0x97, 0xbd, 0x3d, 0x20, 0x15, 0x3d, 0xdd, 0x48, 0x70, 0xbe,
-  0xec, 0x7b, 0x0d, 0x3e, 0xf5, 0x64, 0x73, 0x3e, 0x66, 0x2b, 0x74, 0xbe,
-  0xcc, 0xbe, 0x7f, 0xbe, 0xc2, 0xf0, 0x5b, 0x3d, 0x2c, 0x63, 0x6e, 0xbe,
-  0x25, 0x24, 0x6d, 0x3e, 0xc0, 0x45, 0x0e, 0xbd, 0xd0, 0x4a, 0x39, 0x3d,
-  0x81, 0x68, 0x6f, 0x3e, 0x70, 0x22, 0x3c, 0xbe, 0x5f, 0xec, 0x42, 0xbe,
-  0xb0, 0x16, 0xc1, 0xbd, 0x90, 0x4a, 0xcf, 0xbd, 0xe0, 0x16, 0x69, 0xbe,
-  0xe8, 0x6e, 0xac, 0x3d, 0x60, 0xe9, 0x7e, 0xbd, 0x89, 0x9c, 0x80, 0xbe,
-  0x10, 0x4b, 0x38, 0xbe, 0x80, 0x94, 0x51, 0x3d, 0x33, 0x62, 0x43, 0x3d,
-  0x5a, 0x05, 0x34, 0x3e, 0x0a, 0x9c, 0x10, 0xbe, 0xfc, 0x1e, 0xf7, 0xbd,
-  0x20, 0x94, 0xb2, 0x3c, 0x68, 0xd0, 0xbe, 0x3d, 0xa3, 0xb6, 0x9a, 0xbb,
-  0x75, 0x8e, 0xf2, 0x3d, 0x74, 0xf1, 0x1f, 0x3e, 0xd4, 0xa0, 0x23, 0xbe,
-  0x41, 0x63, 0x26, 0x3d, 0x9e, 0xed, 0xec, 0xbc, 0x27, 0xdc, 0xb2, 0xbc,
-  0xa4, 0x95, 0x1c, 0x3d, 0x58, 0x11, 0x2b, 0x3e, 0x5a, 0x53, 0x81, 0x3e,
-  0xe0, 0x27, 0x4d, 0x3e, 0x38, 0x4a, 0xe4, 0x3d, 0x16, 0x8a, 0x26, 0x3e,
-  0x90, 0xa6, 0xc6, 0xbd, 0x55, 0x02, 0x5e, 0x3e, 0xab, 0x9c, 0xa9, 0x3d,
-  0x34, 0xbd, 0x26, 0x3d, 0xec, 0x04, 0x0e, 0x3e, 0xaf, 0x60, 0x87, 0x3d,
-  0x1c, 0x9d, 0x47, 0xbd, 0xe4, 0x34, 0x0b, 0x3d, 0xfe, 0x84, 0xa4, 0xbc,
-  0xfb, 0x44, 0x3d, 0x3d, 0x05, 0x09, 0xf9, 0xbd, 0x39, 0xae, 0xb3, 0xbc,
-  0x39, 0x63, 0x07, 0xbd, 0x7b, 0x5d, 0x12, 0xbd, 0xa4, 0xbf, 0x68, 0x3e,
-  0xae, 0x9a, 0xd4, 0x3c, 0x1e, 0xaa, 0x77, 0xbd, 0xc6, 0x36, 0x04, 0xbe,
-  0x29, 0xc4, 0xc3, 0x3d, 0x6e, 0xe9, 0x23, 0x3e, 0x4b, 0xdb, 0x88, 0x3e,
-  0x38, 0x06, 0x54, 0x3e, 0x12, 0xc5, 0xdf, 0xbd, 0x02, 0xca, 0x70, 0x3e,
-  0x4a, 0x35, 0xb4, 0x3d, 0x2d, 0x68, 0x0e, 0xbe, 0xda, 0xcd, 0x76, 0xbc,
-  0x07, 0x1c, 0xc4, 0xbc, 0x2c, 0x70, 0x5a, 0xbe, 0x64, 0x1e, 0xb4, 0xbd,
-  0xad, 0x39, 0xee, 0x3d, 0xf5, 0x73, 0x08, 0x3d, 0xd6, 0xe7, 0x67, 0xbd,
-  0x98, 0xfa, 0x24, 0x3e, 0x57, 0xb7, 0x75, 0x3e, 0x43, 0xae, 0xfb, 0x3d,
-  0x53, 0x00, 0x27, 0xbe, 0x94, 0xf4, 0x0f, 0x3e, 0x4c, 0xfd, 0x1f, 0x3d,
-  0xe6, 0xea, 0x23, 0xbe, 0x58, 0x02, 0x91, 0xbd, 0xd4, 0x15, 0x82, 0xbe,
-  0x79, 0xe3, 0x58, 0xbd, 0x49, 0x86, 0x01, 0xbe, 0x70, 0x38, 0x51, 0xbe,
-  0x44, 0x82, 0x2e, 0x3e, 0x6f, 0xf4, 0x98, 0x3e, 0x2c, 0x25, 0x9e, 0x3e,
-  0xfe, 0x8a, 0x5d, 0x3e, 0xa2, 0xc3, 0xbd, 0xbd, 0x36, 0x16, 0x8b, 0x3d,
-  0x29, 0xc2, 0x95, 0xbd, 0x40, 0x9d, 0x30, 0x3e, 0x68, 0x33, 0x8d, 0x3e,
-  0x20, 0xdf, 0xd4, 0xbc, 0x26, 0xde, 0x57, 0x3d, 0xea, 0xe5, 0xff, 0x3d,
-  0xdb, 0xad, 0xbf, 0xbd, 0x69, 0x2d, 0x04, 0x3e, 0xdf, 0x6c, 0x8d, 0x3e,
-  0x19, 0x79, 0x9d, 0x3e, 0xf3, 0x70, 0x1b, 0x3e, 0xed, 0xfd, 0x37, 0x3e,
-  0xb3, 0x10, 0x9a, 0x3d, 0xd4, 0xc0, 0x32, 0xbe, 0x1e, 0x49, 0xb8, 0x3d,
-  0xb1, 0xa6, 0x74, 0x3e, 0x59, 0xdd, 0x3a, 0xbe, 0xf0, 0x0a, 0xda, 0x3d,
-  0xa3, 0x2f, 0xb7, 0xbd, 0x6f, 0x6e, 0x30, 0xbe, 0x7d, 0x16, 0xf8, 0x3d,
-  0xac, 0x02, 0x57, 0x3e, 0xaf, 0x4f, 0x57, 0x3e, 0xca, 0xcf, 0xfc, 0x3d,
-  0x11, 0xbe, 0xf5, 0xbd, 0x25, 0xc7, 0x6e, 0x3e, 0x4d, 0x35, 0x4c, 0xbe,
-  0x60, 0xb5, 0xd8, 0x3c, 0x25, 0xf4, 0xc6, 0x3d, 0x12, 0x33, 0xf4, 0x3d,
-  0xe7, 0xc0, 0x1c, 0xbe, 0xfa, 0x35, 0xcf, 0x3d, 0x81, 0xf5, 0x25, 0x3e,
-  0xbd, 0x63, 0x28, 0xbe, 0x60, 0xa2, 0x3f, 0x3e, 0x82, 0x4e, 0x5a, 0x3e,
-  0xdd, 0xf3, 0x1a, 0xbe, 0xcb, 0x90, 0x00, 0x3d, 0xe3, 0x2c, 0xa0, 0x3e,
-  0x22, 0x84, 0x27, 0x3e, 0x2b, 0x58, 0x61, 0x3d, 0x1b, 0xba, 0x89, 0x3e,
-  0x6c, 0xef, 0xad, 0xbd, 0x46, 0xad, 0x81, 0xbe, 0x15, 0x68, 0xfa, 0xbd,
-  0xdb, 0xb5, 0xae, 0xbd, 0xc0, 0xd4, 0x3e, 0x3d, 0xa2, 0x8c, 0x10, 0x3e,
-  0x48, 0x76, 0x4f, 0x3e, 0x45, 0x83, 0x56, 0xbd, 0x34, 0xaf, 0xcc, 0x3a,
-  0xbc, 0x47, 0x15, 0x3e, 0x45, 0x7e, 0x14, 0xbe, 0x34, 0x47, 0x63, 0x3e,
-  0xf6, 0x58, 0x01, 0xbe, 0x45, 0xd7, 0x13, 0x3c, 0xf4, 0xed, 0x3a, 0xbd,
-  0xa0, 0x0e, 0x3a, 0xbd, 0x20, 0x10, 0xd1, 0xbd, 0xaf, 0x3a, 0x0a, 0xbc,
-  0xaa, 0xc3, 0xdb, 0xbd, 0xf2, 0xc0, 0xde, 0x3d, 0x8f, 0x22, 0x93, 0xbe,
-  0x11, 0xc4, 0xe9, 0x3d, 0x1e, 0xba, 0x29, 0x3e, 0xa3, 0x8e, 0xf4, 0xbd,
-  0x2b, 0xc9, 0x1b, 0xbe, 0xd0, 0xe4, 0x20, 0xbd, 0x48, 0x13, 0x36, 0xbd,
-  0x94, 0xfe, 0xdc, 0xbd, 0xca, 0x98, 0x2e, 0xbe, 0x28, 0xf6, 0x6f, 0xbe,
-  0x49, 0x1a, 0x1f, 0x3e, 0xf0, 0xd5, 0x67, 0x3e, 0xc3, 0x3a, 0x4f, 0x3e,
-  0xc0, 0x77, 0x4e, 0x3e, 0xc9, 0xac, 0x45, 0xbe, 0x5c, 0x47, 0x29, 0xbe,
-  0x1b, 0x05, 0x59, 0x3d, 0xd1, 0xac, 0xa0, 0xbd, 0xd9, 0x4f, 0xb8, 0x3c,
-  0x60, 0x04, 0x28, 0xbe, 0xdd, 0xc1, 0xd3, 0x3d, 0x8a, 0x8d, 0x09, 0x3e,
-  0x0d, 0x68, 0x12, 0x3b, 0xd4, 0x44, 0x8f, 0xbd, 0xc6, 0x9a, 0x90, 0xbd,
-  0xc5, 0x0d, 0x22, 0x3e, 0x40, 0x30, 0x6b, 0x3d, 0xd9, 0x5e, 0x3c, 0x3e,
-  0x68, 0xd0, 0x15, 0xbe, 0xb8, 0x07, 0xf2, 0x3d, 0x93, 0x6c, 0x14, 0x3e,
-  0xcf, 0xa8, 0x74, 0xbd, 0x6b, 0x78, 0xd0, 0xbd, 0xa1, 0x58, 0x65, 0x3e,
-  0xce, 0x3d, 0x72, 0x3e, 0x7d, 0x63, 0xa3, 0x3c, 0x74, 0x00, 0x71, 0x3e,
-  0x2a, 0x8d, 0x49, 0xbe, 0xe8, 0x96, 0xf6, 0xbd, 0x55, 0x37, 0xd6, 0xbc,
-  0x79, 0x18, 0x29, 0x3e, 0x66, 0x0f, 0xee, 0x3d, 0x24, 0x49, 0x90, 0xbd,
-  0x51, 0x00, 0xb7, 0xbd, 0x35, 0xbb, 0x19, 0x3c, 0xad, 0x8b, 0x31, 0x3d,
-  0x9b, 0x7f, 0x0d, 0x3e, 0xfe, 0x04, 0xad, 0x3b, 0x00, 0xe1, 0x0c, 0x3d,
-  0x5d, 0xe9, 0x39, 0xbe, 0x36, 0x5b, 0x1d, 0x3e, 0x67, 0x15, 0xa9, 0x3d,
-  0xe7, 0x6e, 0x4d, 0xbd, 0x00, 0x7a, 0x5f, 0xbd, 0x7a, 0x0e, 0x5d, 0x3e,
-  0x9c, 0x66, 0x63, 0x3e, 0xb7, 0xad, 0xae, 0xbd, 0x09, 0x76, 0x86, 0x3d,
-  0xb0, 0x20, 0x6f, 0xbe, 0x90, 0xe4, 0x54, 0xbd, 0x8e, 0x57, 0x7d, 0xbe,
-  0x9d, 0xf0, 0x22, 0xbe, 0x50, 0xc7, 0x1c, 0x3d, 0x68, 0x33, 0x60, 0xbd,
-  0x30, 0x55, 0x13, 0xbd, 0x8a, 0x25, 0xbf, 0xbd, 0x39, 0x91, 0x41, 0xbe,
-  0x63, 0x35, 0x78, 0xbe, 0xfb, 0xcc, 0x88, 0x3c, 0xcc, 0x96, 0x7a, 0xbe,
-  0x96, 0x9f, 0x97, 0x3e, 0x4b, 0x5e, 0xf9, 0x3d, 0x0a, 0x85, 0xcb, 0x3d,
-  0xb6, 0x2a, 0x83, 0xbc, 0x79, 0x4b, 0x9e, 0x3d, 0xd7, 0xc3, 0xcc, 0xbd,
-  0x1f, 0xa8, 0x99, 0x3d, 0xfc, 0x33, 0x97, 0xbc, 0xab, 0xed, 0xe4, 0x3d,
-  0x48, 0xd8, 0xb3, 0x3d, 0x28, 0x4b, 0x81, 0x3e, 0x40, 0x31, 0xc7, 0xbc,
-  0x42, 0x07, 0x04, 0xbe, 0x00, 0x1f, 0x5f, 0x3b, 0x81, 0xd0, 0x4b, 0xbe,
-  0x0d, 0xde, 0x05, 0xbe, 0x43, 0x37, 0xa1, 0x3e, 0x18, 0x70, 0x7b, 0x3e,
-  0x0e, 0x86, 0x2d, 0x3d, 0xf9, 0x2a, 0x1a, 0x3e, 0x08, 0x25, 0x20, 0x3d,
-  0xd3, 0xfe, 0x81, 0x3e, 0x58, 0x1c, 0xfb, 0x3d, 0x40, 0x5b, 0x3f, 0x3c,
-  0xbc, 0x6d, 0x3d, 0x3e, 0x44, 0xe4, 0x01, 0xbd, 0x1b, 0x99, 0x7e, 0x3e,
-  0x6c, 0x39, 0x3b, 0x3e, 0x2e, 0xe7, 0x83, 0xbe, 0x42, 0x08, 0x59, 0x3e,
-  0xd8, 0x25, 0xf7, 0x3d, 0x22, 0x18, 0xc0, 0x3d, 0x66, 0x4a, 0x28, 0x3e,
-  0xc0, 0x3b, 0xf0, 0x3d, 0x27, 0x91, 0x04, 0x3e, 0x7f, 0xf7, 0x9d, 0x3e,
-  0x18, 0x95, 0x4e, 0x3e, 0x64, 0xd8, 0x33, 0x3e, 0xc9, 0xbd, 0x43, 0x3e,
-  0x40, 0xde, 0x1f, 0xbe, 0x53, 0xcc, 0x8e, 0x3e, 0x08, 0x91, 0x3a, 0x3c,
-  0xb4, 0x55, 0x3a, 0xbe, 0x2c, 0x83, 0x2b, 0xbe, 0xaf, 0x37, 0x76, 0x3c,
-  0x84, 0xe1, 0x0d, 0xbe, 0x7e, 0xd4, 0x57, 0xbe, 0x23, 0x78, 0x16, 0xbe,
-  0x4c, 0xe1, 0xd5, 0x3c, 0x00, 0x74, 0xfe, 0xba, 0xd2, 0xcd, 0xb5, 0x3e,
-  0xf0, 0x4a, 0xdb, 0xbc, 0x06, 0x42, 0x74, 0x3e, 0x50, 0xc1, 0xe6, 0x3d,
-  0x2c, 0x03, 0xc2, 0x3d, 0x41, 0xe7, 0x37, 0x3e, 0xab, 0xb4, 0xcb, 0x3d,
-  0x89, 0x10, 0x58, 0x3d, 0x4e, 0x10, 0x6d, 0x3e, 0xa9, 0x66, 0xfe, 0x3d,
-  0x71, 0xf5, 0x20, 0x3e, 0x07, 0xc2, 0x3f, 0xbd, 0xb9, 0x51, 0x0b, 0xbd,
-  0xcc, 0x53, 0x53, 0xbe, 0x25, 0x65, 0xbd, 0x3c, 0x3e, 0x99, 0x4c, 0xbe,
-  0x96, 0x8b, 0xac, 0x3e, 0xe0, 0x65, 0x9e, 0x3e, 0xc4, 0xd3, 0x19, 0x3e,
-  0xca, 0xa4, 0xa3, 0xbd, 0x64, 0x46, 0x2b, 0x3e, 0xfe, 0xb6, 0x59, 0xbe,
-  0x35, 0xbd, 0xfc, 0x3d, 0xc0, 0x8d, 0x1b, 0xbc, 0xb3, 0x24, 0x1c, 0xbe,
-  0x36, 0xe2, 0xe1, 0xbd, 0x13, 0xee, 0x39, 0xbe, 0x98, 0x8a, 0xd9, 0x3d,
-  0xe5, 0x4f, 0x74, 0x3e, 0x5e, 0xf1, 0x7a, 0xbe, 0x04, 0x05, 0x94, 0x3e,
-  0x7c, 0x18, 0x88, 0xbe, 0x3f, 0x0b, 0x23, 0x3e, 0x13, 0xbd, 0x9e, 0x3e,
-  0xcb, 0xbe, 0x99, 0x3d, 0xc1, 0x6a, 0x9e, 0xbd, 0x4f, 0xed, 0xdc, 0xbb,
-  0x58, 0x05, 0xb3, 0x3d, 0xde, 0x82, 0x2b, 0xbe, 0xfe, 0x0c, 0x3b, 0x3e,
-  0x0f, 0x9f, 0xa7, 0x3d, 0x15, 0x85, 0x13, 0xbd, 0x9c, 0xfc, 0x6b, 0xbd,
-  0x09, 0x74, 0x9c, 0x3e, 0x20, 0xa7, 0x62, 0x3e, 0xf6, 0xf1, 0x2d, 0x3e,
-  0x27, 0xf4, 0x65, 0x3e, 0xb1, 0x77, 0xe3, 0x3d, 0x45, 0xc6, 0x2e, 0x3e,
-  0x44, 0x1d, 0x16, 0x3d, 0xca, 0x91, 0x01, 0xbd, 0x90, 0x40, 0x6d, 0xbe,
-  0xcd, 0xe5, 0xca, 0x3d, 0x13, 0xaf, 0x10, 0x3e, 0x4e, 0x25, 0x87, 0x3d,
-  0x27, 0x4a, 0x7c, 0xbe, 0x68, 0x69, 0xe6, 0x3d, 0xcd, 0x31, 0xc6, 0xbd,
-  0x7d, 0x71, 0x64, 0x3c, 0x1f, 0xc6, 0x2c, 0xbd, 0xea, 0x76, 0x5e, 0x3e,
-  0x09, 0x8d, 0x98, 0xbe, 0x44, 0x9b, 0x9c, 0x3d, 0xc0, 0x7c, 0x1b, 0xbc,
-  0xac, 0x7a, 0xae, 0xbd, 0xbc, 0x0d, 0x82, 0x3e, 0x23, 0xee, 0xdc, 0x3d,
-  0x20, 0xa3, 0x7c, 0x3e, 0x28, 0xf0, 0x14, 0xbc, 0x39, 0xa0, 0x7c, 0x3e,
-  0x87, 0x01, 0x92, 0xbd, 0x46, 0x1d, 0xc5, 0xbd, 0x29, 0xa3, 0x94, 0x3d,
-  0x2c, 0x38, 0x97, 0x3d, 0x0b, 0x54, 0x54, 0x3e, 0xd2, 0xaa, 0x90, 0x3e,
-  0x6a, 0x74, 0x27, 0x3e, 0x00, 0x11, 0x48, 0x3d, 0x42, 0xd7, 0x56, 0x3e,
-  0x51, 0x34, 0xd9, 0xbd, 0x93, 0xec, 0x12, 0x3e, 0xd5, 0xd1, 0x89, 0x3d,
-  0x80, 0x96, 0x2f, 0x3d, 0x57, 0x52, 0x60, 0xbd, 0x64, 0x9a, 0x14, 0xbe,
-  0x0c, 0xcc, 0x12, 0xbe, 0x0c, 0x10, 0x54, 0x3d, 0x30, 0xdf, 0x35, 0x3d,
-  0x5d, 0xe0, 0x64, 0xbd, 0x26, 0x78, 0x15, 0xbe, 0xf0, 0xe7, 0x1d, 0xbe,
-  0x9c, 0x82, 0x20, 0x3e, 0x0d, 0x39, 0x97, 0x3e, 0x61, 0xfa, 0xa5, 0x3e,
-  0xa6, 0x6d, 0x92, 0x3e, 0xf1, 0xdf, 0x75, 0xbd, 0x23, 0xc5, 0x66, 0x3d,
-  0xa6, 0x0d, 0xeb, 0xbd, 0x92, 0xe9, 0x2e, 0xbe, 0x2f, 0x63, 0x3d, 0xbe,
-  0xf2, 0x4d, 0x4d, 0xbe, 0x74, 0xf4, 0x3c, 0x3e, 0x3c, 0x96, 0x15, 0xbe,
-  0x00, 0x0f, 0xc0, 0x3d, 0xd6, 0x19, 0x25, 0xbe, 0x7a, 0x96, 0x26, 0xbe,
-  0xae, 0xda, 0xa0, 0x3d, 0x06, 0x1b, 0x80, 0x3e, 0xb8, 0x81, 0x74, 0xbe,
-  0x07, 0xfb, 0xb1, 0xbd, 0x9c, 0x05, 0x8e, 0x3e, 0x70, 0x0a, 0x60, 0x3e,
-  0x43, 0xe4, 0x2e, 0x3e, 0x2f, 0x05, 0x82, 0x3e, 0x36, 0x04, 0xb5, 0xbd,
-  0x6f, 0xd5, 0xcd, 0xbb, 0x70, 0x68, 0x77, 0x3e, 0xc1, 0x94, 0x27, 0xbd,
-  0xd4, 0x7c, 0x7c, 0x3e, 0xf2, 0xe8, 0x32, 0xbe, 0xe0, 0xba, 0x8c, 0x3d,
-  0x1c, 0xea, 0x72, 0x3e, 0x5d, 0x97, 0x64, 0xbd, 0x16, 0x14, 0x9f, 0x3e,
-  0x65, 0x91, 0x4f, 0x3e, 0xdd, 0x5a, 0x3c, 0xbe, 0x05, 0xbf, 0x20, 0x3e,
-  0x50, 0xf3, 0x01, 0x3d, 0x3f, 0x38, 0x04, 0xbf, 0xea, 0x40, 0x37, 0x3e,
-  0x6a, 0x97, 0x80, 0x3c, 0xec, 0xe6, 0x71, 0x3e, 0xa2, 0x3e, 0x32, 0xbd,
-  0x97, 0xd2, 0xa9, 0x3e, 0xb2, 0xe2, 0xb1, 0x3e, 0x34, 0xec, 0xb0, 0x3e,
-  0x39, 0x22, 0x9b, 0xbe, 0x3d, 0xa8, 0xf5, 0xbd, 0xd3, 0x78, 0x03, 0xbe,
-  0xf0, 0x2c, 0x89, 0xbd, 0x80, 0x82, 0xd0, 0xbc, 0xc0, 0x3c, 0xa2, 0xbd,
-  0x00, 0xed, 0xe7, 0xbb, 0x34, 0x54, 0x49, 0xbe, 0xcc, 0x79, 0x18, 0x3e,
-  0xb4, 0x76, 0x7b, 0xbe, 0xd8, 0xbf, 0x6e, 0xbe, 0x00, 0x99, 0x20, 0xbe,
-  0x58, 0x3c, 0x31, 0x3e, 0x2c, 0x63, 0x6c, 0x3e, 0x84, 0xda, 0x72, 0xbe,
-  0xb0, 0x0e, 0x71, 0xbe, 0x40, 0xd8, 0x51, 0xbc, 0xd0, 0x60, 0xda, 0x3d,
-  0xfc, 0xff, 0x2b, 0x3e, 0x80, 0xd8, 0x82, 0xbc, 0x10, 0x72, 0xe1, 0xbd,
-  0x40, 0xeb, 0xd9, 0xbc, 0xf4, 0xb3, 0x37, 0xbe, 0x54, 0xbb, 0x17, 0x3e,
-  0x88, 0x62, 0x90, 0xbd, 0x00, 0x21, 0x04, 0xbc, 0x60, 0xdc, 0x51, 0xbd,
-  0xa8, 0xa5, 0xa6, 0x3d, 0x30, 0xdd, 0x68, 0x3e, 0xf8, 0xf2, 0xba, 0xbd,
-  0xa8, 0x5b, 0x54, 0xbe, 0xc0, 0xd2, 0xd8, 0xbc, 0xc0, 0xb8, 0x7e, 0x3d,
-  0xe0, 0xe6, 0xd2, 0xbd, 0x60, 0x25, 0x2e, 0xbe, 0x08, 0xa4, 0x8b, 0x3d,
-  0x40, 0x30, 0xbf, 0xbd, 0x28, 0xd4, 0xc1, 0x3d, 0x40, 0x1f, 0x6a, 0xbd,
-  0x70, 0x4a, 0x64, 0xbd, 0xf0, 0xdd, 0x02, 0xbe, 0xe8, 0x66, 0x09, 0xbe,
-  0x68, 0x25, 0xd2, 0xbd, 0xf4, 0xc6, 0x28, 0xbe, 0x10, 0x0f, 0x27, 0x3d,
-  0x50, 0xaa, 0x97, 0xbd, 0x70, 0x70, 0x39, 0xbe, 0xac, 0x5c, 0x56, 0xbe,
-  0x20, 0xe9, 0x49, 0x3d, 0xb8, 0xe8, 0xe6, 0x3d, 0x10, 0x5d, 0x31, 0xbd,
-  0x54, 0x67, 0x51, 0xbe, 0x28, 0x37, 0x82, 0x3d, 0x68, 0x1b, 0x52, 0x3e,
-  0x0c, 0x7b, 0x6d, 0xbe, 0x8c, 0x27, 0x22, 0xbe, 0x00, 0xc1, 0xd5, 0x3b,
-  0xe0, 0x20, 0x18, 0xbd, 0xe0, 0x01, 0xfb, 0xbd, 0x00, 0x91, 0xb5, 0xbd,
-  0x00, 0xa5, 0x4e, 0x3e, 0x98, 0x59, 0x9e, 0x3d, 0xd8, 0xd9, 0xc3, 0xbd,
-  0xdc, 0xe4, 0x36, 0xbe, 0xf0, 0xf7, 0x2c, 0x3e, 0x20, 0x9a, 0xe6, 0x3d,
-  0x94, 0xa6, 0x42, 0x3e, 0x77, 0xca, 0x0a, 0xbe, 0x7c, 0x2e, 0xb8, 0x3c,
-  0x60, 0x0a, 0x40, 0xbd, 0xf5, 0x27, 0x5c, 0x3e, 0x8f, 0x37, 0x8a, 0x3e,
-  0xfa, 0x50, 0xc6, 0x3d, 0x71, 0x18, 0x4f, 0xbe, 0x97, 0x8d, 0xe3, 0x3d,
-  0xac, 0x64, 0xe5, 0x3b, 0x94, 0xef, 0xde, 0xbd, 0xee, 0x11, 0x42, 0xbe,
-  0x47, 0x86, 0x73, 0x3d, 0xd4, 0xd7, 0x60, 0xbe, 0x77, 0x50, 0xd0, 0x3d,
-  0xbf, 0xf9, 0x9b, 0x3e, 0xd4, 0x73, 0xbc, 0xbd, 0xd4, 0xd9, 0x1f, 0xbe,
-  0xf8, 0x35, 0x8a, 0xbd, 0xa1, 0xf2, 0x17, 0x3e, 0x6e, 0x18, 0xf6, 0x3c,
-  0x1e, 0x34, 0x70, 0x3d, 0xc8, 0x13, 0xd7, 0x3c, 0x74, 0x23, 0x44, 0x3e,
-  0x2b, 0x37, 0xa3, 0x3e, 0x6d, 0xad, 0xab, 0x3c, 0x50, 0xbb, 0x92, 0x3e,
-  0xf4, 0x4d, 0x79, 0xbe, 0x5a, 0xdd, 0xad, 0x3e, 0x93, 0x8b, 0x93, 0x3c,
-  0x61, 0xf6, 0x70, 0xbd, 0x59, 0xe3, 0xb5, 0x3e, 0xd3, 0xf6, 0x4b, 0xbe,
-  0x60, 0xe8, 0x9d, 0xbc, 0x28, 0xff, 0xe7, 0x3d, 0xae, 0xbc, 0x0c, 0xbe,
-  0x04, 0x5d, 0x21, 0x3e, 0x0f, 0x30, 0x87, 0x3d, 0x14, 0xe1, 0x75, 0x3e,
-  0x8a, 0x3c, 0x8b, 0x3e, 0xc3, 0x8a, 0x1b, 0xbe, 0x4d, 0xc5, 0x74, 0xbd,
-  0x73, 0xff, 0xb4, 0x3c, 0xdc, 0xae, 0x7d, 0x3d, 0x47, 0x78, 0xf4, 0x3d,
-  0x12, 0x3e, 0x69, 0x3e, 0xac, 0x92, 0x70, 0xbe, 0xcf, 0x1a, 0x4b, 0x3e,
-  0xb6, 0x50, 0x71, 0x3c, 0xd3, 0xa3, 0x3d, 0x3e, 0xa4, 0x24, 0xcd, 0x3d,
-  0xfd, 0x2d, 0x30, 0xbd, 0x3f, 0x88, 0x0a, 0xbd, 0x08, 0x6d, 0x9b, 0x3d,
-  0x7d, 0x08, 0x5a, 0x3e, 0x34, 0x00, 0x9b, 0x3e, 0x4c, 0x10, 0x23, 0x3e,
-  0xd8, 0xc0, 0xb1, 0x3d, 0xa8, 0x2b, 0x79, 0x3e, 0xe7, 0x43, 0x23, 0xbd,
-  0x2b, 0x85, 0x50, 0xbe, 0x94, 0x85, 0x6c, 0x3e, 0x76, 0x75, 0xcb, 0x3e,
-  0x42, 0xfd, 0x65, 0x3e, 0x8a, 0x87, 0x8b, 0x3e, 0x79, 0x1a, 0x65, 0xbe,
-  0xc5, 0xfe, 0x8c, 0xbd, 0xa4, 0x78, 0x3f, 0x3e, 0xa9, 0x55, 0x3c, 0x3e,
-  0x15, 0xeb, 0x71, 0xbe, 0xce, 0xad, 0x53, 0x3d, 0xd8, 0x3d, 0x17, 0x3e,
-  0x35, 0x3b, 0x0d, 0x3d, 0x04, 0x35, 0x20, 0xbd, 0xdf, 0x11, 0xb5, 0x3d,
-  0xf0, 0x97, 0x5e, 0xbe, 0xbd, 0x33, 0xdb, 0xbc, 0x18, 0xeb, 0x38, 0x3e,
-  0x59, 0xd4, 0x82, 0xbe, 0x2a, 0x22, 0x09, 0xbd, 0x91, 0x26, 0x32, 0x3d,
-  0x78, 0x5f, 0x5a, 0x3e, 0xc3, 0xc8, 0x2a, 0x3e, 0x67, 0xe1, 0x2a, 0x3e,
-  0xb0, 0x66, 0x23, 0xbd, 0x51, 0xe4, 0xe5, 0xbd, 0xc8, 0x92, 0x62, 0x3e,
-  0xda, 0x03, 0x89, 0xbe, 0x15, 0x6e, 0xf0, 0x3d, 0x9e, 0xa2, 0x49, 0x3e,
-  0xf6, 0xc5, 0x27, 0xbe, 0xc0, 0xc1, 0x08, 0x3d, 0x36, 0x65, 0x78, 0xbe,
-  0xc9, 0xda, 0x79, 0xbe, 0xb4, 0x18, 0x50, 0x3e, 0xd2, 0x07, 0x94, 0x3d,
-  0x08, 0xaf, 0x17, 0xbe, 0xdc, 0x85, 0xb4, 0xbc, 0xc0, 0xf5, 0xbd, 0x3c,
-  0xa9, 0xe6, 0x2f, 0xbe, 0x1d, 0x27, 0xf5, 0xbb, 0x6d, 0x1d, 0x2a, 0x3e,
-  0x99, 0x8a, 0xc2, 0x3d, 0x63, 0x98, 0x56, 0xbe, 0x6b, 0xa2, 0x16, 0xbe,
-  0xb8, 0x2f, 0xef, 0xbd, 0x3a, 0x55, 0x2a, 0xbe, 0x9b, 0xa6, 0x57, 0xbe,
-  0xe8, 0x0e, 0x4b, 0xbe, 0x51, 0x03, 0x62, 0x3e, 0xe0, 0x98, 0x96, 0xbc,
-  0x18, 0x60, 0x3e, 0x3e, 0x91, 0x55, 0xe0, 0xbd, 0x1c, 0x96, 0x23, 0xbe,
-  0x94, 0x76, 0x39, 0xbc, 0x36, 0x74, 0x96, 0x3d, 0x13, 0x03, 0xb5, 0xbc,
-  0x80, 0xa2, 0xf7, 0x3c, 0xf3, 0x9a, 0x20, 0x3d, 0xad, 0x7e, 0x6b, 0xbe,
-  0x75, 0xe1, 0x19, 0x3e, 0x40, 0x62, 0x97, 0xbc, 0x70, 0x7c, 0x10, 0x3d,
-  0x5f, 0xcd, 0xa8, 0xbd, 0x33, 0x56, 0x7d, 0x3c, 0x85, 0x5e, 0xc0, 0xba,
-  0xfd, 0xbf, 0x6a, 0xbe, 0x5c, 0x21, 0x6c, 0xbe, 0x43, 0xd6, 0xe2, 0x3d,
-  0x2f, 0x82, 0x0e, 0xbe, 0x33, 0x18, 0xc1, 0x3d, 0x48, 0x2b, 0x4b, 0x3e,
-  0xdc, 0x0c, 0x95, 0x3d, 0x75, 0x41, 0x31, 0xbc, 0x4b, 0x3f, 0x6f, 0x3e,
-  0xad, 0xd1, 0xde, 0x3d, 0xd5, 0xf2, 0xeb, 0xbd, 0xc9, 0x6b, 0x2d, 0x3e,
-  0x17, 0x5e, 0x21, 0xbd, 0xa7, 0xa9, 0x71, 0xbd, 0x75, 0x1e, 0xdb, 0x3b,
-  0xb4, 0xa4, 0x16, 0x3e, 0x24, 0x1a, 0xcf, 0xbd, 0xb2, 0x26, 0x49, 0x3d,
-  0x25, 0x8f, 0x4c, 0xbe, 0x14, 0x6b, 0x69, 0xbe, 0xb9, 0x5e, 0x77, 0x3e,
-  0x9a, 0x2b, 0x8d, 0xbe, 0xad, 0x63, 0xc4, 0x3d, 0x82, 0x9b, 0x12, 0xbd,
-  0x0c, 0xf5, 0x16, 0x3e, 0xc0, 0x2b, 0x98, 0x3e, 0x34, 0x16, 0x68, 0x3c,
-  0xe7, 0x26, 0x17, 0x3d, 0x57, 0x26, 0x80, 0x3e, 0xe0, 0x8a, 0xe0, 0x3d,
-  0x4b, 0x90, 0x00, 0x3d, 0xa2, 0x08, 0x18, 0x3e, 0xa7, 0x3f, 0x62, 0x3d,
-  0x34, 0xd7, 0x68, 0x3d, 0x28, 0x4e, 0x0b, 0x3e, 0xf7, 0xf6, 0x6f, 0xbd,
-  0x40, 0xbf, 0xdb, 0xbd, 0x84, 0x00, 0x6a, 0x3e, 0xf6, 0x0c, 0xc6, 0xbd,
-  0x2c, 0x15, 0xf1, 0xbd, 0xcb, 0x41, 0xaa, 0x3e, 0x75, 0x09, 0x84, 0x3e,
-  0x4d, 0xfd, 0x11, 0xbe, 0xcd, 0x95, 0x0c, 0xbe, 0x46, 0xa1, 0x68, 0xbe,
-  0xaf, 0x12, 0x49, 0xbe, 0x32, 0xf4, 0x96, 0x3c, 0x1e, 0xce, 0xbf, 0xbc,
-  0xb8, 0x2c, 0x12, 0xbe, 0x9c, 0xa2, 0xb0, 0xbd, 0xd3, 0x48, 0xc6, 0x3c,
-  0xd3, 0x4d, 0x07, 0xbd, 0x99, 0x36, 0xa7, 0x3d, 0xd9, 0xbd, 0x59, 0xbd,
-  0x68, 0x8b, 0x7e, 0x3d, 0xa0, 0x2c, 0x50, 0xbd, 0xc8, 0x09, 0x8e, 0x3e,
-  0xf5, 0x12, 0x77, 0x3e, 0x10, 0xad, 0xd8, 0x3d, 0x10, 0x75, 0xab, 0xbd,
-  0xc4, 0x2e, 0x90, 0xbe, 0xfd, 0xd8, 0x94, 0xbd, 0xf7, 0x88, 0x85, 0xbe,
-  0x4b, 0x9d, 0x22, 0xbe, 0x02, 0x93, 0x85, 0x3d, 0xeb, 0x6a, 0xc1, 0x3d,
-  0xbe, 0xc9, 0x8b, 0x3e, 0x5b, 0xbf, 0x0c, 0xbe, 0x8a, 0x6a, 0x49, 0xbe,
-  0xe0, 0xf3, 0xd5, 0x3d, 0x6f, 0x82, 0x41, 0xbe, 0xc5, 0xeb, 0x1a, 0x3e,
-  0xe7, 0x48, 0x84, 0xbc, 0x71, 0x25, 0xe4, 0x3d, 0x59, 0x36, 0x81, 0xbe,
-  0x2f, 0x7b, 0xe6, 0x3d, 0x8a, 0x13, 0x16, 0x3e, 0x28, 0x69, 0xde, 0xbd,
-  0xca, 0xa7, 0x5d, 0xbe, 0xc0, 0x2b, 0xb8, 0x3c, 0x2e, 0x0d, 0x86, 0x3d,
-  0x75, 0x5c, 0x94, 0x3d, 0x80, 0x04, 0x0f, 0x3d, 0x88, 0x1e, 0x49, 0xbe,
-  0x4a, 0x3f, 0xb0, 0x3d, 0x46, 0x89, 0x48, 0x3e, 0xf6, 0xb9, 0x2d, 0xbe,
-  0x8f, 0x25, 0x85, 0xbe, 0xc9, 0x2a, 0xa4, 0xbd, 0xa1, 0x90, 0x0c, 0xbe,
-  0xe9, 0xdc, 0x08, 0xbe, 0xf7, 0x7b, 0x4b, 0xbe, 0xe9, 0x0d, 0xd8, 0x3d,
-  0x54, 0x54, 0x18, 0x3e, 0x11, 0x8e, 0xb7, 0xbd, 0x0a, 0x9f, 0x73, 0x3e,
-  0x55, 0x7d, 0xd2, 0x3c, 0xf8, 0xee, 0x81, 0x3e, 0x0d, 0x60, 0x6a, 0xbe,
-  0xed, 0xd6, 0x9a, 0x3c, 0x40, 0x16, 0x68, 0x3c, 0x1a, 0xc8, 0x61, 0x3d,
-  0x4a, 0x6f, 0x94, 0xbc, 0x62, 0xe6, 0x06, 0x3e, 0x2f, 0x17, 0x18, 0xbe,
-  0x3a, 0x1a, 0x03, 0x3b, 0x1e, 0x57, 0x2c, 0xbe, 0xcf, 0xc3, 0x5b, 0xbe,
-  0x94, 0x0d, 0x3d, 0x3d, 0x67, 0x5a, 0x98, 0x3e, 0x4f, 0xa2, 0xa0, 0xbd,
-  0x91, 0xb3, 0xca, 0x3b, 0x80, 0x93, 0xe6, 0x3c, 0xbd, 0xdf, 0x90, 0x3e,
-  0x94, 0x45, 0x43, 0x3e, 0xed, 0x09, 0x63, 0xbe, 0x57, 0x05, 0x4f, 0x3e,
-  0xa2, 0x6d, 0x43, 0x3c, 0x0b, 0x6c, 0x87, 0xbe, 0x58, 0x1b, 0xa6, 0x3d,
-  0x63, 0xbd, 0x43, 0xbe, 0xe5, 0xda, 0x55, 0x3e, 0x7a, 0x07, 0xb8, 0x3d,
-  0xcc, 0xb2, 0x01, 0xbe, 0x54, 0xca, 0x0a, 0xbe, 0xb8, 0xe2, 0x56, 0xbe,
-  0xaf, 0x29, 0x58, 0x3e, 0x90, 0x30, 0x7f, 0x3e, 0x11, 0x44, 0x47, 0x3e,
-  0x93, 0x40, 0x40, 0x3e, 0x80, 0xb9, 0x05, 0x3e, 0x9a, 0x3b, 0x5a, 0xbc,
-  0x73, 0x64, 0x84, 0x3e, 0x38, 0xec, 0x52, 0xbe, 0x10, 0x0c, 0x69, 0x3e,
-  0x8c, 0xad, 0x1b, 0x3d, 0x32, 0xdb, 0x1e, 0xbe, 0xa1, 0xd4, 0x29, 0x3e,
-  0x9b, 0x28, 0xf8, 0xbd, 0x29, 0x21, 0x5f, 0x3e, 0x33, 0x46, 0x2f, 0xbd,
-  0x72, 0xaf, 0xbd, 0xbd, 0x4f, 0xb1, 0x84, 0xbe, 0x38, 0x47, 0x87, 0xbd,
-  0x9e, 0x72, 0xa1, 0x3c, 0xef, 0xcd, 0x04, 0x3d, 0x86, 0x1c, 0x6d, 0xbd,
-  0x50, 0xda, 0x48, 0xbe, 0x9a, 0x63, 0x13, 0x3e, 0x5b, 0x67, 0xa4, 0x3d,
-  0x11, 0x2e, 0xeb, 0x3d, 0xad, 0x17, 0xed, 0x3d, 0x3d, 0x0b, 0x34, 0xbe,
-  0x4a, 0xa7, 0x47, 0x3e, 0xb1, 0xdc, 0xdd, 0x3c, 0xe2, 0x86, 0x7a, 0xbd,
-  0xa8, 0x52, 0x11, 0x3e, 0xa0, 0x51, 0x26, 0x3e, 0xeb, 0x80, 0x3e, 0x3e,
-  0x3d, 0x1d, 0x47, 0xbe, 0xf7, 0x44, 0x5f, 0x3e, 0x39, 0x37, 0x79, 0x3b,
-  0x07, 0xfd, 0x7c, 0x3e, 0xe8, 0x8a, 0x8b, 0xbe, 0xd0, 0x25, 0x20, 0x3e,
-  0x89, 0x63, 0xf5, 0x3d, 0x4e, 0xe3, 0x57, 0x3d, 0x05, 0x75, 0x26, 0x3e,
-  0x0f, 0x20, 0x34, 0xbe, 0xe6, 0x3b, 0x89, 0x3e, 0xda, 0xb2, 0x83, 0x3d,
-  0xb7, 0xc1, 0xc6, 0xbd, 0xf0, 0x93, 0xd8, 0x3d, 0xd4, 0x53, 0xc0, 0xbc,
-  0xf1, 0xf2, 0x3d, 0xbd, 0x3a, 0xa8, 0xf1, 0xbd, 0x40, 0xd9, 0xd7, 0x3d,
-  0x7d, 0x86, 0x98, 0xbd, 0x8c, 0x65, 0x8b, 0x3b, 0x63, 0xa8, 0x0c, 0xbe,
-  0x48, 0xd9, 0xe1, 0xbb, 0xaa, 0xcc, 0xf6, 0x3d, 0x2f, 0xef, 0xeb, 0x3d,
-  0x00, 0x54, 0x0c, 0x3b, 0x52, 0x94, 0x57, 0x3e, 0x2d, 0x26, 0xfb, 0xbd,
-  0x0b, 0x51, 0x0f, 0xbe, 0xc0, 0xa3, 0xb6, 0xbc, 0xe4, 0xec, 0xee, 0x3b,
-  0x7f, 0x08, 0x87, 0xbc, 0x91, 0xab, 0x74, 0xbe, 0x84, 0x3e, 0x39, 0xbd,
-  0x42, 0xc6, 0xd1, 0x3d, 0x43, 0x54, 0x81, 0xbd, 0x34, 0x5f, 0x8a, 0x3d,
-  0xcd, 0xff, 0x09, 0x3d, 0x40, 0x44, 0x42, 0xbe, 0x38, 0x67, 0xbd, 0x3d,
-  0xa4, 0x67, 0x23, 0x3e, 0x19, 0x06, 0x58, 0x3e, 0x1e, 0xe5, 0x18, 0x3e,
-  0x8e, 0x16, 0x26, 0xbe, 0x20, 0xc4, 0xe0, 0xbd, 0x5c, 0x24, 0xcb, 0xbd,
-  0xfd, 0x48, 0x37, 0x3e, 0xa0, 0x49, 0x63, 0xbe, 0xa8, 0xbf, 0x88, 0x3e,
-  0x08, 0xf2, 0xd2, 0x3d, 0x64, 0xcd, 0x03, 0x3e, 0x99, 0x11, 0x14, 0x3e,
-  0xad, 0x97, 0xac, 0xbd, 0xb4, 0x77, 0x72, 0x3e, 0x33, 0x0a, 0x60, 0xbe,
-  0x1d, 0x6c, 0x08, 0x3c, 0xa7, 0x7d, 0xf5, 0xbc, 0x9c, 0x3a, 0x88, 0x3e,
-  0x5a, 0xca, 0x52, 0xbe, 0x42, 0xba, 0xdb, 0x3d, 0x76, 0xcf, 0x83, 0x3e,
-  0x90, 0xe0, 0x93, 0xbd, 0x3a, 0x75, 0x88, 0x3e, 0xc4, 0xe4, 0x17, 0x3e,
-  0x01, 0x92, 0x16, 0xbe, 0xac, 0x70, 0x86, 0x3e, 0xb1, 0x72, 0xdf, 0x3d,
-  0xf7, 0xc2, 0x8b, 0xbd, 0xfb, 0x3d, 0x20, 0xbe, 0xdc, 0xfd, 0x0e, 0xbe,
-  0x28, 0xcb, 0xfd, 0x3d, 0x09, 0xb2, 0x73, 0x3e, 0x55, 0x61, 0x40, 0x3e,
-  0xd5, 0xb2, 0x4c, 0x3e, 0x14, 0xb8, 0xc6, 0x3d, 0x6b, 0x6a, 0x40, 0xbe,
-  0xde, 0xf3, 0x0b, 0xbe, 0xfa, 0xe9, 0x14, 0xbd, 0xcb, 0x49, 0x74, 0x3e,
-  0xe5, 0x86, 0x7a, 0x3e, 0x34, 0x84, 0xe1, 0xbd, 0xa8, 0x1d, 0x70, 0xbd,
-  0x68, 0x20, 0xb3, 0x3d, 0x12, 0xd9, 0x47, 0x3d, 0xde, 0xaf, 0x58, 0x3d,
-  0xcf, 0xaa, 0xc7, 0x3d, 0x53, 0x32, 0x02, 0x3e, 0xfc, 0xa8, 0x7a, 0x3e,
-  0xd6, 0x81, 0x80, 0x3e, 0x3c, 0xd2, 0x62, 0x3e, 0xa2, 0xbf, 0xf2, 0xbd,
-  0xbb, 0xa7, 0x13, 0x3c, 0x16, 0x00, 0xc8, 0x3d, 0x00, 0xca, 0xb6, 0x3b,
-  0x96, 0x25, 0x84, 0x3e, 0x90, 0x43, 0x4c, 0x3e, 0x61, 0x63, 0xee, 0x3c,
-  0xf9, 0xe0, 0x90, 0x3e, 0x14, 0xd5, 0x83, 0x3c, 0x0e, 0x0b, 0x1a, 0x3e,
-  0x91, 0xb6, 0x86, 0x3e, 0xcc, 0x9c, 0xe7, 0xbd, 0x23, 0x46, 0xa7, 0x3d,
-  0x08, 0x22, 0xc1, 0x3d, 0x37, 0x20, 0x4d, 0xbe, 0x28, 0x6a, 0xa3, 0x3e,
-  0x46, 0xde, 0x4f, 0x3e, 0x65, 0x57, 0x10, 0xbe, 0x76, 0xa8, 0x80, 0x3d,
-  0x63, 0x04, 0x6d, 0x3d, 0xda, 0x5c, 0x3a, 0x3e, 0xc7, 0xcb, 0xd0, 0x3b,
-  0x90, 0x8a, 0x54, 0xbd, 0xd0, 0x9b, 0x68, 0x3d, 0x4d, 0xb3, 0x92, 0x3e,
-  0xfe, 0x2d, 0xd3, 0xbc, 0xd0, 0x38, 0x21, 0x3d, 0x10, 0xc3, 0x5e, 0xbd,
-  0xcf, 0xc3, 0xaa, 0x3d, 0x42, 0x51, 0xe0, 0xbc, 0xd2, 0x10, 0x37, 0x3e,
-  0xb4, 0x0b, 0x8f, 0xbd, 0x45, 0xca, 0x43, 0x3e, 0xa1, 0xe0, 0x51, 0xbe,
-  0x5f, 0x17, 0xd9, 0xbc, 0xe8, 0xee, 0xa9, 0xbd, 0xa8, 0x52, 0x0d, 0xbe,
-  0x98, 0xf9, 0x26, 0x3e, 0x7a, 0xed, 0xd0, 0x3d, 0xa5, 0xe1, 0x29, 0xbe,
-  0xb2, 0xf4, 0x24, 0x3e, 0xfe, 0xbe, 0x29, 0xbe, 0x08, 0x44, 0x44, 0xbd,
-  0x95, 0x69, 0x1f, 0x3d, 0x14, 0xb2, 0x50, 0xbe, 0x68, 0x81, 0x26, 0x3c,
-  0xda, 0xaf, 0x82, 0x3e, 0x48, 0xad, 0x89, 0x3e, 0x4c, 0x7d, 0x94, 0x3d,
-  0xea, 0x22, 0x5d, 0x3e, 0x92, 0xb4, 0xff, 0xbc, 0xcf, 0xdb, 0xe1, 0xbd,
-  0x1e, 0xdc, 0xf5, 0x3d, 0x1a, 0x41, 0x82, 0x3e, 0x5f, 0x21, 0x4f, 0x3e,
-  0xdb, 0x6a, 0x73, 0xbe, 0x74, 0x19, 0x37, 0xbe, 0xce, 0xe9, 0x69, 0xbd,
-  0xf6, 0x2b, 0x51, 0x3e, 0x87, 0xc4, 0x87, 0x3e, 0x1d, 0x9e, 0x49, 0x3e,
-  0x6a, 0x62, 0x81, 0xbe, 0x77, 0x41, 0x4e, 0x3d, 0x08, 0xe8, 0xae, 0xbd,
-  0x27, 0xe3, 0x30, 0x3e, 0xcc, 0x49, 0x92, 0x3e, 0xad, 0xa8, 0x7b, 0x3e,
-  0xac, 0xd6, 0x72, 0xbe, 0xd2, 0x7c, 0x9c, 0xbd, 0xaf, 0x61, 0x2c, 0xbe,
-  0xa9, 0x93, 0x38, 0xbd, 0x60, 0x6c, 0xc3, 0xbd, 0x22, 0x9e, 0x36, 0x3e,
-  0x55, 0xe6, 0x5b, 0xbd, 0x69, 0x9f, 0x5b, 0x3e, 0x5e, 0x2f, 0x60, 0x3e,
-  0x42, 0x6a, 0xe0, 0x3d, 0x38, 0xdd, 0xd6, 0x3d, 0xf2, 0xed, 0xfe, 0x3c,
-  0x49, 0x8a, 0x37, 0xbd, 0x80, 0xd5, 0xb5, 0xbd, 0x8e, 0x41, 0x8c, 0x3e,
-  0xbf, 0x29, 0x8b, 0x3e, 0xfb, 0x3d, 0x7b, 0x3d, 0xa5, 0x1c, 0xa4, 0xbe,
-  0x1a, 0x80, 0x28, 0xbe, 0xf1, 0x80, 0x56, 0xbd, 0xbc, 0xb2, 0x49, 0x3e,
-  0xde, 0xd4, 0x5e, 0x3e, 0xdd, 0x67, 0x3f, 0xbe, 0x34, 0xb1, 0x7c, 0x3e,
-  0x80, 0xe5, 0x95, 0xbb, 0x68, 0x04, 0xb5, 0x3c, 0x17, 0x88, 0xaa, 0x3c,
-  0x0a, 0xc7, 0x33, 0xbe, 0xb1, 0x85, 0x60, 0xbc, 0x1b, 0x22, 0x9d, 0x3e,
-  0x59, 0x46, 0x18, 0xbe, 0x35, 0x9a, 0x0f, 0x3e, 0xd7, 0x6a, 0x2f, 0xbe,
-  0xac, 0x99, 0x40, 0xbe, 0x9c, 0xa3, 0x6b, 0xbe, 0x0c, 0x25, 0x76, 0xbd,
-  0x97, 0xd6, 0x2a, 0x3e, 0x84, 0x22, 0x1f, 0x3e, 0xe9, 0x6b, 0xd2, 0xbb,
-  0x2e, 0x61, 0x47, 0x3e, 0xa6, 0xf7, 0xef, 0x3d, 0x94, 0x0d, 0x55, 0xbe,
-  0x75, 0xd5, 0xac, 0xbc, 0x69, 0x65, 0x62, 0x3d, 0x21, 0x5a, 0xe8, 0x3d,
-  0xb6, 0x7a, 0x72, 0x3e, 0x4c, 0xf4, 0x54, 0xbe, 0x98, 0x70, 0x34, 0x3d,
-  0x9d, 0xc1, 0xad, 0xbc, 0x25, 0x43, 0x9c, 0x3e, 0x56, 0x68, 0x29, 0x3e,
-  0xad, 0x56, 0x91, 0xbe, 0xe9, 0x19, 0xfb, 0xbb, 0x20, 0xb3, 0x98, 0x3c,
-  0x30, 0xdb, 0x44, 0xbd, 0x3e, 0xc7, 0xf9, 0x3c, 0x7a, 0xac, 0x98, 0x3e,
-  0x49, 0x48, 0x71, 0x3d, 0xa0, 0xa0, 0x93, 0x3e, 0xdc, 0xf2, 0x24, 0xbd,
-  0x48, 0x82, 0x9b, 0x3d, 0x08, 0x65, 0x0f, 0x3e, 0xa9, 0x3e, 0xfe, 0xbc,
-  0x2f, 0x3d, 0xb9, 0xbd, 0x30, 0xd6, 0x32, 0x3d, 0xf9, 0xd9, 0x07, 0xbe,
-  0x8f, 0xe0, 0xfc, 0xbd, 0x38, 0x49, 0xc1, 0xbd, 0x89, 0x2b, 0x4f, 0x3c,
-  0x04, 0x6b, 0x0b, 0x3e, 0xb6, 0x1c, 0xa6, 0xbd, 0xbc, 0x1f, 0x0d, 0x3e,
-  0xbc, 0xb5, 0x03, 0xbe, 0xe8, 0x12, 0xa7, 0xbd, 0xec, 0x3d, 0x3a, 0x3e,
-  0x28, 0x3b, 0xe2, 0xbd, 0x64, 0x45, 0x26, 0x3e, 0x40, 0x54, 0x14, 0x3e,
-  0xfc, 0xbb, 0x50, 0x3e, 0xc8, 0xbd, 0x7c, 0xbe, 0xac, 0x4c, 0x7c, 0x3e,
-  0x00, 0x13, 0x49, 0xbb, 0x70, 0x37, 0x54, 0xbd, 0x60, 0x59, 0x1d, 0xbe,
-  0x04, 0xd6, 0x78, 0xbe, 0xc0, 0x16, 0x1f, 0xbe, 0x18, 0x76, 0x9f, 0x3d,
-  0x30, 0xbf, 0xcf, 0x3d, 0x58, 0x7c, 0xfa, 0x3d, 0x70, 0xec, 0x15, 0x3d,
-  0x00, 0x1b, 0x05, 0x3b, 0x64, 0xbf, 0x33, 0xbe, 0xc8, 0x4f, 0x77, 0x3e,
-  0x90, 0xfb, 0x8c, 0xbd, 0xd0, 0x89, 0x69, 0xbe, 0x90, 0x46, 0xbd, 0x3d,
-  0x00, 0x5f, 0x4e, 0x3b, 0x74, 0xe4, 0x53, 0xbe, 0x3c, 0x09, 0x29, 0x3e,
-  0xb8, 0x36, 0x1f, 0xbe, 0x50, 0xa0, 0x3b, 0x3d, 0xd4, 0x35, 0x73, 0xbe,
-  0xc0, 0x18, 0x5a, 0x3d, 0x80, 0x37, 0xb5, 0x3d, 0x18, 0x28, 0x5e, 0x3e,
-  0x68, 0x6d, 0xc6, 0x3d, 0x40, 0x39, 0x77, 0xbc, 0xc0, 0x7f, 0x66, 0xbe,
-  0x28, 0x23, 0xe7, 0x3d, 0x7c, 0x34, 0x08, 0x3e, 0x5c, 0x1e, 0x5b, 0xbe,
-  0x00, 0x2c, 0x33, 0xbb, 0xc8, 0xd4, 0x61, 0xbe, 0xc0, 0x5c, 0x8d, 0x3c,
-  0xcc, 0xa5, 0x25, 0x3e, 0xa0, 0x4e, 0x55, 0x3d, 0xc0, 0x8b, 0xd7, 0x3c,
-  0x98, 0xce, 0xb8, 0xbd, 0x90, 0x1c, 0x77, 0xbd, 0x78, 0x13, 0xcf, 0x3d,
-  0xf0, 0xa1, 0x3e, 0xbd, 0x60, 0xf7, 0x4a, 0xbe, 0x78, 0x4f, 0x54, 0xbe,
-  0xb8, 0x3e, 0x22, 0xbe, 0xf0, 0x8a, 0x4d, 0xbd, 0x3c, 0x99, 0x68, 0xbe,
-  0x14, 0x14, 0x5c, 0x3e, 0x90, 0x85, 0x67, 0xbe, 0x80, 0xa3, 0x87, 0x3c,
-  0x14, 0x90, 0x4b, 0xbe, 0x00, 0xf0, 0x9b, 0xbc, 0x60, 0xc0, 0xd8, 0x3c,
-  0x50, 0x80, 0xab, 0x3d, 0x00, 0x31, 0xf6, 0xbd, 0x64, 0x97, 0x09, 0x3e,
-  0xd0, 0x3d, 0x15, 0xbd, 0x70, 0x2a, 0x27, 0xbd, 0xee, 0x5b, 0x46, 0xbe,
-  0x50, 0xb2, 0x4d, 0xbe, 0x82, 0xa0, 0x72, 0x3c, 0xf0, 0x7c, 0x81, 0x3e,
-  0xf8, 0x36, 0x8c, 0xbe, 0x32, 0xf2, 0x9f, 0xbd, 0x4b, 0x14, 0x4b, 0xbe,
-  0x28, 0x73, 0x32, 0x3d, 0xf4, 0x2d, 0x31, 0x3e, 0xdb, 0x96, 0x0f, 0xbd,
-  0x48, 0xe0, 0x11, 0xbe, 0x44, 0x79, 0x57, 0xbe, 0xb6, 0xc9, 0x78, 0x3d,
-  0x2e, 0xeb, 0x18, 0xbe, 0x67, 0x2b, 0x09, 0xbe, 0xc8, 0x78, 0xac, 0xbd,
-  0x76, 0x84, 0x05, 0xbe, 0x22, 0xcc, 0xff, 0x3c, 0x19, 0x11, 0x53, 0x3e,
-  0x76, 0x90, 0x65, 0x3e, 0x76, 0x94, 0x67, 0xbd, 0x84, 0x49, 0x99, 0xbd,
-  0x2a, 0xe3, 0x9e, 0x3d, 0xe4, 0x33, 0xb9, 0x3d, 0x20, 0x62, 0x09, 0xbe,
-  0x00, 0x6b, 0xbf, 0xbc, 0x93, 0x4d, 0x10, 0x3e, 0xa4, 0x05, 0x63, 0xbd,
-  0x34, 0xec, 0xcf, 0x3d, 0xc0, 0xc5, 0x7a, 0x3e, 0xe9, 0x2a, 0xfa, 0xbd,
-  0x1d, 0x94, 0x91, 0x3d, 0x40, 0x06, 0xc6, 0xbd, 0x94, 0xab, 0x29, 0x3e,
-  0x1c, 0xde, 0x26, 0x3e, 0x0e, 0xd9, 0x48, 0x3e, 0x94, 0xa9, 0x15, 0xbe,
-  0x51, 0x92, 0xab, 0xbd, 0x82, 0x7a, 0x72, 0xbe, 0xad, 0x5c, 0x8b, 0x3d,
-  0xc3, 0xb6, 0xd3, 0xbd, 0x7f, 0x6d, 0x35, 0x3e, 0xc6, 0x87, 0x66, 0x3e,
-  0x52, 0x78, 0x2b, 0x3d, 0xfc, 0x9f, 0x5c, 0x3e, 0xe7, 0xc4, 0xb5, 0x3d,
-  0x41, 0x86, 0x21, 0xbe, 0x89, 0xb8, 0x09, 0x3e, 0xd3, 0x97, 0xd6, 0x3d,
-  0x15, 0x1c, 0x39, 0x3e, 0x53, 0x50, 0x87, 0x3e, 0xfc, 0x0f, 0x0e, 0x3e,
-  0x74, 0xb1, 0x3c, 0xbd, 0x11, 0xa4, 0x16, 0x3d, 0x4d, 0x07, 0xa5, 0x3c,
-  0xf0, 0x0c, 0x41, 0x3e, 0xaf, 0x44, 0x3d, 0x3e, 0xd3, 0xed, 0xc1, 0x3d,
-  0xa0, 0x88, 0xb1, 0x3d, 0x15, 0x71, 0x51, 0x3e, 0xf1, 0xfa, 0x60, 0x3e,
-  0x05, 0xaf, 0x16, 0x3e, 0x6c, 0x1a, 0x46, 0xbd, 0xce, 0x56, 0x57, 0xbe,
-  0x9e, 0xd8, 0x88, 0xbe, 0xf8, 0x62, 0xa6, 0xbd, 0xb0, 0xf9, 0xc7, 0xbd,
-  0x65, 0xbd, 0x19, 0x3e, 0xd0, 0xfc, 0xd0, 0xbd, 0xf9, 0x41, 0x0a, 0xbe,
-  0x68, 0x1d, 0x78, 0xbd, 0x2d, 0x57, 0xa9, 0x3d, 0x5b, 0x39, 0xe7, 0xbd,
-  0xa6, 0x68, 0x66, 0xbe, 0x99, 0xe1, 0x86, 0xbd, 0x20, 0x83, 0x8b, 0x3d,
-  0x60, 0x95, 0x39, 0x3e, 0x7f, 0xeb, 0xff, 0x3d, 0x7e, 0xc3, 0x0b, 0xbe,
-  0x40, 0x72, 0x6f, 0xbe, 0x98, 0xfd, 0x26, 0xbe, 0xfe, 0x95, 0x8a, 0xbb,
-  0x9e, 0x80, 0xd1, 0x3d, 0x3d, 0xc4, 0x11, 0xbe, 0x2e, 0xa1, 0xf9, 0xbb,
-  0xc6, 0x86, 0x24, 0x3e, 0x4e, 0x8c, 0x82, 0xbe, 0xd3, 0x87, 0x52, 0x3e,
-  0xc9, 0xf4, 0x74, 0x3c, 0x08, 0x47, 0x80, 0x3d, 0xd6, 0x75, 0x12, 0x3d,
-  0xf5, 0xf6, 0x67, 0xbc, 0x2b, 0xf7, 0x4f, 0xbe, 0x2d, 0x76, 0x97, 0x3d,
-  0xc9, 0x70, 0x15, 0x3e, 0x80, 0x5b, 0x6a, 0x3e, 0xfc, 0xad, 0x62, 0x3e,
-  0x1b, 0x11, 0xf6, 0xbd, 0xd3, 0x2a, 0x40, 0x3d, 0xd6, 0x80, 0x32, 0x3e,
-  0x27, 0x5b, 0xa5, 0xbd, 0x81, 0xfb, 0x08, 0xbe, 0xf9, 0xb9, 0x18, 0xbb,
-  0x59, 0x5a, 0x71, 0xbe, 0xd6, 0x42, 0xa0, 0x3e, 0xc6, 0x30, 0xaa, 0xbd,
-  0x15, 0x63, 0x34, 0xbe, 0xa9, 0x6b, 0xe7, 0xbd, 0x20, 0x13, 0xfa, 0xbc,
-  0x80, 0x88, 0x30, 0x3e, 0xe0, 0xb5, 0x05, 0x3d, 0xd0, 0x36, 0x0b, 0xbe,
-  0x0e, 0xca, 0x8b, 0x3e, 0xce, 0x4d, 0x63, 0xbe, 0x3e, 0x91, 0x0f, 0x3e,
-  0x70, 0x13, 0x60, 0xbd, 0xf0, 0x8a, 0x2f, 0x3e, 0xf8, 0x81, 0xfd, 0x3d,
-  0xfc, 0x45, 0x3e, 0xbe, 0x44, 0xc1, 0x11, 0x3e, 0x33, 0xb9, 0x05, 0x3e,
-  0x17, 0xc0, 0x40, 0xbe, 0xe3, 0xcf, 0x57, 0x3d, 0x80, 0x83, 0x6a, 0x3e,
-  0xa8, 0xcf, 0x2f, 0x3d, 0x25, 0xc4, 0xbb, 0x3d, 0x9e, 0xb4, 0x22, 0x3d,
-  0x98, 0xce, 0x57, 0xbe, 0x40, 0xd5, 0x19, 0x3e, 0x90, 0x42, 0x49, 0xbd,
-  0xb0, 0x77, 0x63, 0xbd, 0xc4, 0xde, 0x44, 0xbe, 0xa0, 0x0e, 0xa5, 0xbc,
-  0x00, 0x08, 0x2a, 0x3e, 0x7c, 0xc8, 0x34, 0x3e, 0x14, 0xaf, 0x5a, 0xbe,
-  0x0c, 0x52, 0x52, 0xbe, 0x50, 0x86, 0x07, 0x3d, 0x54, 0x99, 0x77, 0xbe,
-  0xa0, 0x10, 0xf8, 0xbd, 0xb0, 0x84, 0xe2, 0x3d, 0x6c, 0x00, 0x07, 0x3e,
-  0xb0, 0x52, 0x86, 0xbd, 0x70, 0xa7, 0x01, 0xbd, 0x8c, 0xfb, 0x1a, 0xbe,
-  0xa0, 0x8c, 0x9a, 0xbd, 0xc0, 0x5b, 0x94, 0xbd, 0x40, 0x80, 0x1f, 0xbe,
-  0x18, 0x16, 0xa8, 0x3d, 0x98, 0x83, 0x41, 0x3e, 0x70, 0x9c, 0x54, 0xbe,
-  0x24, 0xfc, 0x55, 0xbe, 0x00, 0x8d, 0x6c, 0xbd, 0x7c, 0x21, 0x6f, 0xbe,
-  0x80, 0x31, 0x23, 0xbc, 0x24, 0x4d, 0x7a, 0x3e, 0x14, 0x86, 0x09, 0x3e,
-  0xc8, 0x64, 0x9c, 0x3d, 0x70, 0x52, 0xf7, 0xbd, 0xd8, 0xa4, 0x22, 0xbe,
-  0x58, 0x71, 0x09, 0x3e, 0xfc, 0x34, 0x2b, 0xbe, 0xc0, 0x70, 0xc1, 0xbd,
-  0x50, 0x7d, 0xb5, 0x3d, 0xd8, 0x23, 0x50, 0xbe, 0xfc, 0xc6, 0x23, 0xbe,
-  0x50, 0xbd, 0x06, 0xbd, 0x98, 0xaf, 0x42, 0xbe, 0xa0, 0x6e, 0xe0, 0xbd,
-  0x60, 0x89, 0x93, 0x3c, 0xac, 0x02, 0x61, 0x3e, 0xe0, 0x06, 0xa1, 0xbd,
-  0xb0, 0x8a, 0x6b, 0xbd, 0x40, 0x63, 0x57, 0xbe, 0xf4, 0xf2, 0x74, 0x3e,
-  0x60, 0x91, 0x06, 0xbe, 0x50, 0x08, 0xa0, 0x3d, 0x40, 0x07, 0x5b, 0xbc,
-  0x80, 0x28, 0xb9, 0xbd, 0x44, 0x7e, 0x41, 0xbe, 0x00, 0x05, 0x54, 0xbd,
-  0xe0, 0xa6, 0x28, 0xbd, 0x48, 0x13, 0xd4, 0xbd, 0xd4, 0xcd, 0x03, 0x3e,
-  0x48, 0x70, 0xc0, 0xbd, 0x00, 0xc2, 0x88, 0x3a, 0xa0, 0x1c, 0x68, 0xbd,
-  0x3c, 0x26, 0x60, 0x3e, 0x70, 0x74, 0x6a, 0xbe, 0xa0, 0xe2, 0xfb, 0xbd,
-  0xb4, 0x4b, 0x49, 0xbe, 0x20, 0x4c, 0xe2, 0xbd, 0xf2, 0x6e, 0x75, 0xbe,
-  0x00, 0xee, 0x8a, 0x3c, 0xef, 0x53, 0xd9, 0x3d, 0x60, 0x06, 0x56, 0x3e,
-  0x88, 0xd6, 0x89, 0x3d, 0xd9, 0x65, 0xec, 0x3c, 0xcb, 0xca, 0x01, 0xbe,
-  0xa6, 0x39, 0xac, 0xbd, 0x2c, 0xea, 0x48, 0xbe, 0xff, 0xa4, 0xa3, 0x3d,
-  0x3c, 0xc7, 0x7b, 0x3c, 0x94, 0xa2, 0x70, 0xbe, 0x1e, 0x04, 0x30, 0xbe,
-  0x1e, 0x08, 0xd8, 0x3d, 0xdc, 0x48, 0x28, 0xbe, 0x60, 0x4d, 0xaa, 0x3c,
-  0x10, 0x6d, 0x52, 0xbe, 0x55, 0x5c, 0x41, 0xbe, 0x20, 0xd6, 0xe7, 0x3c,
-  0x42, 0xcf, 0x0d, 0x3e, 0x7f, 0xaf, 0x72, 0xbe, 0xda, 0x36, 0xcd, 0xbc,
-  0x19, 0x06, 0x4c, 0xbe, 0x7b, 0x21, 0x59, 0xbe, 0x12, 0xb8, 0x29, 0x3d,
-  0x90, 0x23, 0x5d, 0x3d, 0x89, 0x77, 0x72, 0x3d, 0xd8, 0x8c, 0x23, 0x3e,
-  0x72, 0x3d, 0x1d, 0xbe, 0x1d, 0x1c, 0x8a, 0x3c, 0x0f, 0xac, 0x67, 0xbe,
-  0x5f, 0xae, 0x3f, 0x3e, 0x9c, 0x63, 0x35, 0xbe, 0x1b, 0x4b, 0x19, 0x3e,
-  0xde, 0xb1, 0xe4, 0x3d, 0x8e, 0x88, 0x98, 0x3d, 0x31, 0x47, 0xc6, 0x3d,
-  0xb8, 0x3b, 0xa7, 0x3c, 0x64, 0x8a, 0x26, 0x3b, 0x06, 0xd0, 0x0b, 0x3e,
-  0x00, 0x80, 0xab, 0x3b, 0xb8, 0x14, 0xb2, 0xbd, 0xb6, 0x44, 0xcf, 0xbd,
-  0x2b, 0x40, 0x2f, 0x3c, 0xd8, 0xb8, 0xf2, 0xbd, 0xff, 0xf1, 0x17, 0xbe,
-  0x20, 0xd5, 0x1f, 0x3e, 0x6a, 0x2a, 0x43, 0xbe, 0xc0, 0x74, 0x39, 0xbd,
-  0x3b, 0x17, 0x54, 0x3e, 0xc8, 0xe7, 0x42, 0x3e, 0xc0, 0x00, 0x58, 0x3d,
-  0x4d, 0x78, 0x75, 0xbe, 0x5f, 0x87, 0x29, 0xbe, 0x00, 0x60, 0x87, 0xbd,
-  0xe0, 0x6c, 0xe4, 0x3c, 0xbc, 0x58, 0xa3, 0x3d, 0xf5, 0xd0, 0x5b, 0xbe,
-  0xc6, 0xdf, 0x6a, 0xbe, 0xc9, 0xf6, 0xf7, 0xbc, 0xfa, 0xf1, 0x14, 0x3d,
-  0x91, 0x02, 0xcf, 0x3d, 0x2a, 0xfa, 0x49, 0xbe, 0xd7, 0xa9, 0x53, 0xbd,
-  0x54, 0x56, 0x4d, 0x3e, 0x30, 0x63, 0x7a, 0xbd, 0x57, 0x56, 0x4d, 0x3e,
-  0xd2, 0x4a, 0x34, 0x39, 0x07, 0x19, 0x1b, 0x3e, 0x4b, 0xe7, 0x95, 0x3e,
-  0x7e, 0xaa, 0x9f, 0x3d, 0xc7, 0xc8, 0xd4, 0x3a, 0x3b, 0x42, 0x73, 0xbd,
-  0xe3, 0x2d, 0xf7, 0xbd, 0xe2, 0xbc, 0x5c, 0x3e, 0xc8, 0x51, 0xf8, 0x3d,
-  0xea, 0x85, 0xd9, 0xbd, 0x9e, 0xdd, 0x00, 0xbe, 0xd4, 0x99, 0x35, 0x3e,
-  0x6c, 0x9e, 0x38, 0xbe, 0xf5, 0x10, 0xf9, 0x3d, 0x32, 0xdc, 0x74, 0x3e,
-  0xff, 0xb9, 0x83, 0x3e, 0x7b, 0x91, 0x70, 0x3e, 0x04, 0x92, 0xe4, 0xbb,
-  0xcc, 0xe1, 0xa7, 0x3e, 0xe6, 0x2b, 0xa4, 0xbc, 0x13, 0xc2, 0x64, 0x3c,
-  0x1e, 0x37, 0x94, 0xbd, 0xa0, 0x6d, 0x5f, 0x3d, 0x9c, 0x58, 0x9e, 0x3e,
-  0xf2, 0x9b, 0xc1, 0xbb, 0x60, 0xd7, 0x41, 0x3e, 0xe3, 0x36, 0x8f, 0x3d,
-  0xf0, 0x75, 0xbe, 0xbd, 0x02, 0xe6, 0xa8, 0xbd, 0x34, 0xcc, 0x20, 0xbe,
-  0x14, 0xc8, 0x8c, 0xbc, 0x74, 0x97, 0xda, 0x3c, 0x1b, 0x8a, 0x9a, 0x3e,
-  0x73, 0x95, 0x81, 0x3b, 0x95, 0x36, 0x1a, 0x3d, 0xf6, 0x4c, 0x31, 0x3e,
-  0x05, 0xac, 0x05, 0xbd, 0x88, 0x36, 0xbe, 0xbd, 0x19, 0x1f, 0x8a, 0x3d,
-  0x3c, 0xaf, 0x3b, 0xbe, 0xf2, 0x8a, 0xef, 0x3c, 0x90, 0x47, 0x9f, 0xbd,
-  0x17, 0x1a, 0x32, 0xbb, 0x5c, 0x3e, 0xc1, 0xbd, 0x21, 0xbb, 0x00, 0xbd,
-  0x2f, 0xc5, 0xbc, 0x3d, 0x56, 0x26, 0xa6, 0x3e, 0xc6, 0x5e, 0x19, 0xbe,
-  0x2c, 0xef, 0x05, 0xbe, 0x75, 0xda, 0x01, 0x3e, 0x61, 0xd0, 0x72, 0x3d,
-  0x62, 0x21, 0x10, 0xbe, 0x00, 0x01, 0x4c, 0xbc, 0xb9, 0x65, 0xbf, 0x3d,
-  0x77, 0x0e, 0x77, 0x3d, 0x6c, 0x86, 0x00, 0xbe, 0xec, 0xf8, 0x25, 0xbe,
-  0x0e, 0x15, 0x8b, 0xbe, 0xe7, 0x04, 0xea, 0xbd, 0x92, 0x93, 0x48, 0xbe,
-  0xda, 0xcf, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
-  0xc4, 0xd8, 0xf9, 0x3c, 0x9d, 0xe9, 0xde, 0x3d, 0xf0, 0x8e, 0xa0, 0xbd,
-  0x1c, 0xf7, 0x8a, 0x38, 0x78, 0x5c, 0x4e, 0x3d, 0x8d, 0x6d, 0x10, 0xbe,
-  0x40, 0xaa, 0x53, 0x3e, 0x50, 0x99, 0x8e, 0xbe, 0x21, 0x4d, 0x9b, 0xbe,
-  0xc9, 0xad, 0x38, 0xbe, 0xef, 0x7d, 0x2f, 0x3e, 0xe0, 0x0c, 0x6f, 0x3e,
-  0x2d, 0x41, 0x2d, 0xbe, 0xc7, 0xd6, 0x78, 0xbd, 0xcb, 0xc6, 0x6b, 0x3e,
-  0xd6, 0x2a, 0xf0, 0x3d, 0x87, 0x17, 0x48, 0x3e, 0x19, 0x26, 0x90, 0x3e,
-  0x84, 0xc8, 0x7d, 0xbe, 0x6a, 0x03, 0x72, 0x3e, 0x70, 0x88, 0x74, 0xbe,
-  0x41, 0xe0, 0x2a, 0xbe, 0x44, 0x27, 0x2f, 0x3e, 0x57, 0xa8, 0xb4, 0x3e,
-  0x05, 0x4e, 0x97, 0x3e, 0xd3, 0x0d, 0xd1, 0xbb, 0x30, 0x57, 0xd5, 0xbc,
-  0x74, 0x81, 0x7b, 0xba, 0x91, 0x60, 0x1d, 0x3e, 0xcb, 0x2a, 0xac, 0xbe,
-  0xf4, 0x84, 0x2d, 0xbe, 0x8c, 0x3b, 0xf0, 0x3d, 0x20, 0xc2, 0x7a, 0x3e,
-  0x6a, 0x9d, 0x09, 0x3e, 0x12, 0x05, 0x2b, 0x3d, 0x4a, 0xb8, 0x07, 0x3e,
-  0xc8, 0xac, 0x9f, 0x3d, 0xc3, 0x20, 0x38, 0xbe, 0xc7, 0x0d, 0x68, 0xbe,
-  0xce, 0x86, 0x07, 0x3e, 0x09, 0x79, 0x7c, 0x3e, 0xba, 0xd1, 0x88, 0xbd,
-  0x2d, 0x45, 0x69, 0x3e, 0x2b, 0x4b, 0xa7, 0xbe, 0x96, 0x6a, 0x2e, 0x3d,
-  0x81, 0x89, 0x6c, 0x3e, 0x7c, 0x12, 0xa8, 0x3e, 0xae, 0xe4, 0x55, 0x3e,
-  0xa6, 0xb0, 0x91, 0xbd, 0x50, 0x27, 0x8a, 0x3d, 0x3b, 0xac, 0xd3, 0x3e,
-  0xc5, 0x38, 0x94, 0xbe, 0xf2, 0x1a, 0xc9, 0x3e, 0x07, 0x09, 0x21, 0x3e,
-  0x25, 0x78, 0x2c, 0xbc, 0x7b, 0x5c, 0xd8, 0x3e, 0x2e, 0x16, 0x73, 0x3e,
-  0x64, 0xb7, 0x45, 0x3e, 0x8a, 0x5a, 0x72, 0x3e, 0xd9, 0x68, 0x84, 0x3e,
-  0x4f, 0x54, 0xbd, 0xbd, 0x1f, 0xf2, 0x34, 0xbe, 0x6f, 0xc4, 0x3a, 0xbe,
-  0xcf, 0x50, 0x2e, 0xbd, 0x72, 0x2b, 0x56, 0x3d, 0x51, 0x2d, 0xd5, 0x3d,
-  0xcc, 0x13, 0x87, 0xbe, 0xd2, 0x39, 0x91, 0xbe, 0x20, 0x0f, 0x52, 0xbc,
-  0x06, 0x01, 0x99, 0xbe, 0x5f, 0x66, 0xb3, 0x3e, 0xc4, 0x79, 0xa0, 0xbe,
-  0xc0, 0x92, 0x96, 0xbe, 0xc4, 0x59, 0x88, 0x3e, 0xc5, 0xd7, 0x2e, 0x3e,
-  0xbe, 0x48, 0x72, 0xbe, 0xb0, 0x18, 0x7f, 0x3e, 0xd6, 0x6d, 0x75, 0xbd,
-  0x9a, 0x9f, 0xdc, 0x3c, 0x9c, 0x53, 0x5d, 0xbe, 0x9e, 0x90, 0x86, 0xbd,
-  0x16, 0x4f, 0xd6, 0xbd, 0x82, 0x0d, 0x78, 0x3e, 0x7f, 0xa7, 0x76, 0xbe,
-  0xbe, 0x74, 0xa4, 0xbe, 0x04, 0x90, 0xdc, 0x3d, 0x54, 0x42, 0xa5, 0xbd,
-  0x65, 0xb8, 0x2c, 0xbe, 0x93, 0x15, 0x69, 0x3e, 0xf2, 0x36, 0x55, 0xbe,
-  0x14, 0xea, 0x02, 0xbe, 0x60, 0x27, 0x95, 0x3e, 0x2c, 0xa6, 0x12, 0x3e,
-  0x20, 0x86, 0xe3, 0x3c, 0xeb, 0xf1, 0xf0, 0x3d, 0xdc, 0xc7, 0x9d, 0x3e,
-  0xf3, 0x31, 0x61, 0xbe, 0x0c, 0xf8, 0x2f, 0xbe, 0xc0, 0x8c, 0x9a, 0x3c,
-  0x5c, 0xa7, 0xf6, 0x3d, 0xec, 0x76, 0x93, 0x3d, 0x7c, 0xd9, 0xa3, 0xbe,
-  0x30, 0xa3, 0x54, 0x3d, 0x14, 0x55, 0x06, 0xbe, 0x68, 0xbf, 0x35, 0xbe,
-  0x93, 0xc6, 0xa4, 0x3e, 0x65, 0xca, 0x98, 0x3e, 0x80, 0x6f, 0x21, 0xbc,
-  0xce, 0x19, 0xfe, 0xbd, 0x16, 0xa8, 0x97, 0xbe, 0x66, 0xe2, 0xac, 0xbe,
-  0xb8, 0x35, 0xa4, 0xbe, 0x02, 0x91, 0x6a, 0xbe, 0x18, 0xe0, 0xa7, 0x3d,
-  0xa0, 0xdf, 0xa5, 0x3d, 0xba, 0xd3, 0x8c, 0xbe, 0x1c, 0x28, 0x45, 0xbe,
-  0xa9, 0xe3, 0x93, 0x3e, 0xc2, 0x53, 0x77, 0x3e, 0x8e, 0xc9, 0x3b, 0x3e,
-  0x20, 0x7a, 0x50, 0xbd, 0x8c, 0x2a, 0x22, 0xbe, 0x16, 0x67, 0x0a, 0xbe,
-  0x6d, 0x16, 0xb3, 0xbe, 0x18, 0x09, 0x8d, 0xbd, 0x90, 0xd5, 0xd4, 0x3c,
-  0x2d, 0xf6, 0x94, 0x3e, 0xf8, 0xa0, 0x11, 0xbd, 0x9a, 0x2c, 0x68, 0xbe,
-  0x8e, 0x7a, 0xff, 0x3d, 0xf9, 0x7b, 0x5f, 0x3e, 0x99, 0xb4, 0xbe, 0x3e,
-  0x1e, 0x22, 0x56, 0x3e, 0x82, 0x9f, 0xb7, 0xbe, 0x2e, 0xa3, 0x4b, 0xbe,
-  0x5c, 0x93, 0x67, 0x3e, 0xed, 0xf6, 0x77, 0x3e, 0x42, 0xae, 0xf0, 0x3d,
-  0xb8, 0x56, 0x24, 0xbd, 0xf7, 0x53, 0x4d, 0xbe, 0xb7, 0x02, 0x3e, 0xbe,
-  0x92, 0x6a, 0x45, 0x3e, 0x55, 0x0a, 0xa1, 0xbe, 0x0e, 0xc7, 0xff, 0x3d,
-  0x08, 0xbe, 0xb0, 0x3e, 0xfc, 0x6d, 0x94, 0xbe, 0xda, 0x8f, 0xc2, 0x3e,
-  0xb0, 0xb3, 0x99, 0x3e, 0x20, 0x39, 0x07, 0x3e, 0xa8, 0x2c, 0xfd, 0x3e,
-  0x42, 0x1a, 0xb6, 0xbc, 0x1f, 0xde, 0x4a, 0x3e, 0x29, 0x1e, 0x9b, 0x3d,
-  0xd6, 0x22, 0x43, 0xbd, 0x84, 0x76, 0x09, 0xbe, 0x43, 0xd8, 0x53, 0x3c,
-  0xb5, 0x09, 0xd6, 0xbb, 0x6e, 0xb1, 0xa4, 0xbe, 0x81, 0x20, 0x4d, 0x3e,
-  0x90, 0x05, 0x0b, 0xbe, 0x93, 0x6d, 0x0b, 0x3e, 0x27, 0x74, 0x58, 0x3e,
-  0x7f, 0xe3, 0x0e, 0x3e, 0x25, 0xa3, 0xed, 0x3d, 0x5c, 0x45, 0x25, 0xbe,
-  0xfc, 0x04, 0xe6, 0x3e, 0xaf, 0xb6, 0x70, 0x3e, 0x58, 0xf9, 0x72, 0xbd,
-  0xa9, 0x92, 0x87, 0xbe, 0x69, 0x13, 0xbb, 0xbe, 0xcc, 0x7f, 0x74, 0xbe,
-  0x80, 0x51, 0xd1, 0x3e, 0x9e, 0x64, 0xb6, 0x3d, 0x00, 0x0d, 0x54, 0xbe,
-  0x6c, 0xc1, 0x87, 0x3c, 0x73, 0x73, 0x78, 0x3e, 0xcd, 0xdb, 0xdb, 0x3e,
-  0x0f, 0x12, 0xa3, 0x3e, 0xfc, 0xcf, 0x8a, 0xbc, 0x50, 0xb5, 0xdf, 0xbd,
-  0x34, 0xb5, 0x6e, 0xbe, 0x64, 0x21, 0xa0, 0x3e, 0x4b, 0x58, 0x48, 0xbe,
-  0x43, 0x48, 0x68, 0x3e, 0xc1, 0x90, 0x86, 0xbd, 0x8f, 0xa4, 0x6b, 0x3e,
-  0x3d, 0xc1, 0x57, 0xbe, 0x70, 0x4a, 0x96, 0x3d, 0xda, 0x2c, 0x89, 0x3d,
-  0x78, 0x4d, 0xcf, 0x3d, 0x56, 0x6b, 0x5f, 0xbd, 0x52, 0xd5, 0x97, 0x3e,
-  0xb8, 0x35, 0x4c, 0xbe, 0x7c, 0x64, 0xab, 0x3e, 0xbd, 0xe6, 0xb0, 0x3e,
-  0x24, 0x64, 0x04, 0x3e, 0x48, 0xda, 0x0a, 0xbe, 0x80, 0x34, 0xb8, 0xbe,
-  0xb4, 0x5b, 0x22, 0x3e, 0x58, 0x77, 0xbc, 0x3e, 0x7c, 0x2b, 0x82, 0x3e,
-  0x10, 0xb5, 0x95, 0xbe, 0x13, 0xb0, 0x9b, 0x3e, 0x99, 0x5a, 0xbc, 0x3d,
-  0x33, 0xad, 0x8d, 0x3b, 0x88, 0x0d, 0x8b, 0xbe, 0xcc, 0xce, 0xc9, 0x3e,
-  0x08, 0xee, 0x9f, 0xbe, 0xcc, 0xf1, 0xf2, 0xbd, 0xdc, 0x0c, 0xc5, 0x3d,
-  0xf7, 0xfb, 0xa8, 0x3e, 0x49, 0xe0, 0x2b, 0x3d, 0x50, 0xf4, 0xb8, 0xbc,
-  0xd5, 0x79, 0x46, 0xbe, 0x70, 0xc5, 0xc4, 0x3e, 0x7e, 0x35, 0xbc, 0x3b,
-  0x20, 0xb1, 0x94, 0x3e, 0x91, 0xd2, 0x92, 0xbc, 0xe0, 0xe5, 0x4a, 0xbe,
-  0x32, 0x84, 0x83, 0x3e, 0x71, 0x5c, 0x52, 0xbe, 0x80, 0x31, 0x81, 0xbb,
-  0xc8, 0x5c, 0xd9, 0xbd, 0xe5, 0xb5, 0x78, 0x3e, 0x15, 0xbb, 0xc1, 0x3e,
-  0xfd, 0x68, 0xad, 0xbe, 0x81, 0xea, 0x4e, 0x3e, 0xba, 0x56, 0x3a, 0x3e,
-  0x20, 0xe6, 0x81, 0xbd, 0x17, 0x42, 0x2c, 0xbd, 0x6d, 0xeb, 0xd8, 0xbe,
-  0xd2, 0xad, 0x86, 0xbe, 0x8b, 0x26, 0x29, 0x3e, 0xb7, 0x9c, 0x89, 0x3e,
-  0xe4, 0xe3, 0x4c, 0xbd, 0x2b, 0xa9, 0xdb, 0xbd, 0x6b, 0x15, 0x8d, 0x3e,
-  0xf2, 0x79, 0x1b, 0x3e, 0x2e, 0x0b, 0xb4, 0x3e, 0x83, 0x4f, 0x07, 0x3e,
-  0x44, 0xc1, 0xb2, 0x3d, 0x69, 0x56, 0xa0, 0x3e, 0xd8, 0x7f, 0xa8, 0x3e,
-  0x31, 0x37, 0x63, 0x3e, 0xc2, 0x36, 0xcf, 0x3e, 0xa5, 0xcc, 0xb9, 0xbe,
-  0x12, 0x82, 0x70, 0x3e, 0x7a, 0xe4, 0xe6, 0x3c, 0x17, 0x46, 0x9c, 0x3e,
-  0xda, 0x4d, 0xb9, 0xbe, 0xb8, 0x04, 0x2a, 0xbd, 0xf9, 0xa5, 0x89, 0xbe,
-  0x22, 0x46, 0x8a, 0xbe, 0x32, 0x36, 0x91, 0xbe, 0x56, 0x78, 0xb5, 0x3e,
-  0x38, 0xc3, 0x48, 0x3e, 0x45, 0x7f, 0x34, 0x3e, 0xba, 0xfd, 0x8a, 0x3e,
-  0xb0, 0xf3, 0x80, 0x3e, 0xe0, 0x18, 0x83, 0x3e, 0xd0, 0x1a, 0x8a, 0xbd,
-  0x17, 0x23, 0x47, 0x3d, 0x00, 0xa7, 0x90, 0xbe, 0xa6, 0x20, 0x63, 0x3e,
-  0xf5, 0x32, 0x4b, 0x3c, 0xce, 0x7b, 0xd2, 0x3e, 0xac, 0xfb, 0x77, 0xbe,
-  0x2f, 0xaa, 0x89, 0xbe, 0x26, 0xa0, 0x9f, 0x3d, 0x2d, 0xe0, 0xab, 0xbd,
-  0x60, 0x1b, 0xc3, 0x3e, 0x09, 0xd0, 0xad, 0xbc, 0xd2, 0x7b, 0x8c, 0xbe,
-  0x2b, 0x34, 0xad, 0xbe, 0x6b, 0xb6, 0x8c, 0xbe, 0x32, 0x96, 0x54, 0xbe,
-  0x3f, 0xc9, 0xdc, 0x3e, 0xb6, 0x26, 0x9f, 0x3d, 0xef, 0x46, 0xb2, 0xbc,
-  0xeb, 0x1d, 0xb8, 0xbd, 0x93, 0xa8, 0x5c, 0x3e, 0xf6, 0xbc, 0x95, 0x3e,
-  0x40, 0xb2, 0x65, 0xbc, 0xbd, 0x8a, 0x83, 0x3d, 0x2e, 0xc5, 0x65, 0xbe,
-  0x32, 0xa6, 0xa1, 0xbe, 0x9a, 0xe2, 0x0f, 0x39, 0xad, 0xc5, 0xe2, 0x3c,
-  0xb1, 0xad, 0x2b, 0x3e, 0x22, 0xac, 0x99, 0x3e, 0x1c, 0x0a, 0x03, 0xbe,
-  0xa6, 0xd5, 0xa1, 0x3e, 0x80, 0x8a, 0x5b, 0x3b, 0xe2, 0xc1, 0xed, 0xbd,
-  0x0e, 0x19, 0x57, 0xbd, 0xd9, 0x30, 0xbc, 0x3e, 0x19, 0xf5, 0xe1, 0x3e,
-  0x3b, 0x88, 0xc3, 0xbe, 0x1e, 0xfb, 0x86, 0xbe, 0xaa, 0xda, 0xaa, 0x3e,
-  0x3b, 0x18, 0x6b, 0x3e, 0xb5, 0xd0, 0xd5, 0xbd, 0x74, 0xc4, 0xac, 0x3e,
-  0x2d, 0x8d, 0x87, 0xbe, 0xea, 0x3a, 0x09, 0xbe, 0x5f, 0xbf, 0x91, 0x3e,
-  0xf0, 0x5a, 0xa1, 0x3e, 0x65, 0x28, 0x8d, 0x3e, 0x22, 0xc9, 0x8b, 0xbe,
-  0x60, 0x52, 0x9b, 0xbe, 0xc3, 0x37, 0x52, 0x3c, 0x9f, 0xe6, 0xcb, 0x3c,
-  0x52, 0xe2, 0x99, 0xbe, 0xfd, 0x97, 0x77, 0x3e, 0xee, 0x7a, 0x1a, 0x3e,
-  0x43, 0xb6, 0x15, 0xbe, 0x97, 0xb9, 0xe0, 0xbc, 0x58, 0x76, 0x2f, 0x3d,
-  0x20, 0x1b, 0x90, 0x3e, 0x79, 0x3f, 0xba, 0x3e, 0x80, 0x8e, 0x9d, 0xbe,
-  0x27, 0x8f, 0x99, 0x3c, 0xdd, 0xe1, 0x64, 0xbe, 0x3d, 0xf3, 0xa2, 0x3e,
-  0xe7, 0xa1, 0x9e, 0x3e, 0x47, 0x83, 0xc9, 0x3d, 0x66, 0xcc, 0x71, 0xbe,
-  0x31, 0x8c, 0x1f, 0x3e, 0x49, 0x9a, 0x9d, 0x3e, 0x8d, 0x25, 0xc8, 0x3e,
-  0xdd, 0x3c, 0x93, 0xbe, 0x7e, 0x01, 0xc5, 0xbd, 0x37, 0x95, 0x64, 0xbe,
-  0x66, 0xac, 0x34, 0x3e, 0xe1, 0x65, 0x1c, 0xbe, 0x3a, 0x11, 0x95, 0x3e,
-  0xd8, 0x50, 0x08, 0xbd, 0x02, 0x5f, 0x50, 0xbe, 0x75, 0x24, 0xa7, 0x3e,
-  0xe5, 0x3e, 0x3d, 0xbe, 0x8b, 0x6a, 0x24, 0xbd, 0x5b, 0x11, 0xfb, 0x3e,
-  0xdd, 0xe6, 0xb0, 0xbc, 0xa4, 0x80, 0xaf, 0x3e, 0xe1, 0x81, 0xed, 0xbd,
-  0xbf, 0x2c, 0xdb, 0x3d, 0x9b, 0xb8, 0x8b, 0x3e, 0x03, 0x44, 0x99, 0x3e,
-  0x4d, 0x45, 0x05, 0x3e, 0x09, 0x68, 0x8e, 0x3e, 0x26, 0x03, 0x8a, 0xbe,
-  0x2c, 0x82, 0x5f, 0x3c, 0x18, 0x80, 0xc6, 0xbe, 0x70, 0x6c, 0x90, 0xbe,
-  0x87, 0x50, 0x21, 0xbe, 0xfe, 0x87, 0xa4, 0x3e, 0xc0, 0x8f, 0x21, 0xbc,
-  0x5b, 0x4a, 0x1b, 0x3e, 0x67, 0x11, 0xb5, 0x3c, 0xd1, 0xd3, 0xf0, 0x3d,
-  0x6a, 0xd7, 0x88, 0x3e, 0x45, 0xf5, 0xc5, 0x3e, 0x7c, 0x3e, 0x63, 0x3e,
-  0x02, 0x16, 0xd9, 0xbd, 0x79, 0x02, 0xd6, 0x3d, 0x7f, 0xc8, 0xa9, 0x3e,
-  0x37, 0xce, 0x8c, 0x3e, 0xc9, 0x92, 0xaf, 0xbe, 0xea, 0xd7, 0xfa, 0x3d,
-  0xda, 0x13, 0x27, 0xbe, 0x27, 0x01, 0xb8, 0x3e, 0xa5, 0xdd, 0x04, 0x3e,
-  0x94, 0x59, 0x06, 0xbe, 0x87, 0xb9, 0x42, 0x3e, 0x77, 0x5f, 0xe5, 0xbd,
-  0x1c, 0x94, 0xda, 0x3d, 0xf9, 0x97, 0xbc, 0x3e, 0x42, 0x10, 0x4b, 0xbe,
-  0xf3, 0xeb, 0x57, 0xbe, 0x6a, 0x72, 0xcd, 0x3e, 0xbf, 0x8e, 0x01, 0x3e,
-  0xd6, 0x70, 0x2f, 0x3e, 0xfa, 0x2b, 0x9e, 0x3d, 0x5b, 0x2d, 0xb8, 0xbe,
-  0x3e, 0x49, 0x4a, 0xbe, 0xbb, 0x0c, 0x52, 0x3d, 0x36, 0x18, 0xc6, 0xbd,
-  0x52, 0xa7, 0x7e, 0xbe, 0x79, 0x69, 0xa3, 0x3e, 0x65, 0xf8, 0x9c, 0x3e,
-  0x00, 0x7d, 0x5b, 0xbe, 0x19, 0xcd, 0x32, 0xbd, 0xaa, 0x87, 0x93, 0x3e,
-  0xc7, 0xf2, 0x3c, 0x3e, 0xd7, 0x6f, 0x9f, 0x3e, 0xa6, 0x83, 0x6d, 0xbd,
-  0x74, 0xb3, 0x46, 0xba, 0x15, 0xb7, 0x7f, 0xbe, 0x73, 0x3f, 0xcc, 0xbd,
-  0x3f, 0xa4, 0xe4, 0x3d, 0x85, 0xeb, 0x92, 0xbe, 0x4e, 0x22, 0x76, 0xbe,
-  0xe8, 0xce, 0x49, 0xbe, 0x4b, 0x7c, 0xc8, 0x3d, 0xb7, 0x6e, 0xaf, 0x3c,
-  0x80, 0xc7, 0x42, 0xbd, 0x79, 0x8b, 0xa6, 0xbe, 0xd3, 0x1a, 0x80, 0x3e,
-  0xfe, 0x64, 0x7b, 0xbe, 0xc8, 0xcf, 0x9a, 0xbe, 0x9e, 0x5e, 0x13, 0x3e,
-  0xbb, 0x2c, 0x24, 0x3e, 0xaf, 0x77, 0x56, 0x3e, 0x28, 0x59, 0xb3, 0xbd,
-  0xf0, 0x5e, 0x01, 0xbd, 0x19, 0x64, 0x6e, 0xbe, 0xbe, 0x41, 0xc7, 0x3d,
-  0xbf, 0x82, 0x96, 0xbd, 0xe0, 0x70, 0x88, 0x3b, 0x8e, 0x6e, 0x13, 0xbd,
-  0x4f, 0x5d, 0x9d, 0x3e, 0xe3, 0x59, 0x0a, 0xbe, 0x89, 0xa2, 0x25, 0xbd,
-  0x08, 0xc5, 0xd1, 0x3e, 0xd6, 0xd7, 0xb8, 0x3e, 0x9c, 0xfb, 0x54, 0x3e,
-  0x7b, 0x12, 0xb5, 0xbc, 0x94, 0xa2, 0x86, 0xbe, 0xa5, 0xf1, 0xbd, 0xbd,
-  0xc8, 0x2d, 0x63, 0xbe, 0x62, 0xfd, 0xd0, 0x3e, 0x49, 0x72, 0x9f, 0x3d,
-  0x19, 0xf3, 0xa5, 0x3d, 0xdd, 0x60, 0x0d, 0xbe, 0x61, 0x2c, 0x87, 0x3e,
-  0xe5, 0x7d, 0x6f, 0xbe, 0xdb, 0x11, 0x26, 0x3e, 0xab, 0x36, 0x15, 0xbd,
-  0x4c, 0x19, 0x0a, 0xbe, 0x4b, 0x22, 0xde, 0x3d, 0xbc, 0xfb, 0x11, 0x3e,
-  0xb5, 0x0f, 0xba, 0xbd, 0x78, 0x36, 0x99, 0x3d, 0xfa, 0x8f, 0x32, 0xbd,
-  0x51, 0x97, 0x8f, 0xbe, 0x1b, 0xaa, 0x8f, 0x3e, 0x20, 0x29, 0x1e, 0x3e,
-  0x25, 0x30, 0x86, 0x3d, 0xb3, 0xa9, 0x7e, 0x3e, 0xa7, 0xc9, 0x80, 0xbe,
-  0xeb, 0x9e, 0xc2, 0x3e, 0x75, 0x20, 0x30, 0x3e, 0x68, 0x44, 0xf6, 0x3d,
-  0xae, 0xd8, 0xb3, 0x3e, 0x22, 0x04, 0x6c, 0x3e, 0xa6, 0xf2, 0xd1, 0x3b,
-  0x1b, 0x19, 0x90, 0x3e, 0xeb, 0x38, 0x0a, 0x3e, 0x84, 0xdc, 0x75, 0x3e,
-  0x87, 0x67, 0x2f, 0x3d, 0x8c, 0xf5, 0xa3, 0x3e, 0xed, 0xef, 0x3a, 0x3e,
-  0x44, 0x94, 0x68, 0xbe, 0x73, 0x2c, 0x90, 0xbe, 0xee, 0x15, 0xb8, 0x3e,
-  0xe0, 0xf0, 0x32, 0xbe, 0x70, 0xf6, 0x80, 0x3e, 0x13, 0x77, 0x11, 0xbe,
-  0xb0, 0xc8, 0x59, 0xbe, 0x64, 0x19, 0x75, 0xbd, 0x14, 0x87, 0xd9, 0x3e,
-  0x37, 0xc1, 0x2b, 0x3c, 0x9b, 0xb7, 0xb5, 0xbe, 0xf8, 0x3b, 0x77, 0x3e,
-  0x44, 0xd9, 0x96, 0x3d, 0x5c, 0xe7, 0x6a, 0xbc, 0xeb, 0x48, 0x26, 0x3e,
-  0x6f, 0xdf, 0x9c, 0xbe, 0x5c, 0x1e, 0x92, 0xbe, 0xa3, 0xcf, 0xd1, 0x3e,
-  0x7d, 0xe0, 0x1e, 0xbe, 0xf6, 0x31, 0xfd, 0x3d, 0x74, 0x6c, 0x1d, 0x3d,
-  0x31, 0xd5, 0x3f, 0x3d, 0xe4, 0xc1, 0x1e, 0xbe, 0x75, 0x98, 0x2e, 0xbe,
-  0xdf, 0xb3, 0x9c, 0x3e, 0x2f, 0x8c, 0x2c, 0x3e, 0x7a, 0xd5, 0x5a, 0x3e,
-  0x59, 0xf0, 0x82, 0xbe, 0xb0, 0xfc, 0xa3, 0xbe, 0x0f, 0xd2, 0x97, 0xbe,
-  0x13, 0x77, 0x9a, 0x3e, 0x38, 0x97, 0xa5, 0x3e, 0x58, 0x16, 0xab, 0xbc,
-  0xe0, 0x31, 0xd2, 0xbd, 0x61, 0xbb, 0x65, 0xbe, 0x78, 0xfd, 0x77, 0x3d,
-  0xca, 0x05, 0x16, 0xbd, 0x7b, 0x95, 0x03, 0x3e, 0x5e, 0x05, 0xb8, 0xbd,
-  0xc8, 0x58, 0x25, 0x3e, 0x93, 0x62, 0x52, 0x3d, 0xc4, 0x1a, 0xcf, 0x3e,
-  0x87, 0x76, 0xba, 0x3e, 0x46, 0xd3, 0x9d, 0x3e, 0xf7, 0x9c, 0xa7, 0x3e,
-  0x4d, 0xf6, 0x88, 0x3d, 0x6d, 0x05, 0x22, 0xbd, 0x85, 0x8e, 0x60, 0xbe,
-  0x2e, 0x4e, 0x0c, 0xbc, 0x18, 0xba, 0x79, 0x3e, 0xe6, 0xd7, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x14, 0xeb, 0x02, 0x3d,
-  0x19, 0xf6, 0x92, 0x3e, 0xa4, 0x69, 0x69, 0x3d, 0xa0, 0x0e, 0x48, 0xbc,
-  0x33, 0x10, 0xab, 0x3e, 0x60, 0x2a, 0x75, 0x3e, 0xf3, 0xbe, 0x68, 0xbe,
-  0x2e, 0x6b, 0x44, 0xbd, 0xae, 0xa6, 0x67, 0xbe, 0x7a, 0xbb, 0x66, 0xbe,
-  0xc9, 0xf9, 0x93, 0x3e, 0x57, 0x65, 0x52, 0x3e, 0xfe, 0x3d, 0x8b, 0xbe,
-  0xe7, 0x58, 0x9c, 0x3e, 0xd7, 0xf2, 0x3d, 0xbe, 0x4e, 0xae, 0x09, 0xbd,
-  0xf7, 0xc2, 0xdf, 0x3e, 0x51, 0x69, 0x3b, 0x3e, 0xe9, 0xfe, 0x87, 0x3e,
-  0xa0, 0x7a, 0x45, 0xbc, 0x19, 0xab, 0xb4, 0xbd, 0xf8, 0x55, 0xb0, 0x3e,
-  0x72, 0xd4, 0x53, 0xbe, 0x23, 0xd8, 0xbe, 0x3e, 0x23, 0x73, 0x1c, 0x3e,
-  0x76, 0x4a, 0x67, 0xbd, 0xe7, 0x22, 0x0b, 0x3e, 0x7f, 0x54, 0x46, 0xbe,
-  0x34, 0x11, 0x97, 0xbe, 0x25, 0x04, 0xe4, 0xbd, 0x99, 0x5e, 0x49, 0xbe,
-  0x52, 0xbe, 0x7d, 0x3e, 0x86, 0xd9, 0x21, 0x3e, 0x5a, 0xef, 0x2d, 0xbe,
-  0x00, 0x34, 0x29, 0xbb, 0x26, 0x19, 0x24, 0x3e, 0x4f, 0xc7, 0x19, 0xbe,
-  0xd0, 0x34, 0x44, 0xbd, 0xc1, 0xa1, 0xb2, 0xbe, 0x48, 0x55, 0xac, 0x3d,
-  0x40, 0x0e, 0x0f, 0x3e, 0x3c, 0x28, 0x10, 0xbe, 0x53, 0x7f, 0x3d, 0xbe,
-  0x08, 0x31, 0x57, 0xbe, 0x94, 0xf5, 0x95, 0x3d, 0x98, 0xa6, 0x82, 0xbe,
-  0xd2, 0x96, 0x81, 0xbe, 0x08, 0x51, 0x6a, 0xbd, 0x1b, 0x39, 0xfc, 0xbd,
-  0x10, 0x5f, 0x13, 0x3e, 0xf0, 0x59, 0x95, 0xbe, 0x08, 0x4a, 0xf7, 0x3d,
-  0xcf, 0x40, 0x75, 0x3e, 0xdf, 0xed, 0x7b, 0xbe, 0x96, 0xa9, 0x41, 0x3e,
-  0xd1, 0x7d, 0xbe, 0x3d, 0x85, 0xa4, 0x9d, 0xbe, 0x4f, 0x0a, 0x13, 0xbe,
-  0x31, 0xc5, 0x10, 0xbe, 0x4f, 0x53, 0x6d, 0xbe, 0xb5, 0xd6, 0x8d, 0x3e,
-  0x1c, 0x08, 0x0a, 0xbe, 0x50, 0xb9, 0x22, 0xbd, 0x78, 0xea, 0x97, 0xbc,
-  0x44, 0x8c, 0xd2, 0xbc, 0x2f, 0xfb, 0x4d, 0x3e, 0x34, 0x28, 0x73, 0xbe,
-  0x8c, 0x60, 0x1f, 0xbe, 0x29, 0xda, 0xa1, 0x3e, 0xa9, 0x3e, 0xa1, 0xbe,
-  0x2c, 0x54, 0x1c, 0x3e, 0x26, 0x2f, 0x97, 0x3e, 0xd4, 0x03, 0xad, 0x3e,
-  0xe6, 0xbf, 0x98, 0x3e, 0x6c, 0xce, 0xa5, 0x3e, 0x1a, 0xb7, 0xb7, 0x3e,
-  0x3d, 0xee, 0xf2, 0x3d, 0xcd, 0x7d, 0xb9, 0xbd, 0x93, 0xd2, 0x89, 0xbe,
-  0x83, 0x20, 0x6b, 0x3e, 0x2e, 0xbf, 0x3c, 0xbe, 0xee, 0x75, 0xe9, 0x3c,
-  0x48, 0xef, 0x69, 0xbd, 0xc2, 0x8e, 0x45, 0x3e, 0x5e, 0xd5, 0x74, 0x3e,
-  0x51, 0xe3, 0x62, 0xbe, 0xc0, 0xf1, 0x8d, 0x3e, 0x12, 0xa3, 0xb5, 0xbd,
-  0x9c, 0xdc, 0xaa, 0x3e, 0xf0, 0xfc, 0x43, 0x3e, 0xf1, 0x71, 0x3c, 0x3e,
-  0x29, 0xc6, 0x03, 0x3e, 0x78, 0xb7, 0x9c, 0x3d, 0x07, 0x3a, 0xae, 0x3e,
-  0x24, 0xc8, 0xeb, 0x3d, 0xcf, 0x59, 0xaa, 0x3e, 0xda, 0xc8, 0xa3, 0x3e,
-  0x63, 0x17, 0x61, 0xbd, 0x92, 0x38, 0x0f, 0xbe, 0x51, 0x1f, 0x56, 0xbe,
-  0xdd, 0x12, 0x27, 0xbe, 0x73, 0x2a, 0xa1, 0x3e, 0xee, 0x3e, 0xaf, 0x3e,
-  0x3b, 0x34, 0x48, 0xbd, 0xdc, 0xcb, 0x94, 0x3d, 0x47, 0x6c, 0x8c, 0xbe,
-  0x0b, 0x5a, 0xbc, 0x3d, 0x20, 0xc0, 0x6e, 0x3e, 0x04, 0x3a, 0x12, 0x39,
-  0x76, 0x5e, 0x07, 0xbe, 0xb5, 0xa0, 0x2e, 0xbe, 0x00, 0x2a, 0x4c, 0xbe,
-  0xb7, 0xff, 0x7c, 0x3e, 0x25, 0x2a, 0xbd, 0x3e, 0xf0, 0x43, 0x46, 0xbe,
-  0xd8, 0x11, 0x1e, 0xbe, 0x08, 0x35, 0x91, 0x3e, 0xa4, 0x81, 0x1d, 0xbe,
-  0x6f, 0x1c, 0x7c, 0xbd, 0x4d, 0x1d, 0x0c, 0x3d, 0xd0, 0xb7, 0x11, 0x3e,
-  0xa5, 0x6c, 0x33, 0x3e, 0x84, 0x60, 0xbc, 0xbd, 0x0a, 0x66, 0x1c, 0x3e,
-  0x8f, 0x4d, 0x81, 0x3e, 0xf8, 0xa0, 0xd9, 0x3d, 0x86, 0xd1, 0x96, 0xbe,
-  0x23, 0x6b, 0xd3, 0xbd, 0x32, 0x78, 0x1d, 0x3e, 0xa0, 0x16, 0x6e, 0xbe,
-  0xdb, 0x3b, 0x92, 0x3e, 0x80, 0x9c, 0x7d, 0x3d, 0x2a, 0x4a, 0x3d, 0x3d,
-  0x8c, 0x72, 0x98, 0x3e, 0xc1, 0xad, 0x39, 0x3e, 0xcb, 0x01, 0xd2, 0xbe,
-  0xa7, 0xcc, 0x4c, 0xbd, 0xd8, 0xbf, 0x79, 0xbe, 0xf4, 0x0d, 0x6e, 0xbe,
-  0x9a, 0xe2, 0xa5, 0x3e, 0x22, 0x76, 0x6f, 0xbe, 0xd5, 0xf7, 0xe6, 0x3d,
-  0x73, 0x99, 0x45, 0xbe, 0x21, 0xb8, 0xb5, 0x3e, 0xb5, 0xdd, 0x2f, 0xbe,
-  0x6e, 0xed, 0x1c, 0xbe, 0x06, 0x72, 0x41, 0xbe, 0x00, 0x8a, 0x41, 0xbe,
-  0x4f, 0x39, 0x8d, 0xbe, 0x55, 0x17, 0x83, 0xbe, 0x44, 0x19, 0xc9, 0xbd,
-  0x00, 0x3e, 0xdd, 0xbc, 0x90, 0xc4, 0xbc, 0x3c, 0x1a, 0x44, 0x28, 0x3e,
-  0xd5, 0x6e, 0x88, 0x3e, 0x11, 0x31, 0x8d, 0xbe, 0x5f, 0xa8, 0xa4, 0x3e,
-  0x49, 0xb8, 0x90, 0xbe, 0x62, 0x73, 0x50, 0x3e, 0x78, 0xcd, 0xff, 0x3d,
-  0x8c, 0x03, 0x53, 0x3e, 0x57, 0x01, 0xa9, 0xbe, 0x18, 0x6e, 0x70, 0xbd,
-  0x0e, 0x0c, 0x1f, 0x3e, 0xf8, 0xcb, 0x29, 0x3d, 0x2b, 0x4e, 0x9e, 0xbd,
-  0xeb, 0x16, 0xd8, 0xbd, 0xfa, 0xb8, 0x06, 0x3e, 0x30, 0xab, 0x05, 0x3d,
-  0x1a, 0x74, 0x51, 0xbe, 0x76, 0x54, 0x24, 0xbe, 0xdd, 0x3d, 0xa6, 0xbe,
-  0x10, 0x5e, 0x80, 0x3c, 0xa9, 0x66, 0x8e, 0xbe, 0x49, 0x72, 0x32, 0x3e,
-  0xb0, 0xf2, 0xc1, 0xbd, 0xeb, 0x30, 0x09, 0xbe, 0x54, 0x66, 0xe2, 0xbb,
-  0x6f, 0x08, 0x64, 0xbe, 0xc0, 0xbc, 0x86, 0x3d, 0x26, 0x6d, 0xef, 0x3d,
-  0xe6, 0x38, 0x8c, 0xba, 0x42, 0x4c, 0xc0, 0x3e, 0x4f, 0x6c, 0x81, 0x3e,
-  0x38, 0x5e, 0x85, 0xbc, 0xdf, 0x9b, 0xd0, 0xbb, 0x69, 0x09, 0xc7, 0xbe,
-  0x9b, 0x1e, 0xb3, 0x3d, 0xeb, 0x38, 0x10, 0x3d, 0x86, 0xc0, 0x84, 0x3e,
-  0x39, 0x38, 0x5e, 0x3e, 0x48, 0xb7, 0x74, 0x3e, 0xa2, 0x8d, 0xd5, 0xbd,
-  0x8c, 0x67, 0x62, 0x3d, 0x4f, 0x9d, 0x87, 0xbe, 0xd9, 0xa4, 0x92, 0x3e,
-  0xef, 0x4c, 0xcd, 0x3d, 0x25, 0x67, 0xa4, 0x3e, 0x64, 0x24, 0x75, 0xbe,
-  0xfb, 0x07, 0x24, 0x3e, 0xf8, 0x12, 0xe5, 0x3d, 0x7c, 0x0c, 0xaa, 0x3e,
-  0xf6, 0xe5, 0xf0, 0x3c, 0xf9, 0x6d, 0x7d, 0x3e, 0x52, 0xed, 0x8f, 0x3e,
-  0xa8, 0x5f, 0x95, 0x3e, 0x12, 0xb0, 0xc3, 0x3e, 0x5d, 0x09, 0x7f, 0xbd,
-  0xe0, 0xd6, 0xbd, 0x3d, 0x40, 0xb0, 0xa3, 0x3d, 0x80, 0x88, 0x16, 0xbe,
-  0x8c, 0x5f, 0xec, 0xbd, 0xa0, 0x8b, 0xae, 0x3d, 0x2a, 0x9b, 0xec, 0xbd,
-  0x16, 0x91, 0xad, 0xbe, 0x76, 0xa3, 0x4b, 0x3e, 0xcf, 0xe4, 0xae, 0xbe,
-  0x63, 0xb6, 0x46, 0xbe, 0xeb, 0xa0, 0x5e, 0xbe, 0xf3, 0x1d, 0x87, 0xbe,
-  0xde, 0x70, 0x3e, 0x3e, 0xef, 0xf0, 0x40, 0xbe, 0x3d, 0x38, 0x35, 0xbe,
-  0x28, 0x56, 0x03, 0x3e, 0xd3, 0x77, 0x14, 0xbe, 0x38, 0x30, 0x03, 0xbe,
-  0xea, 0x11, 0x68, 0x3e, 0x41, 0x06, 0x91, 0xbe, 0x7d, 0x9b, 0xa6, 0x3d,
-  0xb0, 0x36, 0x91, 0x3e, 0xe7, 0x98, 0xa7, 0xbe, 0x18, 0x51, 0xb7, 0xbe,
-  0x0b, 0x9c, 0x7b, 0x3e, 0x06, 0x30, 0x96, 0x3e, 0xcb, 0x50, 0x14, 0xbe,
-  0x00, 0xdd, 0x7e, 0xbe, 0x82, 0x95, 0x53, 0x3e, 0x93, 0xb1, 0x83, 0x3e,
-  0x1c, 0x67, 0x06, 0xbe, 0xa6, 0xde, 0x04, 0xbe, 0x5d, 0xd9, 0x9a, 0xbd,
-  0xea, 0xe0, 0xbc, 0xbc, 0x9f, 0xf7, 0x92, 0x3e, 0xb0, 0x85, 0x09, 0xbd,
-  0x3b, 0x56, 0xaf, 0x3c, 0xf2, 0x0c, 0xc3, 0x3e, 0x5a, 0x66, 0x07, 0x3e,
-  0x85, 0x8d, 0xb2, 0xbe, 0xf0, 0xec, 0x07, 0xbe, 0xd0, 0xa7, 0x14, 0x3e,
-  0x96, 0x09, 0x78, 0x3e, 0xe9, 0x81, 0xe8, 0xbc, 0x10, 0x78, 0x8f, 0xbe,
-  0x90, 0x14, 0x45, 0x3e, 0x67, 0x74, 0x32, 0xbe, 0xaa, 0x20, 0xab, 0x3e,
-  0xa5, 0x67, 0xb7, 0xbe, 0xd0, 0x9a, 0xcd, 0x3e, 0x31, 0x10, 0x18, 0x3e,
-  0xf8, 0x64, 0xa2, 0xbd, 0xe5, 0xb5, 0x30, 0xbe, 0x35, 0x1a, 0x70, 0xbe,
-  0x34, 0x53, 0x93, 0x3e, 0x87, 0x07, 0xb3, 0x3d, 0x23, 0x64, 0x84, 0x3e,
-  0xec, 0xc0, 0x86, 0x3e, 0xd5, 0xf3, 0x6b, 0xbe, 0x1c, 0x02, 0x86, 0x3d,
-  0xf0, 0xf6, 0x1b, 0x3e, 0x76, 0x65, 0x89, 0x3e, 0x93, 0x90, 0x2c, 0xbe,
-  0xbb, 0x21, 0x9f, 0xbd, 0x23, 0x2f, 0xd5, 0x3e, 0x0c, 0xcd, 0x9e, 0x3e,
-  0xfd, 0x1a, 0x9a, 0x3d, 0x7e, 0x40, 0x29, 0x3e, 0x6d, 0xcc, 0xe7, 0x3d,
-  0xd2, 0x04, 0x28, 0xbd, 0x91, 0x14, 0x10, 0xbe, 0xdf, 0x44, 0x02, 0xbe,
-  0x18, 0x9e, 0x50, 0xbe, 0x06, 0x09, 0x8f, 0x3e, 0xdd, 0x7f, 0xfe, 0x3d,
-  0xf8, 0xe7, 0x39, 0x3e, 0xaa, 0x4e, 0xef, 0x3d, 0xf4, 0xcc, 0x60, 0xbe,
-  0x90, 0x71, 0x3f, 0x3c, 0x70, 0xb2, 0xaf, 0x3d, 0x7b, 0xff, 0xb8, 0x3e,
-  0x09, 0x81, 0xec, 0x3d, 0x14, 0xc8, 0x86, 0x3e, 0x2c, 0xd7, 0x9b, 0xbe,
-  0x34, 0xbd, 0x16, 0xbd, 0xb7, 0xec, 0xb6, 0xbe, 0x54, 0x87, 0x3e, 0xbd,
-  0x2e, 0xd2, 0x3c, 0xbd, 0x42, 0x01, 0x00, 0xbe, 0xcf, 0x64, 0x26, 0x3d,
-  0xae, 0xfa, 0xc3, 0x3e, 0xf0, 0x07, 0x5b, 0x3e, 0x2e, 0x80, 0x8f, 0x3e,
-  0xc6, 0x01, 0x83, 0x3e, 0x0d, 0x80, 0x16, 0x3e, 0x48, 0x45, 0x7f, 0x3d,
-  0xdf, 0x93, 0x15, 0x3e, 0x6d, 0x2d, 0x81, 0x3e, 0xf2, 0x0b, 0xcc, 0x3d,
-  0x30, 0x1e, 0xf1, 0x3c, 0x7b, 0x49, 0x99, 0x3e, 0x59, 0xdf, 0xb1, 0xbe,
-  0xa2, 0xa8, 0xb1, 0xbe, 0x36, 0xf3, 0x22, 0xbe, 0x6b, 0x54, 0xa4, 0xbd,
-  0xd4, 0x15, 0x53, 0xbe, 0xcf, 0x5b, 0x95, 0x3e, 0x4f, 0x3e, 0x4b, 0x3e,
-  0xcd, 0x7b, 0x13, 0xbd, 0xdf, 0x2a, 0xb4, 0x3e, 0xd8, 0x76, 0x0a, 0xbf,
-  0xe1, 0x4f, 0x87, 0xbe, 0x7b, 0x46, 0x80, 0x3e, 0xd3, 0x76, 0x2d, 0x3d,
-  0x53, 0xd3, 0xaa, 0xbe, 0x08, 0x82, 0x48, 0x3d, 0xbc, 0x3a, 0x65, 0x3e,
-  0x66, 0x6f, 0xe2, 0x3e, 0x94, 0x54, 0x84, 0xbd, 0x19, 0x8f, 0x0b, 0xbe,
-  0x3d, 0x1c, 0x9c, 0x3e, 0x7f, 0x30, 0x19, 0xbe, 0x7c, 0x24, 0xa1, 0x3d,
-  0x18, 0x4d, 0xc4, 0xbe, 0x00, 0x03, 0xdc, 0x3d, 0xa3, 0xe6, 0x1a, 0xbd,
-  0xda, 0x73, 0xb0, 0x3e, 0x7c, 0x6d, 0x8e, 0x3c, 0x4a, 0x3d, 0xa6, 0x3c,
-  0xc9, 0x9b, 0x56, 0x3e, 0x32, 0xe8, 0x61, 0xbe, 0x2c, 0x1e, 0x11, 0x3e,
-  0x28, 0x69, 0x87, 0xbe, 0xff, 0xe8, 0x27, 0x3c, 0x23, 0xff, 0xaf, 0x3d,
-  0xd4, 0xcf, 0xc5, 0x3e, 0x19, 0xf7, 0x89, 0x3e, 0x0b, 0x19, 0x92, 0xbe,
-  0x0b, 0x9d, 0xf5, 0x3d, 0x35, 0xcc, 0x95, 0x3e, 0xcf, 0x75, 0x8b, 0xbc,
-  0x29, 0x38, 0x6d, 0x3e, 0x4c, 0x32, 0x2f, 0xbe, 0x1c, 0x3d, 0x57, 0x3d,
-  0x0a, 0x8f, 0x00, 0x3d, 0xa7, 0x63, 0x88, 0xbe, 0xf0, 0x31, 0x8a, 0xbc,
-  0xa0, 0xf9, 0x58, 0x3d, 0xa8, 0x50, 0x67, 0xbe, 0x8f, 0x1b, 0xc3, 0x3c,
-  0x26, 0xf7, 0x1e, 0xbe, 0x4a, 0xc7, 0x34, 0xbe, 0xa0, 0x6c, 0xa2, 0xbd,
-  0x54, 0xa2, 0x9a, 0xbe, 0xee, 0x23, 0x66, 0x3e, 0xaa, 0x7e, 0x6e, 0x3d,
-  0x88, 0x9a, 0x80, 0x3d, 0x84, 0x29, 0xbb, 0xbe, 0x92, 0x51, 0x83, 0xbe,
-  0x6b, 0x8c, 0x54, 0xbe, 0xfe, 0xfc, 0x4d, 0xbe, 0xd2, 0x6b, 0x10, 0x3e,
-  0xa3, 0x9b, 0x25, 0x3e, 0x38, 0x9e, 0x81, 0xbd, 0x70, 0xba, 0x88, 0xbe,
-  0xb7, 0xfd, 0x08, 0x3e, 0xb1, 0x5d, 0x8a, 0xbe, 0xa4, 0x24, 0xfa, 0xbd,
-  0xf9, 0x66, 0xa5, 0x3e, 0x6f, 0xfb, 0x74, 0x3e, 0x66, 0x82, 0x53, 0x3e,
-  0xdf, 0x02, 0x78, 0x3c, 0x9a, 0x97, 0x14, 0x3e, 0xb8, 0x56, 0xc2, 0x3e,
-  0x28, 0xb1, 0x9d, 0xbe, 0xf2, 0x34, 0x07, 0x3e, 0x64, 0x5b, 0x29, 0xbd,
-  0xa2, 0xeb, 0xa6, 0x3e, 0xdd, 0x5f, 0x79, 0xbc, 0x4e, 0xc8, 0x08, 0x3e,
-  0xf3, 0xde, 0x63, 0xbc, 0xa9, 0x31, 0x70, 0x3e, 0x52, 0x1f, 0x9b, 0xbd,
-  0x13, 0x06, 0xc0, 0x3e, 0xd3, 0x95, 0x8e, 0x3e, 0xe6, 0x2d, 0xcf, 0xbd,
-  0xec, 0x46, 0x69, 0xbe, 0xf0, 0xa6, 0xc4, 0xbd, 0xd1, 0x43, 0xee, 0x3d,
-  0x4f, 0x19, 0x44, 0x3e, 0x21, 0x32, 0xe9, 0xbd, 0x7d, 0xdd, 0x38, 0xbe,
-  0xbd, 0xd0, 0x6d, 0xbe, 0xc2, 0x71, 0x4c, 0xbd, 0x45, 0xd3, 0x95, 0xbc,
-  0x96, 0x9a, 0xe4, 0xbd, 0x5d, 0xb7, 0x7d, 0xbe, 0xfd, 0x67, 0x63, 0xbd,
-  0xfa, 0x93, 0x37, 0x3e, 0x37, 0x68, 0x30, 0xbe, 0x34, 0x60, 0x45, 0x3e,
-  0x94, 0x42, 0x02, 0x3d, 0xef, 0x0d, 0x5f, 0x3c, 0x79, 0x79, 0xa6, 0x3e,
-  0xce, 0x87, 0x13, 0x3e, 0x02, 0xb8, 0xe4, 0x3c, 0xc9, 0xb9, 0x7e, 0xbe,
-  0xe8, 0x5b, 0x4c, 0x3e, 0xa6, 0x3c, 0xa3, 0x3e, 0xe3, 0xf6, 0x93, 0x3d,
-  0x78, 0xf0, 0xfa, 0xbd, 0xe6, 0x6c, 0x55, 0x3e, 0x8d, 0xd6, 0x9d, 0x3e,
-  0x27, 0x8d, 0xda, 0x3d, 0x4f, 0x32, 0x60, 0xbe, 0x6c, 0xc8, 0x92, 0xbe,
-  0xb4, 0x47, 0x73, 0x3e, 0x36, 0x2e, 0xc3, 0xbd, 0x08, 0x99, 0xe9, 0x3d,
-  0xcb, 0x33, 0xab, 0x3e, 0x8b, 0x37, 0x9b, 0xbe, 0xe5, 0x51, 0x4d, 0x3e,
-  0xc0, 0xfc, 0x86, 0xbe, 0x9d, 0x31, 0x7c, 0x3e, 0xe2, 0x43, 0x9b, 0x3e,
-  0xf5, 0x88, 0xbb, 0x3e, 0xaa, 0xb4, 0x9e, 0xbe, 0xcc, 0x8c, 0x86, 0xbe,
-  0xbe, 0x03, 0x9e, 0x3e, 0x7b, 0x77, 0x8c, 0xbe, 0x64, 0x79, 0x41, 0x3c,
-  0x81, 0x8a, 0x97, 0xbe, 0x9c, 0x79, 0x37, 0xbe, 0x13, 0x4e, 0x89, 0x3e,
-  0x0e, 0x78, 0xae, 0x3e, 0x97, 0xc1, 0x75, 0xbe, 0x0a, 0x67, 0x8c, 0xbe,
-  0x10, 0x7b, 0x8c, 0x3e, 0x81, 0x7f, 0xba, 0xbd, 0x88, 0x66, 0x13, 0x3e,
-  0x9e, 0x92, 0x9f, 0xbe, 0x1d, 0xef, 0x78, 0xbe, 0x9a, 0x6d, 0x3a, 0x3e,
-  0x66, 0x47, 0x13, 0x3e, 0xf6, 0xb8, 0x85, 0xbe, 0xf4, 0x6f, 0xb3, 0xbd,
-  0x08, 0x56, 0xc4, 0xbd, 0x4f, 0xef, 0x1c, 0xbe, 0x12, 0x03, 0x78, 0x3e,
-  0x3a, 0x28, 0x2c, 0x3e, 0xb4, 0x79, 0x8d, 0x3d, 0x00, 0xe8, 0x29, 0xbd,
-  0x6f, 0x9a, 0x57, 0xbe, 0xb2, 0x05, 0x43, 0x3e, 0x90, 0x7b, 0xc2, 0xbd,
-  0x5b, 0x97, 0x37, 0xbe, 0xf3, 0x63, 0x53, 0xbd, 0x2b, 0x91, 0x1f, 0x3e,
-  0x05, 0x50, 0x6b, 0xbe, 0x08, 0x40, 0xbf, 0xbd, 0x3b, 0x46, 0x92, 0xbd,
-  0x8f, 0x95, 0x3a, 0x3e, 0xde, 0x45, 0x9f, 0x3e, 0x0c, 0x0f, 0xb6, 0xbe,
-  0x74, 0xfd, 0xe7, 0xbd, 0xef, 0xf9, 0x81, 0x3d, 0xfa, 0x1a, 0x24, 0x3d,
-  0xdd, 0x95, 0x67, 0x3e, 0x6e, 0x75, 0x19, 0xbe, 0x8e, 0x4b, 0x63, 0x3e,
-  0x37, 0xb6, 0x16, 0x3e, 0x9c, 0xf8, 0x41, 0x3e, 0x9f, 0x8f, 0xaf, 0x3e,
-  0x01, 0x21, 0x58, 0xbe, 0x42, 0xda, 0x28, 0x3c, 0xe8, 0xf2, 0x7a, 0xbe,
-  0xb8, 0x80, 0x7d, 0x3d, 0xd6, 0xe3, 0xd8, 0x3c, 0xd1, 0x5d, 0xf5, 0x3d,
-  0x3f, 0xc7, 0x0b, 0x3e, 0x3f, 0x88, 0xa9, 0x3c, 0x0c, 0xa1, 0x3f, 0xbe,
-  0xaa, 0x9e, 0xbe, 0x3e, 0x04, 0xae, 0x99, 0x3e, 0x8b, 0x2d, 0xad, 0xbc,
-  0x2a, 0x5c, 0x99, 0x3e, 0xfd, 0xdb, 0x90, 0xbd, 0x1c, 0xf1, 0x21, 0xbe,
-  0xd7, 0xbd, 0x6b, 0xbe, 0x43, 0x70, 0x83, 0xbe, 0x48, 0x3b, 0xa6, 0xbd,
-  0xb8, 0x81, 0x64, 0xbd, 0xe7, 0x40, 0x3d, 0xbe, 0xfd, 0x54, 0x5a, 0xbe,
-  0xf0, 0x48, 0xb1, 0xbd, 0xd6, 0x43, 0x8d, 0xbe, 0x36, 0x0e, 0x6f, 0x3e,
-  0x78, 0xba, 0x29, 0x3d, 0x18, 0x7e, 0xa3, 0xbd, 0x62, 0x49, 0xf0, 0xbd,
-  0x8c, 0x4a, 0x76, 0xbe, 0xf0, 0xb6, 0xfa, 0x3d, 0x10, 0xd9, 0x06, 0x3e,
-  0xe7, 0x27, 0x89, 0x3e, 0xf2, 0xdf, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x20, 0x00, 0x00, 0x28, 0x2e, 0x3a, 0xbe, 0xd6, 0xf6, 0xc7, 0xbe,
-  0xf4, 0xf3, 0x22, 0xbe, 0xf7, 0x49, 0xb2, 0xbd, 0x1a, 0xd7, 0x2f, 0x3e,
-  0xf7, 0x17, 0x8d, 0x3e, 0xf7, 0x0b, 0xb0, 0xbe, 0x5e, 0xaf, 0x20, 0x3d,
-  0x07, 0x1c, 0x22, 0xbe, 0xe8, 0x19, 0xe6, 0x3d, 0x00, 0x9e, 0x57, 0xbd,
-  0xfc, 0xe8, 0xee, 0xbd, 0x06, 0x8b, 0x12, 0x3e, 0x60, 0x71, 0x24, 0x3e,
-  0xcd, 0x27, 0x21, 0xbe, 0xf3, 0xe0, 0x96, 0x3d, 0x61, 0x8c, 0x4b, 0xbd,
-  0xba, 0xba, 0x82, 0xbe, 0x5a, 0x0d, 0xac, 0x3d, 0x6a, 0x2d, 0x69, 0xbe,
-  0x39, 0x71, 0xa6, 0xbe, 0x67, 0x6d, 0x05, 0x3d, 0x78, 0x7f, 0xf0, 0x3d,
-  0x2a, 0x33, 0xc4, 0x3d, 0xe5, 0x90, 0x54, 0xbe, 0xc6, 0xc4, 0x49, 0x3e,
-  0xf1, 0xf3, 0x8f, 0xbb, 0x6b, 0x7a, 0xa9, 0xbd, 0x88, 0xd0, 0x36, 0xbe,
-  0x02, 0x27, 0x26, 0x3e, 0x60, 0x91, 0xb4, 0x3c, 0x30, 0xf3, 0x68, 0xbe,
-  0x54, 0x1f, 0xe2, 0x3c, 0x0b, 0x7e, 0xee, 0x3d, 0x20, 0x2b, 0xa2, 0xbd,
-  0x56, 0x9e, 0xa3, 0x3c, 0x72, 0xe2, 0x35, 0x3d, 0x31, 0xf7, 0x01, 0xbe,
-  0x53, 0x38, 0xf2, 0x3d, 0xed, 0xe0, 0xdc, 0x3d, 0xd7, 0xf2, 0x2e, 0xbe,
-  0x00, 0x13, 0x23, 0xbe, 0x67, 0x81, 0x01, 0xbd, 0x8d, 0x0a, 0x9c, 0x3c,
-  0x83, 0xe3, 0x72, 0x3e, 0x90, 0xc5, 0x09, 0x3e, 0x3e, 0xba, 0x17, 0xbe,
-  0xbb, 0x04, 0xe9, 0xbd, 0x1e, 0xb8, 0x29, 0x3e, 0xfa, 0x5f, 0xa5, 0xbd,
-  0xa2, 0xea, 0x20, 0x3e, 0xde, 0x0c, 0x2f, 0xbe, 0x40, 0xfb, 0x5a, 0x3e,
-  0xb3, 0x11, 0x99, 0x3e, 0xc9, 0xbd, 0x85, 0xbe, 0x0d, 0x98, 0x40, 0xbd,
-  0x3c, 0xf7, 0xad, 0x3e, 0x7f, 0x95, 0xa1, 0xbe, 0xee, 0x5c, 0xcd, 0xbd,
-  0x42, 0x31, 0x60, 0xbc, 0x30, 0x49, 0x8e, 0xbd, 0xae, 0xe0, 0x5e, 0xbe,
-  0x1b, 0xf7, 0xf6, 0x3d, 0x50, 0x6e, 0x22, 0xbd, 0x1e, 0x02, 0xc9, 0xba,
-  0xed, 0x92, 0x22, 0xbe, 0x20, 0x71, 0x50, 0xbe, 0x36, 0x79, 0x2e, 0x3e,
-  0xb0, 0x2f, 0x8d, 0x3e, 0x8a, 0x25, 0x54, 0x3e, 0xd3, 0xa4, 0x26, 0xbe,
-  0x4c, 0xf7, 0x43, 0x3d, 0xb0, 0x92, 0xdf, 0x3b, 0x44, 0x2f, 0x4c, 0xbe,
-  0x57, 0xd7, 0xd2, 0xbd, 0x60, 0xbb, 0xf1, 0xbc, 0xac, 0x26, 0xde, 0x3c,
-  0xd8, 0x99, 0x3c, 0x3e, 0x25, 0x3e, 0x02, 0xbe, 0x62, 0x9d, 0xfc, 0x3d,
-  0x88, 0x7c, 0x44, 0x3e, 0xc3, 0xb1, 0x22, 0xbe, 0x5f, 0x15, 0x35, 0x3e,
-  0x05, 0x62, 0xe0, 0x3b, 0x0e, 0xa0, 0xf6, 0xbc, 0x14, 0xa8, 0xf5, 0x3d,
-  0x61, 0x82, 0x31, 0xbe, 0xec, 0xeb, 0x78, 0x3e, 0xc7, 0x6d, 0xd0, 0xbc,
-  0xf8, 0x97, 0xa9, 0x3e, 0x42, 0x74, 0x65, 0x3e, 0x23, 0xc3, 0xe7, 0x3d,
-  0x90, 0xff, 0x14, 0xbe, 0x7b, 0x0c, 0xc8, 0x3d, 0xbf, 0xc3, 0xf4, 0xbd,
-  0x80, 0xb0, 0xba, 0xbc, 0x67, 0xb2, 0x54, 0xbe, 0x5a, 0x4d, 0x96, 0x3d,
-  0x90, 0xae, 0xa0, 0x3d, 0x07, 0x19, 0x01, 0x3c, 0x89, 0x6d, 0x1a, 0xbe,
-  0x5d, 0xd1, 0x4d, 0x3b, 0x10, 0xdb, 0xe0, 0x3d, 0x9c, 0x50, 0x15, 0xbd,
-  0xf6, 0x3a, 0x07, 0xbe, 0x08, 0x54, 0x40, 0xbe, 0x7e, 0x34, 0xae, 0xbd,
-  0x29, 0x93, 0x21, 0x3e, 0xd6, 0xcd, 0x20, 0xbe, 0x50, 0xa6, 0x7a, 0x3d,
-  0x9c, 0x03, 0x12, 0x3e, 0xe8, 0xcf, 0x1e, 0xbe, 0x6b, 0x12, 0xc6, 0x3d,
-  0x69, 0x41, 0x40, 0x3e, 0xf6, 0x7c, 0x13, 0x3e, 0xd1, 0x0d, 0x85, 0xbe,
-  0x7d, 0x7d, 0xf8, 0x3d, 0x6e, 0xd3, 0x91, 0xbd, 0x5f, 0x88, 0x02, 0x3c,
-  0xee, 0x33, 0x06, 0x3e, 0x48, 0xbd, 0x61, 0xbe, 0x0f, 0xec, 0x57, 0xbe,
-  0x9e, 0x77, 0x3a, 0x3e, 0xa5, 0x06, 0x91, 0x3d, 0xb0, 0x73, 0xe5, 0xbd,
-  0xc4, 0x08, 0x46, 0xbe, 0xbb, 0x67, 0x3f, 0x3d, 0xb0, 0xa6, 0x42, 0xbe,
-  0xcb, 0xf4, 0x0b, 0xbe, 0x00, 0x40, 0xb4, 0x3a, 0xd0, 0xdc, 0x95, 0xbd,
-  0xeb, 0xf4, 0x77, 0x3e, 0xe7, 0xc2, 0xd0, 0x3d, 0x2e, 0xa7, 0x5c, 0xbe,
-  0xcd, 0x0c, 0x8f, 0xbd, 0xeb, 0xca, 0x96, 0xbd, 0xc0, 0x15, 0x78, 0x3d,
-  0x00, 0x92, 0x5b, 0x3e, 0x80, 0xd6, 0x52, 0x3e, 0x8b, 0xd7, 0x46, 0x3e,
-  0x6f, 0x38, 0x64, 0x3c, 0x00, 0x18, 0x22, 0x3c, 0x54, 0x82, 0x5f, 0xbe,
-  0x0b, 0x1d, 0xa3, 0x3d, 0xd0, 0x9c, 0x2d, 0xbe, 0x00, 0x04, 0x51, 0x3b,
-  0xb0, 0x0d, 0xe6, 0x3c, 0x50, 0x5a, 0xa2, 0x3d, 0x98, 0xd6, 0x31, 0xbe,
-  0xf5, 0x0b, 0x6e, 0xbe, 0xcc, 0x77, 0x63, 0xbe, 0xe4, 0x73, 0x95, 0x3d,
-  0x11, 0x01, 0xcd, 0xbc, 0xff, 0x50, 0x14, 0x3d, 0x76, 0x9f, 0x0e, 0xbd,
-  0xec, 0xd2, 0x62, 0x3c, 0x80, 0x7f, 0x03, 0xbc, 0xd5, 0x99, 0xb9, 0x3d,
-  0xed, 0x86, 0xfd, 0x3d, 0x84, 0x15, 0x6c, 0xbe, 0x8a, 0x9f, 0xf5, 0xbd,
-  0x88, 0x75, 0x2c, 0xbe, 0xc0, 0xf6, 0x97, 0x3d, 0xac, 0x28, 0x6d, 0x3e,
-  0x4b, 0xdd, 0x2e, 0xbd, 0x4d, 0x5f, 0x68, 0x3e, 0xb2, 0x5a, 0xa0, 0xbd,
-  0xb9, 0x6b, 0x3c, 0xbe, 0x1a, 0x67, 0x97, 0xbd, 0xc0, 0xf7, 0x0a, 0x3e,
-  0x4e, 0xdc, 0x1b, 0x3c, 0xdc, 0x43, 0xff, 0x3d, 0x68, 0xcb, 0x00, 0x3e,
-  0x94, 0x09, 0x73, 0x3e, 0xb6, 0x09, 0xd4, 0xba, 0xfa, 0x55, 0x61, 0x3d,
-  0x92, 0xde, 0x65, 0x3e, 0xf1, 0xe9, 0x2d, 0x3e, 0x5c, 0x31, 0x6e, 0x3e,
-  0xbd, 0x4c, 0x6f, 0x3e, 0x37, 0x1a, 0xbf, 0xbb, 0x2a, 0xa9, 0xe2, 0xbd,
-  0xb4, 0x4b, 0x97, 0xbd, 0x5e, 0x8e, 0xc2, 0x3c, 0xff, 0xd5, 0xfa, 0x3d,
-  0x4a, 0xfa, 0x34, 0x3c, 0xb9, 0x6a, 0xea, 0xbd, 0xe9, 0x54, 0x17, 0xba,
-  0x04, 0x19, 0x42, 0x3e, 0x06, 0xa3, 0x22, 0xbd, 0xeb, 0xcf, 0xe2, 0x3d,
-  0xf4, 0x23, 0x3f, 0x3e, 0xc2, 0x69, 0xec, 0x3d, 0x70, 0xe7, 0x0e, 0xbe,
-  0xb0, 0x54, 0x4b, 0xbe, 0x28, 0xa4, 0x00, 0xbd, 0x4f, 0xc5, 0x87, 0x3e,
-  0xd4, 0x33, 0xaf, 0x3d, 0x95, 0x31, 0x67, 0xbe, 0x69, 0x0b, 0x69, 0x3e,
-  0x92, 0x73, 0x5c, 0x3a, 0xe0, 0xbd, 0xbb, 0xbc, 0x30, 0x35, 0xc9, 0x3d,
-  0xc2, 0x0a, 0x0e, 0x3d, 0xbc, 0x06, 0x2b, 0xbe, 0x1c, 0xa5, 0x01, 0xbe,
-  0x75, 0x9d, 0x56, 0x3e, 0x61, 0x8b, 0x8a, 0xbe, 0xdd, 0xa0, 0x8e, 0x3c,
-  0x1c, 0x41, 0x0a, 0xbe, 0xeb, 0x81, 0x69, 0x3d, 0x69, 0x95, 0x8f, 0x3e,
-  0xc4, 0x78, 0x7b, 0x3d, 0x41, 0xe4, 0x16, 0xbe, 0xc0, 0xe0, 0x1c, 0xbc,
-  0x34, 0xa8, 0x58, 0x3c, 0xf7, 0x84, 0x45, 0xbe, 0xc4, 0x15, 0x6b, 0xbe,
-  0x44, 0xc9, 0xeb, 0xbd, 0xcc, 0xf7, 0x04, 0xbb, 0x28, 0xf9, 0x74, 0xbe,
-  0x88, 0x57, 0x0c, 0x3e, 0x8c, 0x7b, 0xe4, 0xbc, 0xe0, 0xde, 0x9c, 0xbd,
-  0x6a, 0x13, 0xd3, 0x3d, 0xaa, 0xcd, 0x08, 0x3e, 0x3c, 0x77, 0x69, 0xbe,
-  0xd3, 0x0a, 0xa6, 0xbc, 0x4f, 0xae, 0x01, 0xbe, 0x94, 0x31, 0x36, 0x3e,
-  0x9b, 0x56, 0x76, 0x3e, 0xe1, 0xe6, 0x33, 0xbe, 0x45, 0xe9, 0x74, 0x3e,
-  0xd4, 0x71, 0x30, 0x3e, 0xd1, 0x3f, 0xb4, 0x3b, 0x6e, 0xa3, 0x16, 0xbe,
-  0x7c, 0x00, 0x65, 0x3e, 0x90, 0x5d, 0x0d, 0xbd, 0x91, 0xfe, 0xd2, 0xbd,
-  0xed, 0x8f, 0x0d, 0xbd, 0x29, 0xe6, 0x7a, 0xbe, 0xf2, 0x81, 0x65, 0xbc,
-  0x22, 0x31, 0x5f, 0x3d, 0xb6, 0x21, 0xb6, 0x3d, 0x40, 0x2c, 0xff, 0x3b,
-  0x4e, 0x98, 0x93, 0xbc, 0x6a, 0xd5, 0x41, 0xbe, 0x1e, 0x3b, 0xc1, 0x3d,
-  0x60, 0x3c, 0xa7, 0x3e, 0x12, 0x8f, 0x39, 0xbd, 0xf9, 0xa0, 0x74, 0x3d,
-  0xa2, 0x9b, 0x93, 0x3c, 0xcc, 0x84, 0x19, 0x3e, 0x69, 0x27, 0x13, 0xbe,
-  0x70, 0x13, 0xd5, 0x3d, 0x08, 0x67, 0xd6, 0x3d, 0xe4, 0xa2, 0x5b, 0x3e,
-  0x5b, 0xe5, 0x4b, 0x3e, 0xc0, 0x67, 0x48, 0x3e, 0x38, 0xf7, 0x8b, 0x3d,
-  0xcc, 0x83, 0x2d, 0x3e, 0x58, 0x23, 0x07, 0xbe, 0xad, 0x3c, 0x37, 0xbd,
-  0x4b, 0x7a, 0x5d, 0x3e, 0x88, 0x83, 0xe4, 0x3c, 0xe8, 0x6f, 0x0a, 0xbe,
-  0xac, 0x74, 0x49, 0xbe, 0x79, 0x1b, 0x7a, 0xbe, 0x58, 0x5d, 0x4e, 0x3c,
-  0x60, 0xf6, 0x96, 0xbd, 0x66, 0x0a, 0xb7, 0x3d, 0xa8, 0xd3, 0x3f, 0x3d,
-  0x4d, 0x7c, 0x81, 0x3e, 0xc9, 0x1c, 0xd1, 0x3d, 0xdf, 0x14, 0x00, 0x3e,
-  0x63, 0xa3, 0x90, 0x3e, 0xd7, 0x40, 0xd3, 0x3d, 0x78, 0x21, 0xc1, 0x3d,
-  0x00, 0x15, 0x7f, 0xbd, 0x3b, 0x9f, 0x79, 0x3c, 0xd3, 0x16, 0x47, 0xbd,
-  0x91, 0x82, 0xee, 0xbd, 0xe5, 0xca, 0xe5, 0x3d, 0x4b, 0xdb, 0xc8, 0xbd,
-  0x9c, 0xf2, 0x06, 0x3e, 0xe4, 0x8f, 0x26, 0xbe, 0x9e, 0x16, 0x90, 0x3d,
-  0x60, 0x61, 0x8e, 0x3c, 0xdd, 0xdd, 0xa1, 0xbd, 0xea, 0x27, 0x5a, 0xbd,
-  0x1c, 0x06, 0x2a, 0x3e, 0x00, 0x03, 0x36, 0xbe, 0x79, 0xbe, 0xcd, 0x3b,
-  0x0c, 0xb3, 0xf1, 0xbd, 0x68, 0x6d, 0x6e, 0xbd, 0x6e, 0x3d, 0x45, 0xbe,
-  0x8c, 0x4d, 0x60, 0x3e, 0x30, 0x5b, 0xc0, 0xbd, 0x46, 0x6f, 0x46, 0x3e,
-  0xb9, 0x81, 0xbd, 0xbd, 0x5a, 0xa5, 0x1f, 0x3e, 0x18, 0xed, 0xbb, 0xbd,
-  0x7d, 0x02, 0xbb, 0x3e, 0xd3, 0x5d, 0xf7, 0x3d, 0x96, 0xcb, 0xd0, 0x3d,
-  0x4a, 0xd6, 0x6b, 0x3e, 0xa2, 0xd9, 0x34, 0x3e, 0xb9, 0x40, 0x0d, 0xbf,
-  0x98, 0xe3, 0xb0, 0x3e, 0x48, 0x45, 0x29, 0x3e, 0xb7, 0xa9, 0x26, 0xbe,
-  0xff, 0x76, 0x16, 0x3d, 0xb5, 0x10, 0xa3, 0xbd, 0x45, 0x60, 0x31, 0xbe,
-  0x9e, 0x65, 0x4a, 0xbe, 0x8e, 0x9f, 0xe4, 0xbd, 0xe8, 0x99, 0x1e, 0x3e,
-  0xac, 0x24, 0x73, 0x3e, 0x62, 0xe1, 0x62, 0x3e, 0xd0, 0x03, 0xf6, 0x3d,
-  0xef, 0xa3, 0xa8, 0x3e, 0x09, 0x0b, 0x67, 0xbd, 0x00, 0x29, 0x8e, 0xbd,
-  0x30, 0xf9, 0x4c, 0xbd, 0x56, 0xd9, 0x3d, 0xbd, 0x4f, 0x9a, 0xe4, 0x3c,
-  0x2f, 0x46, 0x4c, 0x3d, 0xac, 0xb6, 0x19, 0xbe, 0xea, 0x9a, 0x07, 0x3e,
-  0xa0, 0xd7, 0x40, 0x3d, 0x00, 0xcd, 0x77, 0xbe, 0xaa, 0xff, 0x8e, 0x3e,
-  0x00, 0x82, 0xe0, 0xbd, 0x80, 0x6a, 0x05, 0xbe, 0x0b, 0x3b, 0xb1, 0x3e,
-  0x83, 0x37, 0xb0, 0xbd, 0xb1, 0x0e, 0x07, 0x3e, 0x33, 0xb4, 0x8a, 0x3c,
-  0x55, 0x0a, 0x0a, 0xbe, 0x55, 0x20, 0xa5, 0x3e, 0xba, 0xbb, 0x59, 0xbd,
-  0x62, 0x50, 0x4a, 0x3e, 0xee, 0xaa, 0x64, 0x3e, 0x13, 0xae, 0x0d, 0x3e,
-  0x9b, 0xfb, 0xcf, 0x3d, 0xf8, 0xd6, 0x13, 0x3d, 0x58, 0xba, 0x02, 0x3e,
-  0x9e, 0xe3, 0x3b, 0xbe, 0xb8, 0x01, 0x7e, 0x3e, 0xf2, 0x76, 0x1d, 0xbe,
-  0xd6, 0x6f, 0x87, 0x3e, 0x20, 0xc3, 0xe3, 0xbc, 0xa6, 0x73, 0x9d, 0x3e,
-  0x3c, 0x43, 0x6a, 0xbd, 0x40, 0x88, 0x4d, 0xbe, 0x98, 0xad, 0xcb, 0x3d,
-  0xa7, 0x67, 0x29, 0xbe, 0x8c, 0x96, 0x88, 0x3e, 0x25, 0xf8, 0xa3, 0x3e,
-  0xdb, 0x80, 0xcb, 0xbc, 0xfb, 0x5d, 0x14, 0x3e, 0x80, 0x30, 0x59, 0xbd,
-  0x11, 0xfd, 0x3c, 0x3e, 0xc6, 0x0e, 0x54, 0xbe, 0x8a, 0xe9, 0x7e, 0x3c,
-  0xcc, 0x7d, 0x29, 0xbe, 0x36, 0xa7, 0x5f, 0x3e, 0x4b, 0x7c, 0x6b, 0x3e,
-  0xf4, 0x1f, 0xfa, 0xbd, 0xaf, 0xd2, 0x1c, 0x3e, 0x79, 0x74, 0x0e, 0x3e,
-  0x95, 0x0f, 0xdc, 0xbd, 0xdb, 0x17, 0xa2, 0xbd, 0x3c, 0xe9, 0xc8, 0xbd,
-  0x60, 0x3d, 0x29, 0xbe, 0xeb, 0xf9, 0x8e, 0x3d, 0x11, 0x77, 0xbb, 0xbc,
-  0x4f, 0xc6, 0xad, 0x3e, 0xaa, 0x26, 0xfe, 0xbd, 0xcb, 0x33, 0x3c, 0x3e,
-  0x84, 0x22, 0x67, 0x3e, 0x02, 0xcd, 0xa5, 0x3d, 0x17, 0xc8, 0xc9, 0x3c,
-  0x60, 0xb0, 0xa7, 0xbd, 0x0e, 0x2c, 0x31, 0x3e, 0x0f, 0x56, 0x75, 0x3d,
-  0x70, 0xfc, 0xfe, 0xbd, 0xab, 0xf1, 0x4f, 0xbe, 0x51, 0x89, 0x34, 0x3e,
-  0xfb, 0x0a, 0x1d, 0x3e, 0x4f, 0xa8, 0xc5, 0xbd, 0x21, 0x23, 0x37, 0x3e,
-  0xc8, 0xc5, 0xdf, 0x3d, 0x58, 0x97, 0x40, 0x3e, 0x5c, 0x93, 0x11, 0xbe,
-  0x39, 0x7e, 0x12, 0xbe, 0x39, 0x63, 0x25, 0x3e, 0x54, 0xe0, 0x32, 0xbe,
-  0x5b, 0x26, 0x4a, 0x3e, 0x4f, 0x9c, 0x23, 0x3e, 0x66, 0x11, 0x3a, 0xbd,
-  0x7f, 0xc4, 0x4a, 0x3e, 0x9c, 0xe9, 0x06, 0x3e, 0x6b, 0xbe, 0xb0, 0xbc,
-  0xf8, 0xf7, 0x77, 0xbe, 0xa8, 0x6f, 0xf5, 0xbd, 0x89, 0xf4, 0x56, 0xbe,
-  0x6e, 0x54, 0xcf, 0x3d, 0x3b, 0xcc, 0xa9, 0xbe, 0x66, 0x05, 0x23, 0x3e,
-  0x13, 0x0e, 0x07, 0xbe, 0xf2, 0xff, 0x2b, 0x3e, 0x58, 0x8c, 0xfb, 0x3d,
-  0x66, 0xb5, 0xa9, 0x3e, 0x3b, 0xb5, 0x64, 0x3c, 0x70, 0xc9, 0x49, 0xbe,
-  0x38, 0x7f, 0x0b, 0xbe, 0x44, 0x2e, 0x12, 0xbe, 0x60, 0x2c, 0x4d, 0x3d,
-  0x30, 0xbf, 0x64, 0x3d, 0x70, 0x3d, 0x17, 0xbd, 0xe8, 0xae, 0x6c, 0xbe,
-  0xc8, 0xaf, 0x79, 0xbe, 0x74, 0xd3, 0x0c, 0x3e, 0xc0, 0xe5, 0x58, 0x3d,
-  0x38, 0x13, 0x6b, 0xbe, 0x70, 0x58, 0x5c, 0x3d, 0x10, 0x81, 0x31, 0xbe,
-  0x04, 0xf3, 0x48, 0x3e, 0xd8, 0x1d, 0xdf, 0xbd, 0xc0, 0xca, 0x0f, 0x3c,
-  0xe0, 0x60, 0xa8, 0xbc, 0x30, 0xed, 0x75, 0x3d, 0x68, 0xd8, 0x73, 0xbe,
-  0xc0, 0x2d, 0x1b, 0xbd, 0xf8, 0x89, 0x90, 0xbd, 0xbc, 0x46, 0x5f, 0xbe,
-  0xec, 0x24, 0x35, 0xbe, 0x68, 0x1e, 0x1a, 0xbe, 0xcc, 0x50, 0x7e, 0x3e,
-  0x3c, 0x7a, 0x11, 0x3e, 0x74, 0x31, 0x0f, 0x3e, 0x40, 0xe8, 0x53, 0xbc,
-  0xa4, 0x46, 0x0b, 0x3e, 0xe0, 0x58, 0x14, 0x3d, 0xc8, 0x41, 0x8f, 0xbd,
-  0x10, 0x87, 0xc8, 0xbd, 0x08, 0x1e, 0xa1, 0xbd, 0x1a, 0x0a, 0x2a, 0xbc,
-  0x99, 0x82, 0x8b, 0xbe, 0x20, 0x8f, 0x63, 0xbe, 0xb3, 0x32, 0x59, 0xbe,
-  0x46, 0xbe, 0xb1, 0x3c, 0x12, 0x15, 0x01, 0x3d, 0x3c, 0xe9, 0xe9, 0x3d,
-  0x58, 0x01, 0xfc, 0x3d, 0xaf, 0x3b, 0x77, 0x3c, 0x2c, 0xa9, 0x48, 0xbe,
-  0xe8, 0xe0, 0x69, 0xbe, 0x6e, 0x9c, 0x2c, 0x3d, 0xc1, 0x86, 0x64, 0xbe,
-  0x14, 0xfb, 0x7c, 0xbe, 0x22, 0x38, 0x8b, 0xbe, 0xbe, 0x7d, 0x8b, 0x3e,
-  0xd3, 0x12, 0x21, 0xbd, 0x69, 0x2a, 0x9e, 0x3e, 0xb1, 0x00, 0xbe, 0xbd,
-  0xa8, 0xd8, 0x96, 0xbc, 0x03, 0x1d, 0x81, 0x3c, 0xcf, 0x38, 0x41, 0x3e,
-  0xf4, 0x56, 0x5e, 0xbe, 0xfd, 0x60, 0x0c, 0x3e, 0xa0, 0xa1, 0x56, 0xbd,
-  0xdb, 0x7a, 0x0c, 0xbd, 0x78, 0x17, 0x20, 0x3e, 0xac, 0x5a, 0x55, 0x3e,
-  0xf8, 0x51, 0x75, 0xbe, 0x30, 0x18, 0x70, 0x3e, 0x85, 0x26, 0x8c, 0x3e,
-  0x80, 0x0c, 0x17, 0x3d, 0xb3, 0x38, 0x24, 0x3e, 0x07, 0xad, 0x3d, 0xbc,
-  0xd8, 0x24, 0xd0, 0x3d, 0x26, 0xbb, 0x08, 0x3e, 0xbc, 0x1c, 0xe5, 0xbd,
-  0x44, 0x04, 0x8b, 0x3d, 0x4f, 0x47, 0x2c, 0x3e, 0x5d, 0xb8, 0x9f, 0x3e,
-  0xf9, 0xfb, 0x44, 0xbd, 0x78, 0x66, 0x34, 0xbe, 0x61, 0xa2, 0x33, 0x3e,
-  0x7b, 0x5e, 0xf6, 0xbd, 0xea, 0x2a, 0xc7, 0xbd, 0x14, 0x5d, 0x69, 0xbe,
-  0x13, 0x92, 0xdc, 0xbb, 0xff, 0xc9, 0x2d, 0x3d, 0x42, 0xf0, 0x43, 0xbe,
-  0x25, 0x73, 0x36, 0x3e, 0xdb, 0x54, 0x80, 0x3e, 0x3a, 0x92, 0xbf, 0x3d,
-  0x10, 0xca, 0x84, 0xbd, 0xca, 0xa3, 0x85, 0x3d, 0x29, 0xd4, 0x2e, 0xbe,
-  0xdd, 0x13, 0x3a, 0x3e, 0x2c, 0xb8, 0x3a, 0xbd, 0x76, 0xb5, 0x76, 0xbd,
-  0x79, 0x02, 0x8a, 0x3e, 0x93, 0xba, 0x8c, 0x3d, 0x14, 0xb5, 0x0b, 0xbe,
-  0xc4, 0xbf, 0x11, 0x3e, 0x82, 0x9a, 0x93, 0x3e, 0x70, 0xae, 0x51, 0x3d,
-  0x40, 0x66, 0x07, 0xbd, 0x87, 0x0c, 0x3a, 0xbe, 0xb0, 0x9a, 0x23, 0x3e,
-  0xa0, 0x6b, 0x6b, 0xbd, 0x35, 0x79, 0xd2, 0xbd, 0x6d, 0x2f, 0xe8, 0xbd,
-  0x8d, 0xc1, 0xe7, 0xbb, 0x3b, 0x36, 0x92, 0xbb, 0xa1, 0x98, 0x80, 0xbd,
-  0xc8, 0xca, 0xe3, 0x3d, 0x80, 0x24, 0x10, 0xbc, 0x4e, 0x59, 0x0e, 0xbe,
-  0x2d, 0x71, 0x64, 0xbe, 0x3c, 0xc8, 0x4b, 0xbe, 0xe0, 0x02, 0xbe, 0xbd,
-  0xb1, 0xff, 0x45, 0x3d, 0xe2, 0x4d, 0x40, 0xbd, 0xa9, 0xc5, 0xad, 0xbc,
-  0xb7, 0xbd, 0x8e, 0xbc, 0x13, 0x15, 0xa6, 0xbd, 0xa9, 0xf5, 0xfe, 0xba,
-  0xa5, 0xe3, 0xca, 0xbd, 0x05, 0x74, 0x08, 0x3e, 0xf8, 0xa9, 0x43, 0xbc,
-  0xc0, 0xf1, 0x23, 0x3e, 0xd2, 0x13, 0x68, 0x3e, 0x5d, 0x96, 0x21, 0x3e,
-  0x10, 0x47, 0xda, 0x3d, 0x28, 0x46, 0xb3, 0xbd, 0xa8, 0x45, 0xe6, 0x3d,
-  0x80, 0xb6, 0x09, 0x3e, 0x78, 0x39, 0x75, 0xbe, 0x5e, 0x28, 0xd2, 0x3d,
-  0x12, 0xa3, 0x17, 0x3d, 0x30, 0x75, 0xef, 0xbd, 0xaa, 0xa4, 0x17, 0xbe,
-  0xf5, 0x63, 0x4f, 0xbe, 0x0e, 0x9f, 0x5e, 0x3e, 0x54, 0x2f, 0x65, 0x3c,
-  0x2b, 0x2e, 0x4e, 0x3d, 0xbe, 0x76, 0x66, 0xbe, 0xd8, 0xb4, 0xab, 0x3d,
-  0x35, 0xf3, 0x67, 0x3e, 0xbb, 0xbe, 0xa6, 0x3e, 0x7f, 0xef, 0x53, 0x3e,
-  0xe8, 0x3d, 0x70, 0x3e, 0xab, 0xd5, 0xbb, 0x3d, 0xaa, 0x76, 0xf5, 0x3c,
-  0xea, 0x21, 0xcc, 0xbd, 0x13, 0x12, 0x3e, 0x3e, 0x99, 0x5c, 0x15, 0xbd,
-  0xf8, 0xd5, 0x1e, 0xbe, 0x08, 0x25, 0x8f, 0x3e, 0xf4, 0xf8, 0x28, 0xbe,
-  0x3d, 0xd6, 0x40, 0xbe, 0xec, 0x33, 0xb0, 0x3c, 0xdb, 0xc4, 0x62, 0x3e,
-  0x8d, 0xf0, 0xe2, 0x3d, 0x0b, 0x85, 0xed, 0xbd, 0x75, 0x27, 0x00, 0x3e,
-  0x44, 0x13, 0x74, 0xbe, 0x83, 0x39, 0x79, 0x3e, 0x75, 0xcb, 0x41, 0x3d,
-  0xb8, 0xf2, 0x68, 0xbe, 0x35, 0x78, 0xd3, 0x3a, 0xe3, 0x0a, 0xec, 0xbd,
-  0x48, 0xed, 0x08, 0x3e, 0x07, 0x60, 0xaa, 0xbc, 0xf7, 0xf4, 0x87, 0x3e,
-  0x66, 0x32, 0x43, 0xbc, 0xd5, 0x2b, 0x02, 0x3e, 0xf5, 0x41, 0xd2, 0xbd,
-  0x2c, 0xb8, 0x89, 0x3e, 0x18, 0xd3, 0x64, 0xbe, 0xc8, 0xb1, 0x2e, 0xbe,
-  0x7b, 0x5e, 0x82, 0xbe, 0x46, 0xe2, 0x14, 0x3e, 0x80, 0xbf, 0x9e, 0x3d,
-  0x1e, 0xb0, 0x8f, 0xbe, 0x7f, 0x95, 0xa9, 0x3e, 0xb3, 0xad, 0xfa, 0x3c,
-  0x90, 0x09, 0x81, 0x3e, 0x20, 0xb3, 0x5d, 0x3d, 0x3a, 0xb1, 0x07, 0xbd,
-  0xc6, 0xf2, 0xca, 0xbd, 0xb8, 0x12, 0xdf, 0x3d, 0xa7, 0x91, 0x7b, 0x3e,
-  0xca, 0x63, 0x2f, 0x3e, 0x09, 0xda, 0x20, 0xbe, 0xf3, 0x69, 0xa7, 0x3e,
-  0x56, 0x69, 0x5d, 0x3d, 0x97, 0x72, 0x95, 0xbd, 0x14, 0xd6, 0x5e, 0x3e,
-  0x88, 0x50, 0x82, 0xbe, 0x60, 0x22, 0x5f, 0x3d, 0x84, 0x89, 0x76, 0xbe,
-  0x86, 0xa1, 0x4e, 0x3e, 0x2d, 0x6b, 0x14, 0x3e, 0x94, 0xe9, 0x1b, 0xbe,
-  0x9c, 0x2b, 0x2d, 0x3e, 0x50, 0x51, 0x03, 0xbd, 0x56, 0xba, 0x35, 0xbe,
-  0x3a, 0x0d, 0x19, 0x3e, 0x92, 0x2e, 0x25, 0x3b, 0x6a, 0xd3, 0xb9, 0xbd,
-  0x04, 0x02, 0x2d, 0xbe, 0xb6, 0x44, 0x4a, 0xbe, 0x1f, 0x34, 0x0a, 0xbe,
-  0x65, 0xab, 0x4d, 0x3e, 0xe0, 0x3d, 0x4e, 0x3e, 0x3f, 0x3d, 0xc2, 0x3e,
-  0xa8, 0x52, 0x86, 0x3e, 0x76, 0x4b, 0x35, 0x3e, 0x20, 0x60, 0x22, 0x3e,
-  0x55, 0x0d, 0x43, 0x3e, 0xa9, 0xac, 0x9d, 0xbe, 0x46, 0x65, 0x7d, 0xbd,
-  0x86, 0xc2, 0x26, 0xbe, 0x80, 0xbd, 0xf1, 0x3c, 0xd6, 0x70, 0xe8, 0xbd,
-  0xa0, 0x5c, 0x65, 0xbd, 0x6e, 0xd4, 0x15, 0xbe, 0xdf, 0xe3, 0xf6, 0x3d,
-  0xd7, 0x32, 0x4a, 0xbe, 0xcc, 0x74, 0x1d, 0x3e, 0x7a, 0x75, 0xa6, 0x3d,
-  0x61, 0x69, 0x87, 0x3e, 0x10, 0x77, 0x0f, 0x3e, 0x33, 0xb1, 0x92, 0x3e,
-  0x1d, 0xd0, 0x26, 0xbe, 0x10, 0xa2, 0x6e, 0x3d, 0x82, 0x52, 0x78, 0x3e,
-  0x55, 0xef, 0x1a, 0xbe, 0xa0, 0x21, 0x66, 0x3e, 0x18, 0x64, 0xf9, 0x3d,
-  0xfc, 0x48, 0x02, 0xbe, 0x2e, 0x01, 0x65, 0x3e, 0xc4, 0x46, 0x46, 0x3e,
-  0xb8, 0x9c, 0x69, 0x3d, 0x72, 0xd6, 0x4a, 0x3d, 0x90, 0xcf, 0x1b, 0xbc,
-  0x80, 0x71, 0xf5, 0x3d, 0xde, 0x7f, 0x2f, 0x3d, 0x97, 0xd3, 0xf7, 0xbd,
-  0x7e, 0x3d, 0x6c, 0x3e, 0x77, 0xc1, 0x2a, 0xbe, 0x71, 0x03, 0x97, 0x3e,
-  0xab, 0x48, 0xbd, 0x3e, 0xf5, 0x95, 0x17, 0xbe, 0x69, 0xcc, 0xcb, 0x3c,
-  0xdb, 0x1d, 0x50, 0x3d, 0xc3, 0x35, 0x12, 0xbe, 0x30, 0xfd, 0x1b, 0x3d,
-  0x83, 0x50, 0x88, 0x3e, 0xef, 0x20, 0x16, 0xbd, 0x98, 0xdc, 0x38, 0x3e,
-  0x78, 0x62, 0x3e, 0x3e, 0x6c, 0xe0, 0x95, 0x3e, 0x3b, 0x0c, 0x80, 0x3e,
-  0x00, 0xbf, 0x12, 0xbc, 0x69, 0x1f, 0xd8, 0x3b, 0x72, 0xa3, 0xb3, 0x3c,
-  0xc8, 0xae, 0xaf, 0x3d, 0x5d, 0xfa, 0x24, 0x3e, 0xd0, 0xcd, 0x82, 0x3c,
-  0x4b, 0x87, 0x3c, 0x3c, 0xe2, 0x08, 0x22, 0xbe, 0x0f, 0x3f, 0xef, 0x3d,
-  0x90, 0xf5, 0x69, 0xbe, 0x94, 0x32, 0x28, 0xbe, 0x90, 0x20, 0xad, 0xbd,
-  0x8a, 0x56, 0x0d, 0x3e, 0x87, 0xaa, 0xf7, 0x3c, 0x68, 0x99, 0x89, 0xbd,
-  0xac, 0xc9, 0x71, 0x3d, 0x21, 0xbe, 0xd9, 0xbd, 0xc5, 0xde, 0xf7, 0xbd,
-  0x2e, 0x84, 0x85, 0xbe, 0xb5, 0xca, 0x80, 0x3e, 0xaa, 0x8a, 0x0f, 0x3d,
-  0xe0, 0x12, 0x3a, 0x3e, 0x68, 0xf8, 0x7a, 0x3e, 0xfc, 0x6a, 0x25, 0x3e,
-  0x98, 0x6d, 0x56, 0x3e, 0x65, 0x04, 0xac, 0x3d, 0x0e, 0x28, 0x07, 0x3e,
-  0x01, 0x29, 0x8a, 0xbb, 0x9d, 0x24, 0x05, 0x3e, 0xfc, 0x03, 0x29, 0x3e,
-  0x02, 0xb1, 0x7d, 0xbe, 0xd2, 0xe1, 0x99, 0x3e, 0xb8, 0x84, 0x42, 0x3e,
-  0x88, 0x4e, 0xb7, 0xbd, 0x55, 0x8a, 0x8b, 0xbd, 0xd4, 0xdf, 0x24, 0x3e,
-  0xe8, 0xad, 0xd9, 0xbd, 0x84, 0xdb, 0x29, 0x3e, 0xf0, 0x97, 0x27, 0xbe,
-  0xd6, 0x2d, 0x30, 0xbd, 0xfe, 0x55, 0xbf, 0xbd, 0xfb, 0x7b, 0xb9, 0x3e,
-  0x60, 0xc3, 0xc6, 0x3d, 0x9c, 0xf2, 0xd5, 0x3a, 0x10, 0x2a, 0xa8, 0xbb,
-  0xd1, 0x96, 0xb7, 0x3d, 0x40, 0x64, 0x19, 0xbe, 0x7e, 0xcd, 0x92, 0x3e,
-  0xf5, 0x1e, 0xa8, 0x3e, 0xbc, 0x54, 0x23, 0x3e, 0xc7, 0x5a, 0x59, 0x3e,
-  0xaf, 0x2b, 0x40, 0x3e, 0x24, 0x2e, 0x4d, 0x3d, 0x3e, 0xe0, 0x4d, 0x3e,
-  0x8b, 0x54, 0x3e, 0xbe, 0x52, 0x61, 0x2c, 0xbe, 0xd4, 0x17, 0x38, 0xbe,
-  0xc1, 0xe2, 0x86, 0xbd, 0x8e, 0x87, 0x66, 0x3d, 0x0e, 0x74, 0x2b, 0x3d,
-  0x53, 0xb1, 0x75, 0x3d, 0x0c, 0xdc, 0x0b, 0x3e, 0x3e, 0x8f, 0x1a, 0x3e,
-  0x13, 0x7b, 0x02, 0x3e, 0xf4, 0x7d, 0x4e, 0xbe, 0x35, 0x73, 0x8c, 0xbe,
-  0xd8, 0x43, 0x66, 0x3c, 0xf4, 0x0a, 0x02, 0x3e, 0x9c, 0x82, 0xe2, 0xbd,
-  0x9d, 0xa2, 0x1e, 0xbe, 0x91, 0xa7, 0x3e, 0x3e, 0x4b, 0x47, 0xb8, 0x3d,
-  0x7b, 0xb7, 0x40, 0x3e, 0x13, 0x33, 0x7e, 0x3e, 0xe0, 0x76, 0x49, 0x3e,
-  0x21, 0xde, 0x0d, 0x3e, 0x00, 0xd1, 0x40, 0x3e, 0xd9, 0x15, 0x84, 0x3e,
-  0xa8, 0x6f, 0x70, 0xbe, 0x78, 0x95, 0x25, 0x3e, 0x33, 0x7b, 0x60, 0x3e,
-  0x8d, 0xc6, 0x94, 0x3e, 0x19, 0x06, 0x57, 0xbd, 0xcb, 0xc4, 0xc7, 0x3d,
-  0xed, 0x1d, 0xbc, 0x3d, 0x93, 0x7c, 0xb8, 0x3d, 0x1e, 0x1d, 0x34, 0x3e,
-  0x30, 0x35, 0xad, 0xbd, 0x63, 0xd1, 0xed, 0x3c, 0x8e, 0x9b, 0x69, 0xbe,
-  0x25, 0xc3, 0xa3, 0x3e, 0xe8, 0x6c, 0x2a, 0x3d, 0x82, 0x3c, 0x14, 0xbe,
-  0x44, 0xc5, 0x47, 0x3e, 0x9f, 0x48, 0x5d, 0x3e, 0x50, 0x4a, 0x92, 0xbe,
-  0xe0, 0x1b, 0xcc, 0x3d, 0x79, 0xf9, 0x30, 0xbd, 0x90, 0x4e, 0xcb, 0xbd,
-  0xa8, 0xa3, 0xee, 0xbd, 0x9a, 0x58, 0x72, 0xbe, 0x7c, 0xc6, 0x8a, 0x3e,
-  0x30, 0x61, 0x02, 0x3e, 0x00, 0x44, 0x14, 0xbe, 0x97, 0x0e, 0x37, 0xbe,
-  0x73, 0xcd, 0xba, 0x3e, 0xb4, 0xe4, 0x75, 0xbe, 0x10, 0x42, 0x6a, 0x3d,
-  0x75, 0x8b, 0x84, 0x3e, 0x47, 0xd7, 0xf3, 0xbc, 0xe0, 0xdd, 0x56, 0x3d,
-  0x64, 0xa4, 0xc5, 0x3d, 0x04, 0x67, 0x0e, 0x3e, 0x79, 0xbb, 0x79, 0x3e,
-  0x14, 0x9b, 0x9e, 0x3c, 0xb6, 0x79, 0x22, 0xbe, 0xbb, 0xb4, 0x9c, 0xbe,
-  0x7a, 0x60, 0xc3, 0x3d, 0x0b, 0x5e, 0x55, 0xbe, 0xf8, 0x86, 0x5e, 0xbe,
-  0x31, 0xe9, 0x7e, 0x3e, 0x9d, 0xcb, 0x18, 0xbe, 0x30, 0x1a, 0x80, 0x3e,
-  0x33, 0xa0, 0x7c, 0x3d, 0x5e, 0x88, 0x53, 0xbd, 0x10, 0x16, 0x1a, 0xbe,
-  0x07, 0x83, 0x9a, 0x3e, 0x7b, 0xb1, 0x4f, 0xbd, 0x08, 0xca, 0xf3, 0xbd,
-  0x4e, 0xc2, 0xeb, 0x3d, 0xec, 0xb5, 0x9d, 0x3e, 0x90, 0x72, 0x67, 0x3e,
-  0xf0, 0xdd, 0xdd, 0xbd, 0xdb, 0x29, 0x5b, 0x3e, 0x93, 0x22, 0x31, 0xbe,
-  0x3c, 0x93, 0x2a, 0x3d, 0x9b, 0xd7, 0x1d, 0x3d, 0x5e, 0x3a, 0x0b, 0x3e,
-  0xe8, 0x0c, 0x85, 0x3d, 0xe1, 0xa5, 0x6d, 0x3e, 0x5f, 0x1e, 0x58, 0xbe,
-  0xfc, 0x4e, 0x40, 0x3d, 0xc0, 0x6c, 0x68, 0xbe, 0x4a, 0x2a, 0x56, 0x3e,
-  0xc3, 0x2d, 0xd3, 0xbd, 0x66, 0xfa, 0x1e, 0x3e, 0x1e, 0x89, 0x48, 0xbe,
-  0x4e, 0x46, 0xd2, 0xbd, 0x77, 0x31, 0x60, 0x3e, 0x51, 0xaa, 0x7e, 0x3e,
-  0xea, 0xeb, 0x07, 0x3e, 0xf5, 0x9c, 0x8a, 0xbd, 0xd2, 0x33, 0xe5, 0xbd,
-  0x6b, 0xb6, 0x46, 0xbd, 0x4e, 0xac, 0x90, 0xbc, 0x33, 0xb8, 0x0d, 0xbe,
-  0xf2, 0xc7, 0x2e, 0xbe, 0xf0, 0xd3, 0x1f, 0xbd, 0x59, 0x6d, 0x21, 0x3e,
-  0x34, 0xdf, 0x9a, 0xbd, 0x80, 0x30, 0x8f, 0xbb, 0x70, 0x25, 0x50, 0xbb,
-  0x38, 0xe7, 0xb2, 0x3d, 0x38, 0xa9, 0xe4, 0x3d, 0x8a, 0x99, 0x59, 0x3e,
-  0xc4, 0x78, 0x1a, 0xbe, 0x8b, 0x71, 0x15, 0x3d, 0x4f, 0xb2, 0x0a, 0x3e,
-  0x52, 0x6b, 0x34, 0xbe, 0x86, 0x0a, 0x28, 0x3e, 0x90, 0x49, 0x10, 0x3e,
-  0xe1, 0x84, 0x83, 0x3c, 0x92, 0x12, 0xc8, 0x3d, 0xbd, 0x50, 0xbb, 0x3d,
-  0xb4, 0x07, 0x6c, 0xbe, 0x8a, 0x3d, 0x96, 0xbd, 0x74, 0x77, 0x0c, 0x3e,
-  0xdf, 0x1d, 0x28, 0xbe, 0x1a, 0xb9, 0x80, 0x3e, 0x72, 0xcd, 0x04, 0x3d,
-  0x6e, 0xfe, 0xf7, 0xbd, 0xcb, 0x69, 0x13, 0x3e, 0x4c, 0x4a, 0x8c, 0x3d,
-  0x5f, 0x0f, 0xdf, 0x3c, 0x77, 0x25, 0xb5, 0x3c, 0xde, 0x16, 0x85, 0x3d,
-  0xbe, 0x14, 0xed, 0x3c, 0x73, 0x90, 0x20, 0xbe, 0x4b, 0xbd, 0x42, 0xbd,
-  0xb0, 0x15, 0x23, 0x3d, 0x9b, 0x0f, 0x53, 0x3e, 0x61, 0x41, 0xa1, 0x3e,
-  0xc8, 0x65, 0xe8, 0xbd, 0x34, 0xd1, 0x9e, 0x3e, 0x06, 0x2d, 0x24, 0x3d,
-  0xe0, 0x27, 0xee, 0x3d, 0xc5, 0xb7, 0x57, 0xbd, 0xa7, 0xc7, 0x9c, 0x3e,
-  0x53, 0xa6, 0x89, 0x3e, 0xcf, 0x26, 0x96, 0xbe, 0x35, 0x2e, 0x93, 0xbc,
-  0xc4, 0x72, 0x0a, 0x3e, 0x80, 0x14, 0x7f, 0xbe, 0xb0, 0xea, 0xc7, 0xbd,
-  0x14, 0x68, 0x41, 0xbe, 0xf0, 0xce, 0xc7, 0xbd, 0x60, 0x5a, 0xf4, 0x3c,
-  0xbc, 0xed, 0x2c, 0xbe, 0x00, 0x89, 0x1e, 0x3a, 0xcb, 0x6f, 0xef, 0xbd,
-  0x98, 0xcc, 0x12, 0x3e, 0x0b, 0x13, 0x83, 0x3e, 0x37, 0x7a, 0x7b, 0x3d,
-  0x58, 0xf3, 0x7d, 0xbe, 0xa3, 0xcb, 0x67, 0x3e, 0x64, 0x46, 0xd5, 0xbd,
-  0x71, 0x39, 0xa6, 0x3c, 0x87, 0x7e, 0x3b, 0xbe, 0x35, 0x2d, 0x73, 0x3b,
-  0x4d, 0x9f, 0xb2, 0x3c, 0x9e, 0xe6, 0x95, 0x3e, 0xd0, 0xe0, 0xf2, 0x3d,
-  0x93, 0xc3, 0x94, 0x3e, 0xea, 0xe6, 0x51, 0x3d, 0xe0, 0xbc, 0x50, 0xbe,
-  0xeb, 0x59, 0x30, 0x3e, 0x91, 0x63, 0x0a, 0xbe, 0x04, 0x1f, 0x36, 0x3e,
-  0x28, 0x15, 0x81, 0x3d, 0x11, 0x5d, 0x86, 0xbd, 0x91, 0xe9, 0x6a, 0xbe,
-  0x90, 0xe4, 0x27, 0xbe, 0x68, 0x25, 0x1e, 0x3e, 0x1c, 0xce, 0x15, 0x3e,
-  0xe4, 0x9a, 0x61, 0x3e, 0x20, 0xd6, 0x62, 0x3e, 0xef, 0x1e, 0x43, 0x3c,
-  0x03, 0x90, 0x97, 0xbc, 0x00, 0x1b, 0x35, 0xbe, 0x7b, 0x74, 0xb5, 0xbd,
-  0x9d, 0xdf, 0xc1, 0x3d, 0x27, 0xc1, 0xcc, 0x3d, 0xc8, 0x6e, 0x92, 0xbd,
-  0xcf, 0x14, 0xcf, 0xbd, 0xb0, 0x09, 0x2f, 0xbd, 0xf8, 0x34, 0x13, 0x3c,
-  0x12, 0x10, 0x28, 0x3d, 0xe4, 0x24, 0x35, 0x3e, 0xf2, 0x2c, 0xff, 0xbd,
-  0x20, 0x56, 0xe6, 0x3d, 0x70, 0xdb, 0x4a, 0x3e, 0xd3, 0x2a, 0xc8, 0xbd,
-  0xfe, 0x52, 0x6d, 0xbe, 0x5c, 0x91, 0x42, 0xbe, 0xff, 0x22, 0x6c, 0x3c,
-  0xa5, 0xcd, 0x80, 0xbc, 0xc0, 0x79, 0x72, 0x3d, 0xf1, 0xb2, 0x2a, 0x3d,
-  0x0c, 0x6b, 0xb9, 0x3d, 0x80, 0xa9, 0x33, 0xbe, 0x5d, 0x8c, 0x60, 0x3e,
-  0x67, 0xdb, 0xda, 0x3d, 0xa2, 0xbc, 0x3d, 0xbe, 0xfc, 0x1c, 0x16, 0xbe,
-  0x90, 0x7f, 0x1b, 0x3e, 0x7c, 0xcd, 0x54, 0x3e, 0x48, 0x0e, 0x80, 0xbd,
-  0xd8, 0x0e, 0x47, 0x3d, 0x1d, 0xfe, 0x1f, 0x3e, 0xc6, 0x0d, 0x67, 0x3d,
-  0x00, 0x4d, 0x5c, 0x3c, 0xa7, 0x72, 0x29, 0xbd, 0x8e, 0xf5, 0xe0, 0xbd,
-  0xb3, 0xb9, 0xb8, 0xbd, 0x29, 0x31, 0xca, 0x3d, 0xc5, 0xf2, 0x9a, 0x3b,
-  0x1d, 0x74, 0xc6, 0x3e, 0xfe, 0xaa, 0xa1, 0x3b, 0x0c, 0x9b, 0x6c, 0xbe,
-  0x76, 0xb8, 0x5e, 0x3c, 0x90, 0x5d, 0xc5, 0x3d, 0x22, 0x43, 0xfa, 0xbd,
-  0x23, 0x6d, 0x1c, 0xbe, 0xdd, 0x70, 0xa6, 0x3e, 0x74, 0x69, 0x26, 0x3e,
-  0x4c, 0x62, 0x35, 0xbe, 0x0b, 0xcd, 0x10, 0x3e, 0xb9, 0xbd, 0x63, 0x3e,
-  0x48, 0x7b, 0x4b, 0x3e, 0x37, 0xe4, 0x2c, 0xbe, 0x8e, 0xec, 0x1f, 0x3e,
-  0x40, 0x73, 0x58, 0x3d, 0xc0, 0x8c, 0x07, 0xbd, 0x59, 0x4c, 0x9b, 0xbe,
-  0x51, 0xb9, 0x55, 0xbe, 0x85, 0xac, 0xa9, 0xbb, 0x3d, 0x63, 0x23, 0xbe,
-  0x00, 0x0c, 0x38, 0xbe, 0x40, 0x30, 0x77, 0x3e, 0x20, 0x4f, 0x46, 0x3e,
-  0x9a, 0x01, 0xb2, 0x3d, 0x07, 0xa5, 0x33, 0x3d, 0x68, 0xa0, 0x42, 0xbe,
-  0xa1, 0xf7, 0x5d, 0xbe, 0xa3, 0xdc, 0x21, 0x3e, 0x7f, 0x24, 0x7f, 0xbe,
-  0x95, 0xde, 0x03, 0xbe, 0x3e, 0x3c, 0x8d, 0x3d, 0xc6, 0x8f, 0xfb, 0xbd,
-  0xa2, 0x7e, 0x90, 0x3d, 0xf4, 0x43, 0x95, 0xbe, 0x8b, 0xc8, 0x5d, 0x3e,
-  0xdb, 0xc7, 0x70, 0xbe, 0xed, 0x5e, 0xb6, 0x39, 0x0c, 0x63, 0x62, 0x3e,
-  0xff, 0xa2, 0x2b, 0xbe, 0x12, 0x34, 0xff, 0x3c, 0x1c, 0x57, 0x1d, 0x3e,
-  0x8c, 0x06, 0x83, 0x3d, 0x9a, 0x61, 0x67, 0xbe, 0x64, 0xfd, 0x24, 0xbe,
-  0xe3, 0x2e, 0x78, 0x3d, 0xca, 0xda, 0x25, 0x3e, 0x40, 0xa2, 0xaf, 0x3d,
-  0xe8, 0x8d, 0x6e, 0x3e, 0x3e, 0xab, 0x0c, 0xbd, 0xac, 0x87, 0xbc, 0x3d,
-  0xe6, 0x2b, 0x2f, 0xbe, 0x3b, 0x05, 0xdf, 0xbd, 0x5d, 0x0f, 0x86, 0xbc,
-  0xc0, 0x2d, 0xbe, 0x3c, 0x3c, 0x60, 0x40, 0xbe, 0x9c, 0xad, 0x60, 0x3d,
-  0xe4, 0xdf, 0xfc, 0x3d, 0x5c, 0xb9, 0x13, 0xbe, 0x8c, 0x44, 0x94, 0xbd,
-  0xbc, 0x4c, 0x02, 0x3c, 0xb3, 0xd2, 0x8c, 0x3e, 0x14, 0x32, 0x45, 0xbd,
-  0xa0, 0x38, 0x0f, 0xbe, 0xa0, 0x85, 0x2f, 0xbe, 0x9a, 0x3c, 0x48, 0xbe,
-  0x1f, 0x91, 0xf5, 0x3c, 0x13, 0x27, 0xf7, 0x3d, 0x5e, 0x6f, 0x4a, 0x3e,
-  0x2e, 0xb9, 0x54, 0xbe, 0xfe, 0x4b, 0x59, 0x3e, 0xa7, 0x2d, 0x7a, 0x3d,
-  0xf1, 0x60, 0x84, 0x3e, 0xd8, 0x55, 0x5e, 0xbe, 0x47, 0x08, 0x86, 0x3d,
-  0x97, 0x8d, 0x5d, 0xbd, 0xa8, 0xfc, 0xe9, 0xbd, 0x3d, 0xa2, 0x8d, 0x3e,
-  0x86, 0x3a, 0x0f, 0x3e, 0x38, 0x0f, 0xd0, 0xbd, 0xe8, 0x48, 0xc3, 0x3d,
-  0x11, 0xa4, 0x68, 0x3e, 0x92, 0xab, 0x0d, 0x3d, 0xe3, 0x5e, 0xd8, 0xbd,
-  0xfc, 0xfd, 0x81, 0xbd, 0xce, 0xc4, 0xe9, 0xbd, 0x10, 0x8c, 0x3a, 0xbe,
-  0xdc, 0x08, 0xb4, 0x3d, 0x57, 0xb7, 0xf8, 0xbd, 0x88, 0x3f, 0x5c, 0xbe,
-  0x00, 0xc0, 0x2d, 0xba, 0x5a, 0x32, 0x24, 0x3e, 0x8b, 0x5d, 0xa8, 0x3e,
-  0x43, 0x46, 0x55, 0xbe, 0x0c, 0xaf, 0xef, 0x3c, 0x3e, 0x42, 0x59, 0xbe,
-  0xcc, 0x01, 0xde, 0x3d, 0xa1, 0xd4, 0x64, 0x3e, 0x0b, 0xd4, 0xf7, 0xbc,
-  0xcf, 0x88, 0xbc, 0x3d, 0xc8, 0x94, 0x07, 0x3e, 0xa7, 0x74, 0xad, 0xbc,
-  0x43, 0x8b, 0x34, 0x3b, 0x36, 0xbb, 0x88, 0x3d, 0x9c, 0xf6, 0x52, 0x3e,
-  0x58, 0x33, 0x89, 0xbd, 0xf4, 0xdc, 0x70, 0x3e, 0xf3, 0x51, 0x88, 0x3e,
-  0x60, 0xb3, 0xe9, 0x3c, 0xe4, 0x49, 0xe5, 0xbd, 0x41, 0xcd, 0x67, 0xbe,
-  0x88, 0x7f, 0x68, 0xbe, 0xf5, 0x1d, 0x15, 0xbe, 0xfc, 0x46, 0x2c, 0x3e,
-  0x6e, 0xfc, 0xc0, 0x3d, 0x58, 0x83, 0xe5, 0xbd, 0x3f, 0xaf, 0x12, 0xbe,
-  0x7a, 0x86, 0x61, 0x3e, 0x80, 0x8a, 0x77, 0x3e, 0xb8, 0x39, 0x17, 0xbe,
-  0x74, 0xb5, 0x23, 0x3e, 0x86, 0xe2, 0x93, 0x3e, 0x00, 0x75, 0x2b, 0x3d,
-  0xef, 0xb9, 0x2e, 0xbd, 0x9d, 0xa6, 0x1f, 0x3e, 0x21, 0x3a, 0x06, 0xbd,
-  0x45, 0xfb, 0x2d, 0x3e, 0xf8, 0x4a, 0xbf, 0x3d, 0x05, 0x0c, 0x3b, 0xbd,
-  0x46, 0x03, 0xf0, 0x3c, 0x7b, 0xe4, 0xd9, 0xbd, 0x64, 0x8d, 0x7a, 0xbe,
-  0x29, 0x59, 0x14, 0xbe, 0x96, 0xbb, 0x2b, 0xbe, 0xea, 0xef, 0x4f, 0x3e,
-  0x61, 0x52, 0x28, 0xbe, 0xda, 0xab, 0x83, 0x3c, 0x04, 0x7b, 0x6b, 0x3e,
-  0x41, 0x3e, 0x2d, 0x3e, 0xb1, 0xd6, 0xe1, 0x3d, 0x54, 0x0c, 0x51, 0xbe,
-  0x9c, 0x25, 0xd9, 0xbc, 0x84, 0xd0, 0xf5, 0x3d, 0x94, 0x29, 0x2c, 0x3e,
-  0x36, 0xa9, 0x02, 0xbe, 0x94, 0xab, 0x1a, 0x3e, 0x84, 0xc5, 0x0d, 0x3b,
-  0xea, 0x84, 0x8f, 0xbe, 0x95, 0x5b, 0x2d, 0xbe, 0x59, 0x01, 0xc1, 0xbd,
-  0x80, 0xa1, 0x92, 0x3b, 0xbd, 0x0f, 0x65, 0x3e, 0xbf, 0x06, 0x78, 0xbe,
-  0xae, 0x42, 0x5b, 0x3d, 0x80, 0xf8, 0x7d, 0x3c, 0x8e, 0x9d, 0x98, 0xbe,
-  0x37, 0xff, 0x07, 0xbe, 0x7c, 0xc5, 0x0b, 0xbe, 0x96, 0x83, 0x82, 0x3d,
-  0xe5, 0xcf, 0x90, 0x3e, 0x89, 0x28, 0x1b, 0xba, 0x28, 0x4c, 0xf9, 0xbd,
-  0x0e, 0x91, 0xc3, 0x3d, 0x6b, 0xd9, 0x31, 0x3e, 0x7e, 0x21, 0x0d, 0xbe,
-  0xc7, 0xf9, 0xfb, 0x3c, 0xbb, 0x17, 0x68, 0x3e, 0x0a, 0xf8, 0x18, 0x3e,
-  0x42, 0xf5, 0xa1, 0x3e, 0x00, 0xcc, 0x42, 0x3d, 0x40, 0x7c, 0x17, 0x3e,
-  0x5e, 0xcd, 0x8b, 0x3e, 0xa8, 0x00, 0x91, 0x3d, 0x18, 0xc6, 0xdc, 0x3d,
-  0xa4, 0xc3, 0x59, 0xbe, 0xc8, 0xff, 0x75, 0xbe, 0x90, 0x02, 0x34, 0x3d,
-  0xe0, 0x34, 0xa9, 0xbd, 0x64, 0xed, 0x57, 0x3e, 0x00, 0xf7, 0x76, 0x3d,
-  0xb8, 0xb1, 0x60, 0x3e, 0x34, 0x41, 0x0c, 0xbe, 0x00, 0xbb, 0x77, 0x3d,
-  0x10, 0xcd, 0x1a, 0xbe, 0xbc, 0xc6, 0x72, 0xbe, 0x98, 0x0a, 0x22, 0xbe,
-  0x94, 0xd6, 0x01, 0xbe, 0x00, 0x6b, 0x57, 0xbd, 0xc0, 0x91, 0xca, 0xbd,
-  0x1c, 0xff, 0x3e, 0x3e, 0x80, 0x1e, 0x0a, 0xbe, 0xf8, 0xf2, 0x25, 0xbe,
-  0x78, 0xfc, 0xca, 0xbd, 0xb4, 0x34, 0x6b, 0xbe, 0x7c, 0x4e, 0x6a, 0xbe,
-  0xd8, 0x15, 0x34, 0xbe, 0xb8, 0xa6, 0x9d, 0x3d, 0xe8, 0x5d, 0xd4, 0x3d,
-  0x70, 0xb1, 0xc9, 0xbd, 0x00, 0xb1, 0x74, 0xbd, 0xe8, 0xd1, 0x8f, 0xbd,
-  0xc0, 0x3c, 0xf9, 0xbd, 0xe0, 0x82, 0x61, 0xbe, 0x48, 0xf4, 0xcb, 0xbd,
-  0x04, 0xcd, 0x56, 0xbe, 0xb0, 0x9f, 0x15, 0x3e, 0x60, 0x3e, 0x96, 0x3d,
-  0x4c, 0xac, 0x23, 0x3e, 0x90, 0x60, 0x3e, 0xbe, 0x00, 0xee, 0x59, 0x3b,
-  0x40, 0xd6, 0x83, 0xbd, 0x70, 0x25, 0xa3, 0x3d, 0x20, 0x58, 0xb3, 0x3c,
-  0x80, 0x3e, 0x03, 0xbe, 0x64, 0x47, 0x21, 0x3e, 0x00, 0x2a, 0x3b, 0xbe,
-  0x00, 0xf8, 0xb6, 0xba, 0x48, 0x63, 0xb4, 0x3d, 0xc0, 0x53, 0x4c, 0x3d,
-  0x00, 0x70, 0xcc, 0xbd, 0xf4, 0x1a, 0x3e, 0xbe, 0x80, 0xd7, 0xe3, 0x3d,
-  0xe0, 0x69, 0xa9, 0xbc, 0x98, 0x94, 0xc8, 0xbd, 0x80, 0x13, 0x04, 0xbe,
-  0x60, 0x4e, 0x5d, 0xbe, 0xa8, 0x0f, 0x2c, 0xbe, 0xd0, 0x11, 0x84, 0x3d,
-  0xec, 0x73, 0x50, 0x3e, 0xb0, 0xc9, 0x33, 0xbd, 0x68, 0xf1, 0xa6, 0xbd,
-  0x0c, 0x0a, 0x4f, 0x3e, 0x5c, 0x6d, 0x6c, 0xbe, 0x90, 0x20, 0x45, 0xbe,
-  0x30, 0x44, 0x07, 0xbe, 0xb8, 0x48, 0x60, 0xbe, 0x58, 0xe9, 0x68, 0x3e,
-  0x28, 0xa0, 0x63, 0xbe, 0x1d, 0x55, 0x61, 0xbe, 0xa0, 0x5c, 0x6c, 0xbe,
-  0x5d, 0x31, 0x9c, 0xbd, 0x19, 0xd7, 0x31, 0x3d, 0x94, 0xa9, 0x4c, 0x3e,
-  0x21, 0xf9, 0x2d, 0xbd, 0x91, 0x75, 0x38, 0xbd, 0x19, 0x19, 0xe1, 0xbd,
-  0xb0, 0x98, 0x61, 0x3e, 0x30, 0xcb, 0xcf, 0xbd, 0xb3, 0x55, 0x7b, 0x3e,
-  0x20, 0x94, 0x45, 0x3e, 0x64, 0x0a, 0x12, 0xbe, 0x5c, 0x29, 0xde, 0xbd,
-  0x64, 0x74, 0xb0, 0xbd, 0x32, 0xe5, 0x4b, 0x3d, 0xcd, 0x82, 0x2b, 0x3d,
-  0x69, 0x0b, 0xe8, 0xbd, 0x80, 0x47, 0x87, 0xbe, 0x36, 0xe8, 0x84, 0x3c,
-  0xa6, 0x00, 0x41, 0x3e, 0x88, 0xe4, 0xaf, 0x3d, 0x67, 0xca, 0xd2, 0x3d,
-  0x94, 0xd9, 0xa4, 0xbd, 0x47, 0xfe, 0x5b, 0xbd, 0x51, 0xdd, 0x00, 0xbe,
-  0xc0, 0x29, 0x3d, 0xbd, 0xc0, 0x4d, 0x77, 0xbd, 0x7f, 0x84, 0x84, 0x3e,
-  0x53, 0x78, 0x19, 0x3e, 0x20, 0x67, 0x68, 0x3d, 0xb5, 0xc1, 0xab, 0xbd,
-  0xc6, 0x02, 0x8c, 0x3e, 0x40, 0x1d, 0x5b, 0x3e, 0x89, 0x3e, 0x39, 0xbe,
-  0xa2, 0xff, 0x7a, 0xbc, 0x86, 0xc0, 0x21, 0x3c, 0x31, 0x30, 0x5c, 0xbe,
-  0x3c, 0xaf, 0xa2, 0x3e, 0x8a, 0xb2, 0x2c, 0xbd, 0x00, 0x20, 0xf7, 0x3d,
-  0xe0, 0x93, 0x57, 0xbd, 0x56, 0x27, 0x82, 0x3e, 0xa3, 0xc6, 0x2e, 0xbd,
-  0x38, 0xb0, 0x9d, 0xbd, 0x6b, 0xf2, 0xc8, 0xbd, 0xfa, 0x59, 0x76, 0xbe,
-  0x29, 0x27, 0xcd, 0x3d, 0x7a, 0xda, 0x9a, 0x3d, 0x35, 0x95, 0x03, 0x3e,
-  0xe4, 0x83, 0x40, 0x3e, 0x36, 0x64, 0x7a, 0xbd, 0x12, 0x07, 0x0f, 0x3e,
-  0xec, 0x76, 0x4e, 0x3e, 0xfb, 0xde, 0xe6, 0x3d, 0xc3, 0x40, 0x01, 0x3e,
-  0x11, 0xd8, 0x12, 0x3e, 0xe3, 0xec, 0x5c, 0xbd, 0x9c, 0x0e, 0x45, 0xbe,
-  0xfc, 0xf9, 0x19, 0xbe, 0x9c, 0x68, 0x01, 0x3d, 0x38, 0xcb, 0x7a, 0x3e,
-  0x54, 0x71, 0x3a, 0xbe, 0x22, 0x37, 0x49, 0xbe, 0x56, 0x39, 0x1b, 0x3e,
-  0x38, 0x62, 0xb1, 0xbd, 0x3b, 0x43, 0xb5, 0x3b, 0x26, 0xc7, 0x73, 0x3e,
-  0x7e, 0x81, 0xf3, 0xbd, 0x19, 0xf8, 0x07, 0xbe, 0x51, 0xc2, 0x6c, 0xbe,
-  0xc3, 0x8f, 0xad, 0x3d, 0xc0, 0xbb, 0x2b, 0x3c, 0xdb, 0x65, 0xa7, 0x3d,
-  0x16, 0x90, 0x89, 0x3e, 0xf5, 0xcb, 0x6f, 0x3e, 0x00, 0x70, 0x0a, 0xbb,
-  0xe9, 0xe5, 0x16, 0x3e, 0x43, 0xf5, 0xc6, 0xbd, 0xe1, 0x4f, 0x68, 0x3e,
-  0xf0, 0x61, 0x53, 0x3d, 0x75, 0x07, 0x36, 0xbd, 0x16, 0xec, 0xf8, 0xbe,
-  0xc1, 0x59, 0x64, 0x3e, 0x0a, 0xb4, 0x70, 0x3e, 0x7a, 0x1f, 0xca, 0x3d,
-  0x7f, 0xe2, 0xe0, 0x3a, 0xad, 0x8d, 0xc4, 0x3c, 0x92, 0x60, 0x56, 0xbd,
-  0xf6, 0x61, 0x7f, 0xbe, 0x51, 0x5b, 0xc6, 0x3d, 0x00, 0xde, 0x03, 0xbb,
-  0x0c, 0xf3, 0x39, 0x3e, 0x06, 0x85, 0x27, 0xbe, 0x48, 0xc9, 0x67, 0x3e,
-  0xa2, 0x00, 0x53, 0x3d, 0xf6, 0x2e, 0x96, 0x3d, 0x80, 0x13, 0xc5, 0xbb,
-  0x90, 0xb0, 0x0e, 0x3d, 0x03, 0x03, 0x19, 0xbe, 0xf5, 0xa1, 0x8b, 0x3d,
-  0xfc, 0x2e, 0x82, 0x3e, 0x2f, 0xa7, 0x05, 0x3e, 0x8f, 0x02, 0x59, 0xbe,
-  0x00, 0x4f, 0xfb, 0xbc, 0x04, 0xa3, 0xcf, 0xbd, 0x66, 0x55, 0x2b, 0xbe,
-  0xb3, 0xd9, 0xcb, 0xbd, 0x10, 0x27, 0xbf, 0x3d, 0x28, 0x6e, 0xbd, 0x3d,
-  0x7c, 0x1d, 0x3f, 0xbe, 0x19, 0x8f, 0xa7, 0xbd, 0xab, 0x2a, 0xb3, 0x3c,
-  0x55, 0x96, 0xd0, 0xbd, 0xbd, 0xa6, 0x4c, 0x3e, 0x01, 0xe4, 0xc9, 0xbd,
-  0x2b, 0x59, 0x4a, 0x3e, 0x1b, 0x1c, 0x1f, 0xbd, 0x52, 0x6f, 0x09, 0x3e,
-  0x4f, 0x2b, 0x16, 0xbe, 0x06, 0x8f, 0x01, 0xbd, 0xae, 0x50, 0x8e, 0x3e,
-  0xda, 0xf9, 0xc2, 0x3d, 0x60, 0xc3, 0xd5, 0xbc, 0xbe, 0xc7, 0x9a, 0xbe,
-  0x20, 0xb1, 0xaf, 0x3e, 0x78, 0xcd, 0x81, 0xbd, 0xe0, 0x39, 0x0a, 0xbd,
-  0xb3, 0x8d, 0x26, 0xbe, 0x70, 0x61, 0x25, 0x3d, 0xc2, 0x96, 0x5c, 0xbd,
-  0x28, 0xf0, 0x50, 0xbd, 0x0b, 0xd1, 0x83, 0xbe, 0x66, 0x4d, 0x05, 0xbd,
-  0xf9, 0xaa, 0x4a, 0x3e, 0xf0, 0x22, 0x56, 0x3d, 0x20, 0x74, 0x17, 0x3e,
-  0x14, 0x21, 0x79, 0xbe, 0xb3, 0x37, 0xe5, 0x3d, 0x74, 0x5d, 0xd0, 0xbd,
-  0x98, 0x8c, 0x2e, 0x3e, 0x80, 0x91, 0xea, 0x3c, 0x9f, 0x61, 0x33, 0x3e,
-  0x94, 0x4c, 0x16, 0x3d, 0xa2, 0xb3, 0xbe, 0xbc, 0x8a, 0xbc, 0xf7, 0xbc,
-  0xdb, 0xf8, 0x0e, 0x3c, 0x60, 0xfc, 0x91, 0xbd, 0xfe, 0x5c, 0x40, 0x3e,
-  0xb8, 0x6d, 0x5e, 0xbe, 0x09, 0xf8, 0x72, 0x3c, 0xe7, 0xae, 0x43, 0xbe,
-  0x16, 0x20, 0xdd, 0x3d, 0x41, 0x7e, 0x97, 0x3d, 0xb6, 0x50, 0xdd, 0x3d,
-  0x20, 0x6c, 0xaf, 0xbd, 0xfd, 0xf0, 0x82, 0xbe, 0x82, 0x45, 0x5b, 0x3e,
-  0x40, 0x66, 0xa9, 0xbc, 0xc3, 0xc2, 0x93, 0x3c, 0xe4, 0x6e, 0x31, 0xbe,
-  0x00, 0xf2, 0xca, 0xbb, 0x0b, 0xb5, 0x4f, 0xbe, 0x9c, 0x84, 0x97, 0x3d,
-  0x89, 0x26, 0x78, 0xbd, 0xff, 0x16, 0x1b, 0xbe, 0xdd, 0xd0, 0x54, 0x3d,
-  0x40, 0x56, 0xcf, 0xbc, 0x00, 0x7a, 0x70, 0xbc, 0x6c, 0xce, 0x13, 0x3e,
-  0x3e, 0xe0, 0x77, 0xbd, 0xbe, 0xa8, 0x50, 0x3e, 0xac, 0x18, 0x1c, 0x3e,
-  0xb0, 0x2b, 0xf0, 0x3d, 0xd8, 0x1d, 0xcb, 0x3d, 0x1f, 0xac, 0x35, 0xbe,
-  0x68, 0xbc, 0x0e, 0xbe, 0xfc, 0x24, 0x2c, 0xbe, 0xa8, 0x31, 0x0c, 0xbe,
-  0x7c, 0x0e, 0x3a, 0xbe, 0x9e, 0x17, 0x22, 0x3d, 0x38, 0xa1, 0xa1, 0xbd,
-  0x8b, 0x30, 0x62, 0x3e, 0x8d, 0x01, 0xe3, 0x3b, 0x52, 0xaa, 0x0d, 0x3e,
-  0x8e, 0xd3, 0xd6, 0xbb, 0xef, 0x37, 0x1c, 0x3e, 0xd0, 0x18, 0x66, 0x3d,
-  0x31, 0x3b, 0x75, 0xbe, 0xb8, 0x68, 0x80, 0xbd, 0xc0, 0x3b, 0x0e, 0x3c,
-  0xd2, 0x6c, 0x44, 0x3e, 0xe0, 0x92, 0x7a, 0xbe, 0xd4, 0x55, 0x22, 0xbe,
-  0x50, 0x84, 0x04, 0x3e, 0x00, 0x1d, 0x30, 0xbe, 0x7d, 0x57, 0xbc, 0xbd,
-  0x4e, 0x7e, 0xf1, 0xbd, 0xf9, 0xeb, 0x86, 0xbe, 0xea, 0xae, 0xdf, 0x3e,
-  0x80, 0x9c, 0x1b, 0xbd, 0x48, 0x3e, 0x46, 0x3e, 0x7c, 0x70, 0xab, 0xbe,
-  0x1e, 0xbc, 0x35, 0xbe, 0xb8, 0xce, 0x32, 0x3e, 0x54, 0x27, 0x6e, 0x3e,
-  0x19, 0xd9, 0xdc, 0x3d, 0xf8, 0x58, 0x32, 0x3d, 0xfb, 0x7f, 0xfa, 0x3d,
-  0x8e, 0x25, 0x12, 0x3e, 0xcd, 0xe5, 0x4f, 0x3d, 0xab, 0x3f, 0x02, 0x3e,
-  0x7a, 0x0d, 0x6e, 0xbe, 0x09, 0xa5, 0x0a, 0x3d, 0x35, 0xb8, 0xf5, 0x3d,
-  0x5a, 0x1d, 0x94, 0x3d, 0x00, 0xb3, 0x66, 0xbd, 0xb4, 0x58, 0xa4, 0x3e,
-  0x93, 0xab, 0xd0, 0x3d, 0x6c, 0x19, 0x55, 0x3e, 0xff, 0x44, 0x02, 0x3e,
-  0x3c, 0x77, 0x35, 0x3e, 0xbc, 0x4e, 0x3e, 0x3e, 0x8f, 0xf2, 0x57, 0x3e,
-  0x95, 0x7f, 0x08, 0x3d, 0xf0, 0x5b, 0x49, 0x3e, 0x1f, 0xd4, 0x29, 0xbe,
-  0xd1, 0x81, 0x47, 0xbb, 0x3f, 0xef, 0x0d, 0x3d, 0x63, 0xae, 0x38, 0x3e,
-  0x6d, 0x55, 0x3f, 0xbd, 0xe0, 0xcf, 0xac, 0xbe, 0x54, 0x0a, 0x40, 0x3e,
-  0xd0, 0xb2, 0x84, 0xbd, 0x9b, 0x30, 0xb3, 0x3d, 0x12, 0xdf, 0x15, 0xbe,
-  0xe0, 0x10, 0xbd, 0xbc, 0x4e, 0x23, 0xad, 0xbe, 0x6c, 0x17, 0x37, 0xbe,
-  0xde, 0x8f, 0x3c, 0xbd, 0xf7, 0x84, 0x49, 0x3d, 0x88, 0xbd, 0x8c, 0x3e,
-  0xb4, 0x9a, 0x06, 0x3f, 0x6a, 0x07, 0x06, 0xbe, 0x59, 0xca, 0x35, 0x3e,
-  0x84, 0x7b, 0xe0, 0xbd, 0x9b, 0xa1, 0x02, 0x3e, 0x2c, 0x9a, 0x4f, 0x3e,
-  0x2c, 0xf1, 0x69, 0xbe, 0x3f, 0xbd, 0x8a, 0x3e, 0x60, 0x81, 0x41, 0x3e,
-  0xe0, 0x53, 0x2b, 0xbe, 0x54, 0xcd, 0xe2, 0x3c, 0x62, 0xd6, 0x71, 0x3e,
-  0x68, 0xf0, 0x82, 0xbd, 0xac, 0xee, 0x2f, 0xbe, 0x45, 0xda, 0x53, 0x3d,
-  0xc4, 0xb4, 0x27, 0x3e, 0xdc, 0xc4, 0x0a, 0x3e, 0x86, 0x77, 0x27, 0x3c,
-  0x35, 0x95, 0x72, 0x3e, 0x8e, 0xe9, 0xe5, 0x3c, 0xf1, 0x8a, 0x6d, 0x3e,
-  0x7b, 0x19, 0x55, 0xbe, 0x60, 0xe1, 0x35, 0x3d, 0x5c, 0xb1, 0x40, 0x3e,
-  0xa4, 0x60, 0x8e, 0x3e, 0x94, 0x76, 0x49, 0xbe, 0x78, 0x1d, 0x75, 0x3e,
-  0x8c, 0x06, 0x10, 0x3e, 0x81, 0x15, 0x59, 0x3d, 0xf5, 0xf5, 0x87, 0x3e,
-  0x81, 0x79, 0x08, 0x3e, 0xad, 0xe0, 0xfe, 0x3d, 0xf7, 0x9d, 0x05, 0x3f,
-  0xa2, 0x1f, 0xf0, 0xbc, 0xfd, 0xa1, 0x74, 0x3e, 0xa1, 0x12, 0x45, 0x3e,
-  0xd8, 0xf9, 0x94, 0x3d, 0xa4, 0x48, 0xc4, 0x3d, 0x10, 0x9e, 0xc9, 0xbc,
-  0xf7, 0x08, 0x1e, 0xbe, 0x6a, 0xef, 0x57, 0x3e, 0xc8, 0x0d, 0xc3, 0x3d,
-  0x24, 0xa2, 0x27, 0xbe, 0x1f, 0x55, 0x9f, 0x3d, 0xac, 0xbc, 0x0b, 0x3e,
-  0x1d, 0x6d, 0x68, 0xbd, 0xa6, 0xcb, 0x0b, 0x3e, 0xc4, 0xaf, 0x7a, 0xbe,
-  0x6c, 0x2b, 0x58, 0xbe, 0x92, 0x77, 0x62, 0x3e, 0x36, 0x59, 0xe2, 0x3d,
-  0x93, 0x25, 0xf2, 0x3c, 0x89, 0xb4, 0xc9, 0xbd, 0x81, 0x88, 0x9a, 0xbd,
-  0x40, 0x35, 0xb4, 0xbc, 0xd6, 0x71, 0x4b, 0x3e, 0x87, 0x52, 0xf9, 0x3d,
-  0x92, 0xd6, 0x9e, 0xbe, 0x08, 0x7e, 0xa2, 0x3d, 0x2c, 0x61, 0xab, 0xbe,
-  0x2e, 0xaa, 0xc0, 0xbc, 0x78, 0x6a, 0x0e, 0xbe, 0x59, 0x21, 0xa1, 0x3d,
-  0x42, 0x1e, 0x2d, 0xbd, 0xbe, 0x69, 0x93, 0x3e, 0x6c, 0xdc, 0xb0, 0x3d,
-  0xdb, 0xc7, 0x92, 0xbd, 0xd9, 0x6b, 0x2f, 0xbb, 0xe0, 0x44, 0x65, 0x3e,
-  0x75, 0x6e, 0x6b, 0xbd, 0x6a, 0xa3, 0xf5, 0x3e, 0x13, 0x47, 0xfc, 0xbc,
-  0xfd, 0x67, 0x07, 0xbe, 0xb8, 0x57, 0x81, 0x3d, 0x51, 0x68, 0x34, 0x3e,
-  0x0a, 0x56, 0x30, 0x3e, 0xfc, 0x65, 0x1c, 0xbe, 0x53, 0x06, 0x07, 0x3e,
-  0xcc, 0xd5, 0x41, 0x3e, 0x30, 0x4f, 0x87, 0xbd, 0x50, 0x09, 0xf3, 0x3d,
-  0x14, 0x27, 0x6b, 0x3e, 0xe7, 0x9f, 0x97, 0xbb, 0xcb, 0x0b, 0x22, 0x3e,
-  0x3e, 0x34, 0x31, 0x3e, 0xb1, 0x3f, 0x66, 0xbd, 0x20, 0xe3, 0x70, 0xbe,
-  0x59, 0x85, 0x89, 0xbd, 0xbc, 0x81, 0x2d, 0x3e, 0x55, 0x40, 0xca, 0xbd,
-  0x80, 0x4a, 0x30, 0xbd, 0xfd, 0xc0, 0xe6, 0x3d, 0x45, 0x45, 0x77, 0xbe,
-  0x0a, 0x55, 0x08, 0x3d, 0xca, 0x2f, 0xe3, 0x3c, 0x51, 0x31, 0x56, 0x3e,
-  0xa1, 0x49, 0xe4, 0x3e, 0xe1, 0x2d, 0x6f, 0xbd, 0xe8, 0xdf, 0x5d, 0x3e,
-  0x9d, 0x53, 0x5e, 0x3e, 0x0b, 0x1b, 0x0f, 0x3e, 0xae, 0xa2, 0x17, 0x3e,
-  0xb7, 0x2e, 0x1c, 0xbe, 0x4a, 0x88, 0x8c, 0x3e, 0x98, 0x48, 0x60, 0x3e,
-  0x90, 0x39, 0xff, 0xbd, 0xa6, 0x89, 0x79, 0xbe, 0xeb, 0xaa, 0x6e, 0x3d,
-  0x34, 0x88, 0x03, 0xbe, 0xd1, 0x30, 0x66, 0x3c, 0x89, 0x7d, 0x55, 0x3e,
-  0x7c, 0x75, 0x78, 0xbe, 0xba, 0x90, 0x81, 0x3e, 0xc1, 0xe9, 0x2b, 0x3e,
-  0xac, 0xa1, 0x33, 0x3d, 0x03, 0x4c, 0x47, 0x3e, 0xde, 0x57, 0x8c, 0xbe,
-  0x18, 0x3a, 0x0e, 0x3e, 0x20, 0x7e, 0xd9, 0x3c, 0x98, 0x47, 0x49, 0x3e,
-  0x37, 0xa1, 0xd7, 0x3d, 0x17, 0x2c, 0xa1, 0xbd, 0xe4, 0x8c, 0x1e, 0xbe,
-  0x63, 0x3e, 0xc5, 0x3b, 0xf8, 0x92, 0x65, 0x3e, 0xa6, 0x5c, 0x4f, 0xbe,
-  0x15, 0x00, 0xa0, 0xbc, 0x3f, 0x0b, 0x52, 0x3b, 0xc9, 0x9d, 0x06, 0xbe,
-  0x86, 0xba, 0x60, 0x3e, 0x56, 0x03, 0xc3, 0xbd, 0x5b, 0xb6, 0xc3, 0x3c,
-  0xa1, 0x6c, 0x7a, 0x3c, 0x36, 0xa1, 0xff, 0xbd, 0x11, 0xf9, 0xc3, 0xbd,
-  0xb0, 0x67, 0x8e, 0x3c, 0xc2, 0x06, 0x31, 0xbb, 0x2c, 0x3b, 0x18, 0xbe,
-  0xbc, 0xb6, 0x54, 0x3e, 0xb9, 0x0f, 0x67, 0x3e, 0x00, 0x95, 0xc8, 0x3d,
-  0x3b, 0x88, 0x76, 0x3e, 0xf6, 0xf6, 0x46, 0xbe, 0x00, 0x1b, 0x2e, 0xbd,
-  0x30, 0xfc, 0x66, 0x3e, 0xbc, 0xef, 0x91, 0xbc, 0xc8, 0xc4, 0x80, 0x3e,
-  0x86, 0xac, 0x65, 0xbe, 0x94, 0xfb, 0x97, 0x3e, 0x69, 0xd0, 0xa9, 0x3d,
-  0xd0, 0xf4, 0xe6, 0xbd, 0xc8, 0x6d, 0x05, 0x3e, 0xa1, 0x5a, 0xd3, 0x3b,
-  0x99, 0x10, 0x12, 0xbe, 0xc0, 0x44, 0x45, 0x3d, 0xfb, 0x20, 0x0b, 0xbd,
-  0x15, 0x2c, 0x14, 0xbd, 0xf9, 0x06, 0xa3, 0x3c, 0xa3, 0x9c, 0xd1, 0xbd,
-  0x73, 0x3d, 0x3d, 0xbe, 0xa0, 0x62, 0x55, 0x3e, 0x77, 0x4a, 0xac, 0xbe,
-  0xf8, 0xab, 0xe1, 0x3c, 0x48, 0x73, 0x5f, 0xbe, 0xa3, 0x4e, 0x7d, 0xbd,
-  0x2e, 0x5e, 0x34, 0xbe, 0xe2, 0x7d, 0x78, 0x3e, 0xe8, 0x28, 0x42, 0x3d,
-  0x81, 0xd5, 0x80, 0x3e, 0x4c, 0xcf, 0x51, 0x3e, 0x19, 0x0f, 0x6f, 0x3c,
-  0x10, 0x95, 0x1a, 0x3e, 0x78, 0x40, 0xea, 0x3d, 0x3c, 0x89, 0xab, 0x3e,
-  0x53, 0x0a, 0x27, 0x3c, 0xe0, 0x7c, 0xd3, 0xbd, 0x80, 0xa3, 0x6b, 0x3c,
-  0x14, 0x7f, 0x1b, 0xbe, 0x6c, 0xa2, 0x04, 0x3e, 0x98, 0x79, 0xaf, 0x3e,
-  0xc2, 0x7a, 0x0a, 0xbd, 0x55, 0xcd, 0x9e, 0x3e, 0x60, 0x94, 0xf8, 0xbc,
-  0x8b, 0x7b, 0x2e, 0xbe, 0xcb, 0x77, 0x43, 0xbe, 0xeb, 0x9c, 0x4d, 0xbe,
-  0x90, 0x5b, 0x16, 0x3d, 0xfb, 0x9a, 0xd9, 0xbd, 0x7a, 0x57, 0x99, 0x3d,
-  0x7b, 0x3c, 0xeb, 0x3d, 0x55, 0x0a, 0x88, 0x3c, 0xa2, 0xaa, 0x0d, 0x3e,
-  0x46, 0x98, 0x68, 0x3e, 0xc4, 0x7c, 0x19, 0x3e, 0xab, 0xfd, 0x2e, 0x3d,
-  0x5c, 0xa0, 0x13, 0x3d, 0x56, 0x82, 0x5a, 0x3e, 0xc0, 0x79, 0x1f, 0x3e,
-  0x6b, 0x7e, 0x0a, 0x3e, 0x73, 0xf5, 0x55, 0x3e, 0x49, 0x56, 0x4a, 0x3e,
-  0x88, 0x15, 0x13, 0x3e, 0x99, 0x75, 0xe5, 0xbd, 0xd6, 0x95, 0x25, 0xbe,
-  0x4c, 0x3a, 0x11, 0xbe, 0x26, 0x91, 0xf9, 0xbd, 0xf1, 0x7a, 0x04, 0x3d,
-  0x9c, 0xba, 0x45, 0x3e, 0xb6, 0x36, 0xba, 0x3d, 0x73, 0x48, 0x4f, 0xbd,
-  0xb0, 0x64, 0xaf, 0x3d, 0x4e, 0x74, 0x41, 0xbe, 0x38, 0x43, 0x92, 0x3e,
-  0x20, 0x15, 0x8f, 0xbd, 0x20, 0x14, 0xeb, 0x3c, 0xbe, 0x66, 0x2f, 0xbe,
-  0x4e, 0xd8, 0x69, 0x3e, 0x5e, 0x7f, 0xa4, 0x3d, 0x90, 0xd6, 0x17, 0x3d,
-  0x47, 0x1c, 0x05, 0x3e, 0x2e, 0xb4, 0x21, 0x3d, 0xe4, 0xfc, 0xf2, 0x3d,
-  0xc1, 0x41, 0x47, 0xbe, 0x41, 0x4e, 0xef, 0x3d, 0x67, 0x42, 0x42, 0xbe,
-  0x31, 0xa8, 0x60, 0xbd, 0xd7, 0x79, 0x92, 0x3d, 0xa8, 0x18, 0x8b, 0xbc,
-  0xa3, 0x6d, 0xfe, 0x3d, 0xe3, 0xe5, 0x8d, 0x3e, 0x89, 0x52, 0x49, 0xbe,
-  0xb8, 0xe6, 0x13, 0x3e, 0x20, 0x88, 0x4b, 0xbe, 0x00, 0xd8, 0xb8, 0xbb,
-  0x50, 0xb1, 0x18, 0x3d, 0x8b, 0x84, 0x2f, 0x3e, 0xd0, 0xf2, 0x9c, 0xbd,
-  0x9c, 0xb4, 0x64, 0xbd, 0x33, 0xbb, 0x5d, 0xbd, 0x00, 0xc1, 0xcd, 0xbb,
-  0x78, 0x87, 0x61, 0x3e, 0x1e, 0x83, 0x34, 0x3e, 0xf5, 0x6e, 0xcf, 0xbd,
-  0x56, 0x8e, 0xe5, 0x3d, 0xcc, 0x66, 0x48, 0x3e, 0x90, 0x60, 0xdc, 0xbd,
-  0xd0, 0x9d, 0x34, 0xbe, 0x20, 0x44, 0x41, 0xbd, 0xd8, 0x19, 0x8b, 0x3d,
-  0x30, 0x28, 0xaf, 0xbd, 0xb0, 0x82, 0xb6, 0xbd, 0x00, 0x18, 0xf7, 0x3c,
-  0x84, 0xaa, 0x12, 0xbe, 0x37, 0xa8, 0x60, 0xbe, 0x30, 0xc2, 0x07, 0xbe,
-  0xf7, 0xcc, 0xe1, 0x3d, 0x07, 0x6e, 0xb9, 0x3d, 0x80, 0x89, 0xa5, 0xbd,
-  0xc8, 0xd3, 0x6b, 0xbe, 0xe0, 0x0b, 0xff, 0x3d, 0x31, 0x96, 0x87, 0xbd,
-  0x54, 0xe0, 0x0c, 0xbe, 0xc8, 0x49, 0xf7, 0xbd, 0x96, 0x06, 0x50, 0x3e,
-  0x0d, 0xda, 0x07, 0xbd, 0x00, 0x96, 0xa2, 0xbc, 0x8f, 0x1a, 0x3a, 0xbe,
-  0xc1, 0x95, 0x07, 0x3c, 0xa0, 0x48, 0x03, 0xbd, 0x32, 0x5e, 0x81, 0xbe,
-  0x05, 0xb3, 0x0a, 0xbe, 0xf8, 0xf1, 0xc8, 0x3d, 0x42, 0xe3, 0x6a, 0xbe,
-  0x6c, 0xa4, 0x81, 0xbe, 0x6f, 0xce, 0xcd, 0x3d, 0xd5, 0x4f, 0x28, 0x3e,
-  0x69, 0xe1, 0xd6, 0x3d, 0x8c, 0xfb, 0x4a, 0xbe, 0x30, 0x91, 0x36, 0xbe,
-  0x58, 0xb8, 0x00, 0x3e, 0x7f, 0x85, 0x45, 0xbd, 0xe7, 0xa2, 0x2e, 0xbe,
-  0xb8, 0x2e, 0xef, 0x3d, 0x0f, 0x6a, 0x7d, 0xbe, 0x4e, 0x4e, 0x45, 0xbb,
-  0x9d, 0xd9, 0x59, 0xbe, 0x72, 0xab, 0xe6, 0x3d, 0x0b, 0xc5, 0xe9, 0xbd,
-  0xa0, 0xe1, 0x5b, 0x3e, 0x29, 0x84, 0x30, 0x3e, 0x72, 0x18, 0x65, 0x3e,
-  0x94, 0xa3, 0x21, 0xbe, 0xcb, 0x9e, 0x28, 0xbe, 0x16, 0xd4, 0x9d, 0x3d,
-  0xc0, 0x03, 0xc4, 0xbd, 0xfc, 0xa4, 0x4b, 0x3d, 0x80, 0x32, 0xa4, 0xbc,
-  0x40, 0x0e, 0x49, 0xbe, 0xc0, 0xb6, 0x00, 0xbe, 0xff, 0x84, 0x3a, 0xbd,
-  0x14, 0xb1, 0x4c, 0x3e, 0xb9, 0xa5, 0x82, 0xbd, 0xb8, 0xa6, 0x5e, 0xbe,
-  0x60, 0xb9, 0x95, 0x3c, 0xc4, 0x01, 0x78, 0xbe, 0x65, 0x38, 0xbc, 0xbd,
-  0xa7, 0x4b, 0x8b, 0x3d, 0x0b, 0x85, 0x7e, 0xbd, 0x9e, 0xbc, 0x83, 0x3e,
-  0xef, 0x6c, 0x48, 0xbe, 0x30, 0xbf, 0xb6, 0xbd, 0x29, 0xaa, 0x92, 0x3d,
-  0x5e, 0x08, 0x00, 0x3c, 0xcb, 0x64, 0x3e, 0x3e, 0xe8, 0x42, 0xf5, 0xbd,
-  0x47, 0x3a, 0x73, 0xbe, 0x95, 0x86, 0xd4, 0x3d, 0x40, 0x0d, 0xe0, 0x3d,
-  0xd9, 0x65, 0x23, 0xbe, 0xbf, 0xb2, 0x7c, 0x3e, 0x47, 0xb8, 0x82, 0x3d,
-  0x87, 0xcb, 0x4f, 0x3d, 0x89, 0x78, 0x05, 0x3e, 0x15, 0x99, 0x66, 0x3e,
-  0xd6, 0xa9, 0x55, 0xbd, 0x78, 0xc7, 0xb5, 0x3d, 0x7a, 0x83, 0x7a, 0xbb,
-  0x95, 0x51, 0x83, 0xbd, 0x78, 0x4e, 0x13, 0x3e, 0x08, 0x66, 0x91, 0x3d,
-  0xfb, 0xb7, 0x35, 0xbe, 0x06, 0x0f, 0xf2, 0x3d, 0x18, 0xf6, 0x4b, 0x3e,
-  0xe1, 0x4b, 0x50, 0xbe, 0x2d, 0x64, 0x9d, 0x3d, 0x50, 0xa2, 0x2b, 0xbe,
-  0x64, 0x45, 0xfd, 0x3c, 0x92, 0x89, 0x71, 0x3e, 0x67, 0x99, 0x23, 0xbd,
-  0x54, 0x02, 0xed, 0xbd, 0x35, 0x06, 0x4e, 0xbe, 0x34, 0xbd, 0xe9, 0xbd,
-  0x00, 0x46, 0x14, 0xbb, 0x00, 0xfe, 0xcd, 0x3d, 0x81, 0xab, 0xa0, 0x3e,
-  0x65, 0x4e, 0x8b, 0x3e, 0xa0, 0x77, 0xd7, 0x3d, 0x37, 0xbf, 0x4d, 0x3e,
-  0x9c, 0xc2, 0x80, 0x3d, 0x2e, 0xfa, 0x96, 0x3e, 0xfe, 0xf1, 0x3c, 0xbe,
-  0xc3, 0xe5, 0x48, 0xbe, 0x3a, 0x5d, 0x75, 0xbe, 0x99, 0x09, 0xc0, 0xbd,
-  0xf0, 0xbf, 0x99, 0x3e, 0xbc, 0x35, 0x4e, 0xbe, 0x94, 0x55, 0x37, 0x3d,
-  0xe1, 0xa2, 0x28, 0xbc, 0x93, 0x37, 0x80, 0xbe, 0xec, 0xa6, 0x5e, 0xbe,
-  0x9c, 0x15, 0x76, 0xbd, 0x80, 0xa2, 0xa1, 0x3b, 0x13, 0x57, 0x0d, 0xbd,
-  0xb1, 0x47, 0x2c, 0x3e, 0x00, 0xff, 0xf4, 0x3c, 0x91, 0x49, 0x57, 0xbe,
-  0xbd, 0xbc, 0x5b, 0xbe, 0x68, 0x14, 0x25, 0x3e, 0xd6, 0xea, 0x14, 0xbe,
-  0x58, 0xbd, 0x35, 0xbd, 0x6c, 0xb2, 0x2e, 0x3d, 0xe7, 0x9f, 0x1f, 0x3e,
-  0x35, 0x06, 0x4b, 0xbe, 0x98, 0x16, 0x9a, 0x3d, 0xc4, 0x48, 0x27, 0x3e,
-  0xd4, 0xb0, 0x9f, 0x3d, 0x35, 0xa6, 0xfa, 0x3d, 0x43, 0x1f, 0x87, 0x3e,
-  0x90, 0xc4, 0xdc, 0x3d, 0x86, 0x7f, 0xcf, 0x3d, 0x66, 0xa8, 0xbd, 0xbd,
-  0xaf, 0x8f, 0x72, 0x3e, 0xde, 0xa1, 0x96, 0x3e, 0x87, 0x1c, 0xc2, 0xba,
-  0x61, 0x0c, 0xdc, 0xbe, 0xa5, 0x33, 0x81, 0xbd, 0xd4, 0x1b, 0xfa, 0x3b,
-  0xa0, 0x50, 0x58, 0x3d, 0xce, 0x78, 0x1d, 0xbc, 0x1e, 0x18, 0x9d, 0x3d,
-  0x82, 0xc3, 0xa6, 0x3d, 0xf9, 0x86, 0x02, 0x3e, 0x1c, 0x90, 0x40, 0xbc,
-  0x18, 0x6d, 0x30, 0xbe, 0xf2, 0x49, 0x84, 0x3e, 0xfd, 0x83, 0x96, 0xbe,
-  0xec, 0x44, 0x2d, 0x3e, 0x2b, 0x40, 0x9c, 0x3d, 0x18, 0x44, 0xd9, 0x3d,
-  0xe8, 0x53, 0x7f, 0xbe, 0x80, 0x9b, 0x32, 0x3c, 0x37, 0x03, 0x2a, 0x3d,
-  0xba, 0x13, 0xf7, 0x3d, 0x7a, 0xe8, 0x29, 0xbe, 0x65, 0xd9, 0x23, 0xbd,
-  0x10, 0x67, 0x25, 0xbc, 0xe0, 0xa3, 0xe4, 0xbd, 0x40, 0xc7, 0xe4, 0x3d,
-  0x05, 0xd1, 0x49, 0xbd, 0xeb, 0x61, 0xe3, 0x3c, 0x78, 0x53, 0xd5, 0xbd,
-  0xe9, 0xd8, 0x36, 0x3d, 0x48, 0xc0, 0x8f, 0x3e, 0x11, 0x42, 0x59, 0xbe,
-  0xb9, 0xa0, 0xa4, 0xbd, 0x79, 0xff, 0x22, 0xbe, 0xc9, 0xac, 0xe2, 0x3c,
-  0x96, 0xe8, 0xf1, 0x3d, 0xef, 0x1b, 0x69, 0x3e, 0x00, 0xf9, 0x39, 0xbb,
-  0x40, 0x1c, 0xf4, 0xbd, 0x0f, 0x91, 0x30, 0xbe, 0xa9, 0x21, 0x06, 0xbe,
-  0xb5, 0xfb, 0xdb, 0xbc, 0x30, 0xbb, 0x90, 0xbc, 0xa8, 0x65, 0xfa, 0xbd,
-  0x8c, 0xcb, 0x87, 0x3e, 0xfb, 0x1b, 0x08, 0xbe, 0x28, 0xd2, 0xfe, 0x3d,
-  0xff, 0xec, 0x1d, 0xbe, 0x70, 0xc5, 0x67, 0xbe, 0xfc, 0xe2, 0x5a, 0x3e,
-  0x44, 0x9f, 0x2d, 0x3e, 0x11, 0xcd, 0x6d, 0xbb, 0x51, 0x03, 0x61, 0x3d,
-  0xdf, 0x71, 0x49, 0x3e, 0x01, 0x89, 0x56, 0x3d, 0xe1, 0xe2, 0xa7, 0x3e,
-  0x80, 0xda, 0xac, 0xbc, 0xeb, 0x3a, 0x3b, 0x3e, 0x27, 0xcd, 0x5b, 0xbd,
-  0x7c, 0xe3, 0x5a, 0x3e, 0x90, 0x2f, 0x64, 0x3d, 0xf4, 0xb1, 0xd9, 0x3d,
-  0x8a, 0xd0, 0xd5, 0xbc, 0xc6, 0x53, 0xda, 0x3d, 0xb6, 0x25, 0x98, 0x3d,
-  0x4d, 0xac, 0x70, 0xbd, 0xfb, 0xd6, 0xac, 0x3c, 0xa9, 0x48, 0x92, 0x3d,
-  0x74, 0x81, 0x71, 0xbe, 0xb1, 0xce, 0x18, 0x3e, 0xd8, 0x21, 0x65, 0x3e,
-  0x91, 0xe2, 0x63, 0xbd, 0x44, 0x18, 0x75, 0x3d, 0xb1, 0xb8, 0x4a, 0x3e,
-  0x5e, 0x15, 0x8b, 0x3e, 0x64, 0xe7, 0x56, 0x3e, 0x2a, 0xa0, 0xea, 0x3d,
-  0x9c, 0x42, 0xa9, 0x3c, 0x78, 0x72, 0x1b, 0xbe, 0x37, 0x3e, 0x34, 0xbd,
-  0x6e, 0xa9, 0x60, 0xbe, 0xa8, 0xf3, 0xf5, 0x3d, 0x34, 0x52, 0x25, 0xbe,
-  0x7d, 0xbc, 0x02, 0x3e, 0xf3, 0x7e, 0x27, 0xbe, 0x9a, 0xcf, 0x26, 0x3e,
-  0x0a, 0x69, 0xa8, 0xbd, 0x0c, 0x3f, 0x71, 0xbd, 0xe0, 0x2b, 0xc4, 0x3d,
-  0xad, 0xca, 0xf2, 0xbb, 0x17, 0x8f, 0x15, 0xbe, 0x07, 0x9a, 0x20, 0x3d,
-  0x00, 0x53, 0x34, 0x3b, 0x88, 0x55, 0xfb, 0x3d, 0x6c, 0x94, 0x20, 0x3e,
-  0x7d, 0x17, 0x94, 0xbd, 0x8c, 0xbe, 0x37, 0x3e, 0xd4, 0x7b, 0x32, 0x3e,
-  0xd0, 0xa5, 0xd9, 0x3e, 0x49, 0xe1, 0xb0, 0xbc, 0x37, 0xe9, 0x2e, 0x3e,
-  0x9a, 0xc9, 0xf0, 0xbc, 0xba, 0x49, 0x10, 0xbd, 0xba, 0xac, 0x38, 0x3e,
-  0x76, 0x7b, 0xeb, 0xbd, 0x54, 0x45, 0x7b, 0x3e, 0x4b, 0xdf, 0xff, 0x3d,
-  0x10, 0xaf, 0x70, 0x3e, 0x73, 0x77, 0x28, 0xbe, 0x68, 0x75, 0xa1, 0x3e,
-  0xf0, 0x77, 0xc0, 0x3d, 0x74, 0x4f, 0x2a, 0x3e, 0xf4, 0xf8, 0x33, 0xbe,
-  0x88, 0x50, 0xa6, 0xbd, 0x24, 0x5e, 0x1d, 0x3e, 0x28, 0xd6, 0x5b, 0xbe,
-  0xd4, 0xda, 0x61, 0xbe, 0xcc, 0x6d, 0x1a, 0xbe, 0x1c, 0x5b, 0x05, 0x3e,
-  0x00, 0x39, 0xdb, 0xbd, 0x98, 0x8c, 0xf3, 0x3d, 0x78, 0x11, 0xa1, 0x3d,
-  0x00, 0xdb, 0x51, 0x3e, 0x10, 0x36, 0x2f, 0xbd, 0x28, 0x38, 0xb8, 0xbd,
-  0x3c, 0x0b, 0x4a, 0xbe, 0x58, 0x83, 0x42, 0x3e, 0xc0, 0x04, 0x89, 0x3c,
-  0x80, 0x9b, 0x0b, 0xbd, 0xe0, 0xbd, 0xc9, 0x3d, 0x80, 0x7d, 0x0e, 0x3c,
-  0xe0, 0x41, 0xd1, 0xbd, 0x80, 0xa4, 0x80, 0x3d, 0xb0, 0x68, 0x01, 0xbd,
-  0x78, 0x66, 0x1a, 0xbe, 0x48, 0xb4, 0xcd, 0xbd, 0xc0, 0x85, 0x60, 0xbc,
-  0xa4, 0xc0, 0x56, 0xbe, 0xe0, 0x4a, 0xa4, 0xbd, 0x0c, 0xb7, 0x79, 0x3e,
-  0x48, 0x1b, 0x51, 0xbe, 0x28, 0xaf, 0x65, 0x3e, 0x20, 0x19, 0x33, 0x3d,
-  0xe8, 0xae, 0x61, 0xbd, 0xda, 0x68, 0x6f, 0x3e, 0x90, 0xc0, 0xdb, 0xbd,
-  0x67, 0xe8, 0xe4, 0x3c, 0xd6, 0x4a, 0xca, 0x3d, 0x54, 0xac, 0xd1, 0xbd,
-  0xc1, 0x74, 0x3a, 0xbe, 0x1f, 0xcd, 0xb4, 0x3d, 0x7b, 0xf7, 0x24, 0xbe,
-  0xe0, 0x95, 0x11, 0xbe, 0xdf, 0xc3, 0xef, 0xbd, 0xea, 0xc4, 0x26, 0xbe,
-  0x6f, 0x64, 0x88, 0x3e, 0xd0, 0xf2, 0x25, 0xbd, 0x21, 0x99, 0xbb, 0xbb,
-  0xa1, 0x5e, 0x09, 0x3d, 0xe7, 0x86, 0x4d, 0x3e, 0xc8, 0x02, 0x1c, 0xbe,
-  0xcb, 0xa8, 0x24, 0xbe, 0x4e, 0xc9, 0xe4, 0x3d, 0xdd, 0x95, 0xa7, 0x3e,
-  0x08, 0x03, 0x97, 0x3e, 0x7f, 0x64, 0x09, 0x3e, 0xc8, 0xd8, 0xd9, 0xbd,
-  0xab, 0x87, 0xb5, 0xbd, 0x84, 0x8e, 0x20, 0xbe, 0x37, 0x10, 0x55, 0xbe,
-  0xff, 0x25, 0xb1, 0xbc, 0x28, 0xd2, 0x94, 0x3d, 0x72, 0x0a, 0x1f, 0x3d,
-  0xbe, 0x79, 0x64, 0xbd, 0x68, 0x85, 0x74, 0xbe, 0xaf, 0x1b, 0x01, 0xbd,
-  0x24, 0xa9, 0xc1, 0xbe, 0x20, 0x5d, 0x10, 0x3d, 0xb3, 0x9f, 0x3d, 0x3e,
-  0x77, 0x90, 0x62, 0x3e, 0xa1, 0xfc, 0xd3, 0x3d, 0x4d, 0xa7, 0x53, 0x3d,
-  0xda, 0x5f, 0x0f, 0xbe, 0x66, 0x44, 0x4b, 0xbc, 0xf0, 0x34, 0x22, 0x3e,
-  0x60, 0x48, 0x33, 0xbd, 0xb8, 0x7b, 0x8f, 0xbd, 0x9d, 0xc1, 0x0a, 0xbe,
-  0xa0, 0x57, 0x11, 0xbd, 0x56, 0xb5, 0xc5, 0x3d, 0xf4, 0x5f, 0x62, 0xbe,
-  0x94, 0xcd, 0x90, 0x3e, 0xb1, 0x4f, 0x0d, 0xbe, 0x26, 0x28, 0xf1, 0x3d,
-  0x34, 0x81, 0x37, 0x3d, 0x40, 0x31, 0x6b, 0xbe, 0x85, 0x49, 0x87, 0x3e,
-  0x6d, 0xe6, 0x1a, 0x3e, 0x46, 0xc7, 0xde, 0xbd, 0x70, 0x1d, 0xac, 0xbe,
-  0x0e, 0xcf, 0xe9, 0x3c, 0x75, 0xc9, 0xa6, 0x3d, 0x84, 0x3b, 0x53, 0x3e,
-  0x20, 0xe9, 0x5a, 0x3d, 0xab, 0xcd, 0xa7, 0x3d, 0x91, 0x5d, 0xa0, 0x3d,
-  0x40, 0x75, 0x20, 0x3e, 0x22, 0xad, 0x40, 0x3e, 0x6f, 0x38, 0xb3, 0x3d,
-  0xbc, 0xc1, 0x41, 0x3e, 0xdb, 0x0c, 0xe4, 0xbd, 0x2f, 0xce, 0xea, 0x3d,
-  0x6b, 0xeb, 0x7f, 0x3e, 0x45, 0x80, 0xb7, 0xbd, 0xc7, 0x8f, 0x59, 0x3d,
-  0x8d, 0x12, 0x5e, 0xbe, 0x18, 0xf4, 0x69, 0x3e, 0x64, 0x7b, 0x0c, 0xbe,
-  0x13, 0xe5, 0xeb, 0x3c, 0x66, 0x2a, 0x6c, 0x3d, 0xe8, 0xc4, 0xff, 0xbd,
-  0x9e, 0xa1, 0x27, 0x3d, 0x49, 0x5b, 0x28, 0x3e, 0x7e, 0x6b, 0x2a, 0x3e,
-  0x70, 0x68, 0x2b, 0xbe, 0xda, 0x8e, 0x2c, 0x3e, 0xc3, 0x76, 0xda, 0x3e,
-  0x9d, 0x23, 0x43, 0xbe, 0x03, 0x04, 0x8e, 0x3e, 0x5c, 0xbc, 0x31, 0xbd,
-  0x5e, 0xe4, 0xc1, 0x3d, 0x09, 0x55, 0x06, 0xbe, 0x86, 0x1a, 0x3c, 0xbd,
-  0x93, 0x1c, 0x60, 0x3e, 0x2b, 0x51, 0x93, 0x3e, 0x3c, 0x14, 0x4e, 0xbe,
-  0xc5, 0xc1, 0x64, 0xbe, 0x42, 0xd8, 0x1d, 0xbd, 0x30, 0xe8, 0x35, 0xbe,
-  0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x91, 0x7a, 0xc4, 0x3d,
-  0x99, 0x24, 0xbc, 0x3e, 0xbf, 0xaa, 0xb5, 0xbd, 0x0e, 0x66, 0x75, 0x3e,
-  0x52, 0xd7, 0x7c, 0x3e, 0x9a, 0x09, 0x3e, 0x3d, 0x9e, 0x98, 0x31, 0x3e,
-  0xb3, 0x44, 0x24, 0xbe, 0xa9, 0x35, 0x34, 0x3d, 0xa9, 0x30, 0x99, 0xbd,
-  0x34, 0x31, 0x46, 0x3d, 0x2e, 0x68, 0xad, 0xbe, 0x4b, 0x3c, 0x0c, 0xbe,
-  0x90, 0xe1, 0xf1, 0xbc, 0xd6, 0x64, 0x90, 0xbe, 0x01, 0x2f, 0x1c, 0xbe,
-  0x45, 0x98, 0x43, 0x3e, 0x5d, 0xf3, 0x20, 0x3e, 0x27, 0x52, 0x07, 0xbe,
-  0x5e, 0xf3, 0x36, 0xbe, 0xa2, 0x0a, 0x13, 0xbe, 0xf0, 0x41, 0x7e, 0x3e,
-  0xe0, 0x4c, 0x99, 0xbe, 0xff, 0xb1, 0xbf, 0xbd, 0xd6, 0x04, 0x3b, 0xbe,
-  0xe5, 0x46, 0x3d, 0x3d, 0x93, 0xe3, 0x96, 0xbe, 0x99, 0xec, 0xc0, 0xbd,
-  0x8e, 0xef, 0x00, 0xbe, 0xed, 0x30, 0x8f, 0xbe, 0x54, 0xa9, 0x0d, 0xbe,
-  0xfc, 0xf7, 0x98, 0x3b, 0xa4, 0x77, 0xb0, 0xbe, 0x3a, 0x2d, 0xe6, 0xbd,
-  0x1c, 0xec, 0x28, 0xbd, 0x80, 0xdf, 0x8a, 0x3d, 0x18, 0x04, 0x65, 0xbe,
-  0x8c, 0x9c, 0x4a, 0x3e, 0xcf, 0x0d, 0xcb, 0x3e, 0x33, 0xc9, 0x38, 0x3e,
-  0xff, 0xdc, 0x88, 0xbc, 0xc5, 0x00, 0x70, 0x3e, 0x23, 0xe5, 0x36, 0xbe,
-  0x4c, 0x63, 0x16, 0xbf, 0x21, 0x48, 0x92, 0x3d, 0x03, 0xee, 0x47, 0x3d,
-  0x87, 0x5b, 0x44, 0x3d, 0x84, 0x9f, 0x2c, 0x3e, 0xc7, 0x9a, 0x66, 0xbe,
-  0xda, 0xf0, 0x62, 0x3d, 0x0f, 0x77, 0x48, 0xbe, 0x58, 0x22, 0x69, 0x3e,
-  0xf8, 0x60, 0x0c, 0xbe, 0x35, 0xe9, 0x81, 0xbe, 0x52, 0xdd, 0xb2, 0x3d,
-  0x23, 0x3e, 0xca, 0x3e, 0xcb, 0x73, 0x07, 0xbe, 0xe8, 0x24, 0x2f, 0xbe,
-  0x32, 0x34, 0x72, 0xbe, 0xf3, 0x4e, 0x6b, 0x3d, 0x06, 0xe4, 0x8a, 0xbe,
-  0x02, 0xf7, 0xa6, 0x3e, 0xe6, 0xba, 0x14, 0x3d, 0x31, 0xea, 0x29, 0x3c,
-  0x0d, 0x44, 0x75, 0x3e, 0x22, 0xc9, 0x68, 0xbd, 0xb0, 0xb8, 0x56, 0xbe,
-  0xce, 0x01, 0xd9, 0xbd, 0x2f, 0x84, 0x8a, 0x3e, 0x75, 0xc8, 0x0f, 0x3e,
-  0x3d, 0x53, 0x59, 0xbe, 0x25, 0xd0, 0xa8, 0xbe, 0x81, 0x87, 0x9b, 0xbe,
-  0x23, 0x70, 0xde, 0x3d, 0xa3, 0xfc, 0x77, 0xbe, 0x1b, 0x00, 0x0d, 0xbe,
-  0x92, 0xcc, 0x29, 0x3e, 0xb4, 0x17, 0x37, 0x3e, 0xd7, 0x7d, 0x6f, 0xbe,
-  0x14, 0xa4, 0x84, 0xbe, 0xb2, 0x7a, 0x39, 0x3d, 0x53, 0x3d, 0xb3, 0x3e,
-  0x2d, 0x28, 0x87, 0xbe, 0x62, 0x88, 0x5a, 0x3e, 0xf5, 0x63, 0xd9, 0xbd,
-  0x3b, 0x49, 0x27, 0xbe, 0x13, 0xc0, 0x8f, 0xbb, 0x2e, 0x86, 0xc4, 0x3d,
-  0x6d, 0x80, 0xc7, 0x3e, 0xb5, 0xec, 0x56, 0xbe, 0x40, 0x7e, 0x48, 0xbe,
-  0x5f, 0x7a, 0xf9, 0xbd, 0x6d, 0xc3, 0x03, 0xbe, 0x51, 0x31, 0xb8, 0xbe,
-  0x75, 0xbc, 0x83, 0xbb, 0x01, 0x30, 0xba, 0x3d, 0x81, 0xe8, 0x85, 0xbe,
-  0x02, 0x81, 0x9d, 0x3e, 0x93, 0x3d, 0x58, 0xbe, 0xc8, 0xab, 0xc3, 0xbd,
-  0xe2, 0x99, 0x39, 0xbe, 0xd2, 0x99, 0x78, 0x3e, 0x90, 0xab, 0x63, 0xb9,
-  0x76, 0x7f, 0x97, 0x3e, 0x3a, 0xa1, 0xe9, 0xbe, 0x0c, 0x8c, 0xa9, 0x3d,
-  0x9b, 0xa7, 0x1e, 0x3e, 0xfe, 0x2a, 0x53, 0xbe, 0x41, 0x75, 0x21, 0xbe,
-  0x25, 0xbf, 0xc7, 0x3d, 0xd4, 0xc7, 0xa3, 0xbd, 0x5c, 0xf1, 0x6b, 0xbe,
-  0x02, 0xbe, 0x94, 0x3e, 0xd7, 0x89, 0xd3, 0xbc, 0xca, 0xb5, 0xb1, 0xbe,
-  0x62, 0x08, 0x25, 0x3d, 0xc4, 0x18, 0x20, 0x3e, 0x15, 0x3d, 0xb6, 0x3c,
-  0x6d, 0xbe, 0xb2, 0x3d, 0x1b, 0x9f, 0xad, 0x3e, 0x24, 0x88, 0xc3, 0x3e,
-  0x14, 0x43, 0xe2, 0xbd, 0x01, 0xf1, 0x13, 0x3e, 0x77, 0x85, 0xca, 0xbe,
-  0x74, 0x52, 0xaf, 0x3d, 0x03, 0xbe, 0xc8, 0x3d, 0xd5, 0x15, 0xb9, 0x3d,
-  0x0a, 0x24, 0x7c, 0xbe, 0x27, 0x29, 0x2c, 0xbe, 0x89, 0x75, 0x9b, 0x3e,
-  0x5f, 0xc8, 0x6a, 0xbe, 0xba, 0x7e, 0x11, 0x3e, 0xb2, 0x75, 0x54, 0x3e,
-  0xbe, 0x17, 0x99, 0xbe, 0x69, 0xbe, 0x06, 0xbe, 0x7c, 0xe2, 0x8f, 0x3e,
-  0xc4, 0x97, 0xe2, 0x3c, 0x34, 0x3a, 0x53, 0x3e, 0xec, 0xfb, 0x0e, 0x3e,
-  0x27, 0x13, 0xbb, 0xbd, 0xc3, 0xcd, 0x44, 0xbe, 0x01, 0x10, 0x93, 0xbe,
-  0x33, 0x4d, 0x88, 0xbe, 0xe2, 0x1a, 0x22, 0xbe, 0x56, 0x88, 0x44, 0x3e,
-  0xed, 0x54, 0x43, 0x3e, 0x35, 0x2b, 0x3a, 0xbe, 0xee, 0xad, 0xb4, 0x3e,
-  0x61, 0xc5, 0x90, 0xbe, 0xdf, 0x2e, 0xbf, 0xba, 0x25, 0x6c, 0xd0, 0x3d,
-  0xf5, 0x2b, 0x82, 0xbd, 0x13, 0x5a, 0x5f, 0xbe, 0x18, 0x1a, 0x49, 0x3e,
-  0xfe, 0x63, 0xaf, 0x3e, 0x0a, 0x7c, 0xb9, 0xbe, 0x73, 0x0b, 0x81, 0xbe,
-  0x69, 0x5c, 0xa1, 0xbc, 0xf1, 0xcd, 0x15, 0xbe, 0x7b, 0x5b, 0xd6, 0xbd,
-  0xc6, 0x96, 0x60, 0x3d, 0x45, 0xf9, 0x0c, 0xbe, 0x19, 0x8d, 0x89, 0xbe,
-  0xfe, 0x22, 0xf1, 0xbd, 0xae, 0x5e, 0xdb, 0xbd, 0x2f, 0x1d, 0x4c, 0xbd,
-  0x02, 0x2a, 0xb4, 0xbd, 0x1b, 0xe3, 0x1e, 0x3e, 0xdf, 0x19, 0x5f, 0x3d,
-  0x2f, 0xec, 0x4b, 0x3d, 0x1d, 0x76, 0x82, 0xbe, 0x54, 0x61, 0x22, 0x3d,
-  0xd6, 0x01, 0x91, 0xbd, 0xe9, 0xc9, 0xa0, 0xbe, 0x49, 0xdc, 0x9e, 0xbe,
-  0x3f, 0xd7, 0x2d, 0xbd, 0x63, 0x94, 0x98, 0x3e, 0x03, 0xe4, 0x99, 0xbe,
-  0xe0, 0xbd, 0x69, 0xbc, 0xd4, 0xb9, 0x55, 0x3d, 0xbc, 0x59, 0xf8, 0x3d,
-  0x76, 0xd8, 0x74, 0xbe, 0x7d, 0x57, 0x92, 0xbd, 0xb0, 0x59, 0x60, 0x3e,
-  0x60, 0x5a, 0x14, 0xbd, 0x2c, 0xe1, 0x15, 0x3e, 0xb5, 0xa2, 0xc5, 0xbd,
-  0x7b, 0xeb, 0xbe, 0xbd, 0xfe, 0x0c, 0x98, 0x3e, 0x09, 0x5a, 0x8c, 0x3e,
-  0xe3, 0x8b, 0x06, 0xbe, 0xb5, 0x67, 0x7c, 0xbe, 0xb8, 0xf5, 0xff, 0xff,
-  0xbc, 0xf5, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x4d, 0x4c, 0x49, 0x52,
-  0x20, 0x43, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x65, 0x64, 0x2e, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
-  0x18, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00,
-  0x0e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0xb0, 0x01, 0x00, 0x00, 0xb4, 0x01, 0x00, 0x00, 0xb8, 0x01, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00,
-  0x07, 0x00, 0x00, 0x00, 0x58, 0x01, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00,
-  0xd8, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00,
-  0x34, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00,
-  0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x12, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x08, 0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x70, 0xf6, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x0b, 0x00, 0x00, 0x00, 0x2e, 0xff, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x1e, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
-  0x11, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x62, 0xff, 0xff, 0xff,
-  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x52, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x0f, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
-  0x96, 0xff, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
-  0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x86, 0xff, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0xca, 0xff, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0xba, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
-  0x0e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
-  0x05, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
-  0x16, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x04, 0x00,
-  0x0e, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
-  0x18, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
-  0x08, 0x00, 0x07, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x01, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1c, 0x08, 0x00, 0x00,
-  0xc4, 0x07, 0x00, 0x00, 0x6c, 0x07, 0x00, 0x00, 0x2c, 0x07, 0x00, 0x00,
-  0xec, 0x06, 0x00, 0x00, 0xac, 0x06, 0x00, 0x00, 0x4c, 0x06, 0x00, 0x00,
-  0xec, 0x05, 0x00, 0x00, 0x8c, 0x05, 0x00, 0x00, 0x2c, 0x05, 0x00, 0x00,
-  0xcc, 0x04, 0x00, 0x00, 0x6c, 0x04, 0x00, 0x00, 0x18, 0x04, 0x00, 0x00,
-  0x74, 0x03, 0x00, 0x00, 0xd0, 0x02, 0x00, 0x00, 0x2c, 0x02, 0x00, 0x00,
-  0x88, 0x01, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x4a, 0xf8, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x34, 0xf8, 0xff, 0xff,
-  0x1b, 0x00, 0x00, 0x00, 0x53, 0x74, 0x61, 0x74, 0x65, 0x66, 0x75, 0x6c,
-  0x50, 0x61, 0x72, 0x74, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x65, 0x64, 0x43,
-  0x61, 0x6c, 0x6c, 0x5f, 0x31, 0x3a, 0x30, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xa2, 0xf8, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x1c, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00,
-  0x8c, 0xf8, 0xff, 0xff, 0x42, 0x00, 0x00, 0x00, 0x66, 0x75, 0x6e, 0x63,
-  0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x32, 0x5f, 0x31, 0x2f, 0x64,
-  0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31, 0x37, 0x5f, 0x31, 0x2f, 0x4d, 0x61,
-  0x74, 0x4d, 0x75, 0x6c, 0x3b, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f,
-  0x6e, 0x61, 0x6c, 0x5f, 0x32, 0x5f, 0x31, 0x2f, 0x64, 0x65, 0x6e, 0x73,
-  0x65, 0x5f, 0x31, 0x37, 0x5f, 0x31, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41,
-  0x64, 0x64, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x22, 0xf9, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x12, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x0c, 0xf9, 0xff, 0xff,
-  0x61, 0x00, 0x00, 0x00, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e,
-  0x61, 0x6c, 0x5f, 0x32, 0x5f, 0x31, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65,
-  0x5f, 0x31, 0x36, 0x5f, 0x31, 0x2f, 0x4d, 0x61, 0x74, 0x4d, 0x75, 0x6c,
-  0x3b, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f,
-  0x32, 0x5f, 0x31, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31, 0x36,
-  0x5f, 0x31, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x66, 0x75, 0x6e, 0x63,
-  0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x32, 0x5f, 0x31, 0x2f, 0x64,
-  0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31, 0x36, 0x5f, 0x31, 0x2f, 0x42, 0x69,
-  0x61, 0x73, 0x41, 0x64, 0x64, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xc2, 0xf9, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x1c, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00,
-  0xac, 0xf9, 0xff, 0xff, 0x61, 0x00, 0x00, 0x00, 0x66, 0x75, 0x6e, 0x63,
-  0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x32, 0x5f, 0x31, 0x2f, 0x64,
-  0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31, 0x35, 0x5f, 0x31, 0x2f, 0x4d, 0x61,
-  0x74, 0x4d, 0x75, 0x6c, 0x3b, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f,
-  0x6e, 0x61, 0x6c, 0x5f, 0x32, 0x5f, 0x31, 0x2f, 0x64, 0x65, 0x6e, 0x73,
-  0x65, 0x5f, 0x31, 0x35, 0x5f, 0x31, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b,
-  0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x32,
-  0x5f, 0x31, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31, 0x35, 0x5f,
-  0x31, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x62, 0xfa, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x1c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x7c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0x10, 0x00, 0x00, 0x00, 0x4c, 0xfa, 0xff, 0xff, 0x61, 0x00, 0x00, 0x00,
-  0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x32,
-  0x5f, 0x31, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31, 0x34, 0x5f,
-  0x31, 0x2f, 0x4d, 0x61, 0x74, 0x4d, 0x75, 0x6c, 0x3b, 0x66, 0x75, 0x6e,
-  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x32, 0x5f, 0x31, 0x2f,
-  0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31, 0x34, 0x5f, 0x31, 0x2f, 0x52,
-  0x65, 0x6c, 0x75, 0x3b, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e,
-  0x61, 0x6c, 0x5f, 0x32, 0x5f, 0x31, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65,
-  0x5f, 0x31, 0x34, 0x5f, 0x31, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64,
-  0x64, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x02, 0xfb, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x0f, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00, 0xec, 0xfa, 0xff, 0xff,
-  0x61, 0x00, 0x00, 0x00, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e,
-  0x61, 0x6c, 0x5f, 0x32, 0x5f, 0x31, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65,
-  0x5f, 0x31, 0x33, 0x5f, 0x31, 0x2f, 0x4d, 0x61, 0x74, 0x4d, 0x75, 0x6c,
-  0x3b, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f,
-  0x32, 0x5f, 0x31, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31, 0x33,
-  0x5f, 0x31, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x66, 0x75, 0x6e, 0x63,
-  0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x32, 0x5f, 0x31, 0x2f, 0x64,
-  0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31, 0x33, 0x5f, 0x31, 0x2f, 0x42, 0x69,
-  0x61, 0x73, 0x41, 0x64, 0x64, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xa2, 0xfb, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x1c, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00,
-  0x8c, 0xfb, 0xff, 0xff, 0x61, 0x00, 0x00, 0x00, 0x66, 0x75, 0x6e, 0x63,
-  0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x32, 0x5f, 0x31, 0x2f, 0x64,
-  0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31, 0x32, 0x5f, 0x31, 0x2f, 0x4d, 0x61,
-  0x74, 0x4d, 0x75, 0x6c, 0x3b, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f,
-  0x6e, 0x61, 0x6c, 0x5f, 0x32, 0x5f, 0x31, 0x2f, 0x64, 0x65, 0x6e, 0x73,
-  0x65, 0x5f, 0x31, 0x32, 0x5f, 0x31, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b,
-  0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x32,
-  0x5f, 0x31, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31, 0x32, 0x5f,
-  0x31, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x96, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0x1c, 0xfc, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00, 0x66, 0x75, 0x6e, 0x63,
-  0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x32, 0x5f, 0x31, 0x2f, 0x64,
-  0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31, 0x32, 0x5f, 0x31, 0x2f, 0x4d, 0x61,
-  0x74, 0x4d, 0x75, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xe6, 0xfc, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x6c, 0xfc, 0xff, 0xff,
-  0x30, 0x00, 0x00, 0x00, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e,
-  0x61, 0x6c, 0x5f, 0x32, 0x5f, 0x31, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65,
-  0x5f, 0x31, 0x37, 0x5f, 0x31, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64,
-  0x64, 0x2f, 0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62,
-  0x6c, 0x65, 0x4f, 0x70, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x42, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0xc8, 0xfc, 0xff, 0xff, 0x30, 0x00, 0x00, 0x00,
-  0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x32,
-  0x5f, 0x31, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31, 0x36, 0x5f,
-  0x31, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65,
-  0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x9e, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x24, 0xfd, 0xff, 0xff, 0x30, 0x00, 0x00, 0x00, 0x66, 0x75, 0x6e, 0x63,
-  0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x32, 0x5f, 0x31, 0x2f, 0x64,
-  0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31, 0x35, 0x5f, 0x31, 0x2f, 0x42, 0x69,
-  0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64, 0x56, 0x61,
-  0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xfa, 0xfd, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x09, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x80, 0xfd, 0xff, 0xff,
-  0x30, 0x00, 0x00, 0x00, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e,
-  0x61, 0x6c, 0x5f, 0x32, 0x5f, 0x31, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65,
-  0x5f, 0x31, 0x34, 0x5f, 0x31, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64,
-  0x64, 0x2f, 0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62,
-  0x6c, 0x65, 0x4f, 0x70, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x56, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0xdc, 0xfd, 0xff, 0xff, 0x30, 0x00, 0x00, 0x00,
-  0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x32,
-  0x5f, 0x31, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31, 0x33, 0x5f,
-  0x31, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65,
-  0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0xb2, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x38, 0xfe, 0xff, 0xff, 0x30, 0x00, 0x00, 0x00, 0x66, 0x75, 0x6e, 0x63,
-  0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x32, 0x5f, 0x31, 0x2f, 0x64,
-  0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31, 0x32, 0x5f, 0x31, 0x2f, 0x42, 0x69,
-  0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64, 0x56, 0x61,
-  0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x06, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x94, 0xfe, 0xff, 0xff,
-  0x0f, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f,
-  0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x34, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x4a, 0xff, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x05, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0xd0, 0xfe, 0xff, 0xff,
-  0x0f, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f,
-  0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x33, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x86, 0xff, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xff, 0xff,
-  0x0f, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f,
-  0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x32, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xc2, 0xff, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x48, 0xff, 0xff, 0xff,
-  0x0f, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f,
-  0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x31, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00,
-  0x18, 0x00, 0x14, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x16, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x9c, 0xff, 0xff, 0xff,
-  0x0e, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f,
-  0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00,
-  0x1c, 0x00, 0x18, 0x00, 0x00, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x07, 0x00, 0x16, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
-  0x73, 0x65, 0x72, 0x76, 0x69, 0x6e, 0x67, 0x5f, 0x64, 0x65, 0x66, 0x61,
-  0x75, 0x6c, 0x74, 0x5f, 0x6b, 0x65, 0x72, 0x61, 0x73, 0x5f, 0x74, 0x65,
-  0x6e, 0x73, 0x6f, 0x72, 0x5f, 0x31, 0x34, 0x3a, 0x30, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0xf4, 0xff, 0xff, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
-  0x0c, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09
-};
-unsigned int autoencoder_tflite_len = 26280;
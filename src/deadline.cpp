@@ -0,0 +1,44 @@
+/*
+//  deadline.cpp - Latency, slack and deadline-miss accounting for the periodic inference thread
+*/
+
+#include "deadline.h"
+#include <string.h>
+
+static DeadlineStats stats;
+static uint64_t total_latency_us;
+
+extern "C" void deadline_record(uint32_t start_delay_us, uint32_t latency_us, uint32_t deadline_us, uint32_t skipped)
+{
+    int32_t slack_us = (int32_t)(deadline_us - latency_us);
+
+    if (stats.runs == 0 || slack_us < stats.min_slack_us) stats.min_slack_us = slack_us;
+    if (latency_us > stats.max_latency_us) stats.max_latency_us = latency_us;
+    if (start_delay_us > stats.max_start_delay_us) stats.max_start_delay_us = start_delay_us;
+
+    stats.runs++;
+    stats.skipped += skipped;
+    if (slack_us < 0) stats.misses++;
+
+    total_latency_us += latency_us;
+    stats.avg_latency_us = (uint32_t)(total_latency_us / stats.runs);
+    stats.last_latency_us = latency_us;
+    stats.last_slack_us = slack_us;
+}
+
+extern "C" void deadline_record_idle(uint32_t skipped)
+{
+    stats.idle++;
+    stats.skipped += skipped;
+}
+
+extern "C" void deadline_get_stats(DeadlineStats* out)
+{
+    if (out != NULL) *out = stats;
+}
+
+extern "C" void deadline_reset(void)
+{
+    memset(&stats, 0, sizeof(stats));
+    total_latency_us = 0;
+}
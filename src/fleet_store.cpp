@@ -0,0 +1,218 @@
+/*
+//  fleet_store.cpp - Structure-of-arrays sensor values for the whole fleet
+//
+//  MachineHandle is an index into these arrays. Each SensorKind has one
+//  cache-line aligned column holding its latest value for every machine; a
+//  Machine's Sensor objects keep their sample rings but read and write their
+//  value through a pointer to their cell here. Sweeps over the fleet (window
+//  packing, printing, range checks) walk a column linearly instead of
+//  following Machine -> vector -> unique_ptr -> Sensor for every value.
+*/
+
+#include "fleet_store.h"
+#include "sensor.h"
+#include <string.h>
+
+#ifdef APP_BENCHMARK
+#include <stdlib.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#endif
+
+alignas(FLEET_CACHE_LINE) static float columns[NUM_SENSOR_KINDS][FLEET_COLUMN_STRIDE];
+static uint8_t masks[FLEET_MAX_MACHINES];
+static uint8_t types[FLEET_MAX_MACHINES];
+static Machine* machines[FLEET_MAX_MACHINES];
+static int size;                        // One past the highest handle in use
+static int first_free;                  // No free handle below this one
+
+static bool valid(MachineHandle handle)
+{
+    return handle >= 0 && handle < size && machines[handle] != nullptr;
+}
+
+MachineHandle fleet_add(Machine* machine, MachineType type, uint8_t sensor_mask)
+{
+    int handle = first_free;
+    while (handle < FLEET_MAX_MACHINES && machines[handle] != nullptr) handle++;
+    if (handle == FLEET_MAX_MACHINES) return -1;
+
+    for (int kind = 0; kind < NUM_SENSOR_KINDS; kind++) {
+        columns[kind][handle] = 0.0f;
+    }
+    masks[handle] = sensor_mask;
+    types[handle] = (uint8_t)type;
+    machines[handle] = machine;
+    first_free = handle + 1;
+    if (handle >= size) size = handle + 1;
+    return handle;
+}
+
+void fleet_remove(MachineHandle handle)
+{
+    if (!valid(handle)) return;
+
+    machines[handle] = nullptr;
+    masks[handle] = 0;
+    for (int kind = 0; kind < NUM_SENSOR_KINDS; kind++) {
+        columns[kind][handle] = 0.0f;
+    }
+    if (handle < first_free) first_free = handle;
+    while (size > 0 && machines[size - 1] == nullptr) size--;
+}
+
+Machine* fleet_machine(MachineHandle handle)
+{
+    return valid(handle) ? machines[handle] : nullptr;
+}
+
+MachineType fleet_type(MachineHandle handle)
+{
+    return valid(handle) ? (MachineType)types[handle] : NUM_MACHINE_TYPES;
+}
+
+float* fleet_cell(SensorKind kind, MachineHandle handle)
+{
+    if (kind < 0 || kind >= NUM_SENSOR_KINDS || handle < 0 || handle >= FLEET_MAX_MACHINES) return nullptr;
+    return &columns[kind][handle];
+}
+
+extern "C" int fleet_size(void)
+{
+    return size;
+}
+
+extern "C" const float* fleet_column(SensorKind kind)
+{
+    return kind >= 0 && kind < NUM_SENSOR_KINDS ? columns[kind] : nullptr;
+}
+
+extern "C" const uint8_t* fleet_sensor_masks(void)
+{
+    return masks;
+}
+
+extern "C" int fleet_count_out_of_range(SensorKind kind, float min_value, float max_value)
+{
+    if (kind < 0 || kind >= NUM_SENSOR_KINDS) return 0;
+
+    // Branch-free so the loop vectorizes; cells of machines without the sensor are masked out
+    const float* column = columns[kind];
+    int count = 0;
+    for (int i = 0; i < size; i++) {
+        float v = column[i];
+        count += ((masks[i] >> kind) & 1) & ((v < min_value) | (v > max_value));
+    }
+    return count;
+}
+
+#ifdef APP_BENCHMARK
+
+#define FLEET_BENCH_VALUES      3000000     // Sensor values read per fleet size, spread over repeated sweeps
+#define FLEET_BENCH_MIN         0.05f       // Range the sweeps check every value against
+#define FLEET_BENCH_MAX         0.95f
+
+// The layout before the store: each machine a heap object owning heap-allocated sensors behind a
+// vector of unique_ptrs, every value read through a virtual call
+struct HeapSensor {
+    virtual ~HeapSensor() {}
+    virtual float readValue() const { return value; }
+    float value = 0.0f;
+    SensorHistory history;
+};
+
+struct HeapMachine {
+    std::string name;
+    MachineType type;
+    std::vector<std::unique_ptr<HeapSensor>> sensors;
+};
+
+static volatile int fleet_sink;
+
+// Out-of-range count over every sensor of every machine, object by object
+static int sweep_objects(const std::vector<std::unique_ptr<HeapMachine>>& fleet)
+{
+    int out = 0;
+    for (const auto& machine : fleet) {
+        for (const auto& sensor : machine->sensors) {
+            float v = sensor->readValue();
+            out += (v < FLEET_BENCH_MIN) | (v > FLEET_BENCH_MAX);
+        }
+    }
+    return out;
+}
+
+// The same check column by column over the store
+static int sweep_columns(void)
+{
+    int out = 0;
+    for (int kind = 0; kind < NUM_SENSOR_KINDS; kind++) {
+        out += fleet_count_out_of_range((SensorKind)kind, FLEET_BENCH_MIN, FLEET_BENCH_MAX);
+    }
+    return out;
+}
+
+static void bench_fleet(int count)
+{
+    static const MachineType kinds_of[] = {AIR_COMPRESSOR, STEAM_BOILER, ELECTRIC_MOTOR};
+    std::vector<MachineHandle> handles;
+    std::vector<std::unique_ptr<HeapMachine>> objects;
+    int values = 0;
+
+    // The same machines and values in both layouts, created in the same order
+    for (int i = 0; i < count; i++) {
+        MachineType type = kinds_of[i % 3];
+        MachineHandle handle = create_machine("Fleet", type);
+        if (handle < 0) break;
+        handles.push_back(handle);
+
+        std::unique_ptr<HeapMachine> object(new HeapMachine{"Fleet", type, {}});
+        fleet_machine(handle)->forEachSensor([&](Sensor& sensor) {
+            float v = rand() / (float)RAND_MAX;
+            sensor.setValue(v);
+            object->sensors.push_back(std::unique_ptr<HeapSensor>(new HeapSensor()));
+            object->sensors.back()->value = v;
+            values++;
+        });
+        objects.push_back(std::move(object));
+    }
+
+    if ((int)handles.size() < count) {
+        printk("%8d   skipped: the store holds %d machines (APP_FLEET_MAX_MACHINES)\n", count, FLEET_MAX_MACHINES);
+    } else {
+        int reps = 1 + FLEET_BENCH_VALUES / values;
+        int object_out = 0, column_out = 0;
+
+        uint32_t start = k_cycle_get_32();
+        for (int r = 0; r < reps; r++) object_out += sweep_objects(objects);
+        uint32_t object_cycles = k_cycle_get_32() - start;
+
+        start = k_cycle_get_32();
+        for (int r = 0; r < reps; r++) column_out += sweep_columns();
+        uint32_t column_cycles = k_cycle_get_32() - start;
+
+        // Tenths of a nanosecond per sensor value
+        uint32_t object_dns = (uint32_t)(k_cyc_to_ns_floor64(object_cycles) * 10 / ((uint64_t)reps * values));
+        uint32_t column_dns = (uint32_t)(k_cyc_to_ns_floor64(column_cycles) * 10 / ((uint64_t)reps * values));
+        printk("%8d %8d %8u.%u %8u.%u %8.2fx %s\n", count, values, object_dns / 10, object_dns % 10,
+            column_dns / 10, column_dns % 10, (double)(column_dns > 0 ? (float)object_dns / column_dns : 0.0f),
+            object_out == column_out ? "" : "MISMATCH");
+        fleet_sink = object_out + column_out;
+    }
+
+    for (MachineHandle handle : handles) {
+        destroy_machine(handle);
+    }
+}
+
+extern "C" void fleet_run_benchmark(void)
+{
+    printk("\nFleet range check (every sensor value against [%.2f, %.2f]), ns per value:\n",
+        (double)FLEET_BENCH_MIN, (double)FLEET_BENCH_MAX);
+    printk("%8s %8s %10s %10s %9s\n", "machines", "values", "objects", "columns", "speedup");
+    bench_fleet(10);
+    bench_fleet(1000);
+    bench_fleet(100000);
+}
+
+#endif // APP_BENCHMARK
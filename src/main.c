@@ -4,7 +4,20 @@
 
 #include "demo.h"
 #include "sensor_wrapper.h"
+#include "fleet_store.h"
+#include "object_pool.h"
 #include "tflite_wrapper.h"
+#include "window_buffer.h"
+#include "prefilter.h"
+#include "score_cache.h"
+#include "anomaly.h"
+#include "sample_ring.h"
+#include "sparse_kernels.h"
+#include "deadline.h"
+#ifdef APP_MODEL_UPDATE_DEMO
+#include "autoencoder_model.h"
+#include "model_store.h"
+#endif
 #include <time.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -18,12 +31,34 @@
 #define PRIORITY             7
 #define STACKSIZE           1024
 #define NUM_MACHINES         3
+#define PROFILE_REPORT_EVERY 12         // Inference cycles between per-op latency reports
+#define SAMPLE_PERIOD_MS     5000       // One window per machine every period
+#define INFERENCE_PRIORITY   (PRIORITY + 3)     // Below every other thread so sampling never waits on Invoke()
+#define INFERENCE_OFFSET_MS  100                // Release after the sampling pass so its window is published
+#define INFERENCE_DEADLINE_MS (SAMPLE_PERIOD_MS - INFERENCE_OFFSET_MS)   // Finish before the next sampling pass
+#define UPDATE_PRIORITY      (PRIORITY + 4)     // Model updates are built behind inference
+#define UPDATE_DELAY_MS      30000              // Simulated model update lands this long after boot
+#define TREND_WINDOW_MS      60000              // print_data() averages each sensor's log over this much history
+
+BUILD_ASSERT(NUM_MACHINES <= WINDOW_BUFFER_MAX_MACHINES, "Window frames too small for NUM_MACHINES");
+BUILD_ASSERT(NUM_MACHINES <= PREFILTER_MAX_MACHINES, "Prefilter tracks too few machines");
+BUILD_ASSERT(NUM_MACHINES <= ANOMALY_MAX_MACHINES, "Anomaly thresholds track too few machines");
+BUILD_ASSERT(NUM_MACHINES <= SCORE_CACHE_MAX_MACHINES, "Score cache tracks too few machines");
+BUILD_ASSERT(NUM_MACHINES <= FLEET_MAX_MACHINES, "Fleet store holds too few machines");
 
 #define LED0_NODE DT_ALIAS(led0)     // The devicetree node identifier for the "led0" alias
 
 static const struct gpio_dt_spec led = GPIO_DT_SPEC_GET(LED0_NODE, gpios);
 
 MachineHandle machines[NUM_MACHINES];
+static SensorId sensor_ids[NUM_MACHINES][NUM_SENSOR_KINDS];    // Each configured sensor's slot, resolved once at startup
+
+K_TIMER_DEFINE(inference_timer, NULL, NULL);        // Absolute periodic release of the inference thread
+
+// Both schedules count periods from set_data()'s first pass: sampling pass n runs at
+// schedule_epoch_ms + n * SAMPLE_PERIOD_MS, and its inference release INFERENCE_OFFSET_MS later
+static int64_t schedule_epoch_ms;
+K_SEM_DEFINE(schedule_sem, 0, 1);                   // Given once schedule_epoch_ms is set
 
 static const MachineConfig machine_configs[] = 
 {
@@ -47,6 +82,19 @@ static const MachineConfig machine_configs[] =
     }
 };
 
+// Print which ops dominate inference latency on this board
+void print_op_profile(InferencePath path)
+{
+    OpProfile profiles[8];
+    int n = tflite_get_op_profile(path, profiles, sizeof(profiles) / sizeof(profiles[0]));
+
+    for (int i=0; i<n; i++) {
+        printk("  op %d %-16s n=%u  min %u  avg %u  max %u  p99 %u cycles\n",
+            profiles[i].op_index, profiles[i].tag ? profiles[i].tag : "?", profiles[i].samples,
+            profiles[i].min_cycles, profiles[i].avg_cycles, profiles[i].max_cycles, profiles[i].p99_cycles);
+    }
+}
+
 void generate_machines() 
 {
     //   To create and add machine:
@@ -58,6 +106,14 @@ void generate_machines()
     machines[1] = create_machine("Steam_Boiler_1", STEAM_BOILER);
     machines[2] = create_machine("Electric_Motor_1", ELECTRIC_MOTOR);
 
+    // Resolve every configured sensor name to its slot once; sampling reads and writes by ID
+    for (int i=0; i<NUM_MACHINES; i++) {
+        const MachineConfig* config = &machine_configs[get_machine_type(machines[i])];
+        for (int s=0; s < config->num_sensors; s++) {
+            sensor_ids[i][s] = find_sensor(machines[i], config->sensors[s].name);
+        }
+    }
+
     // Print Machine details - name, sensors
     for (int i=0; i<NUM_MACHINES; i++) {
         describe_machine(machines[i]);
@@ -85,10 +141,22 @@ void blink0(void) {
 }
 
 // Thread to read the sensor data into the machines
+// Each pass adds one sample per sensor to the machines' rings and the back frame; the frame is
+// published as a window once every ring is full and SENSOR_WINDOW_HOP samples past the last one
 void set_data(void) 
 {
+    int64_t next_ms = k_uptime_get();
+    int32_t max_jitter_us = 0;
+
+    schedule_epoch_ms = next_ms;
+    k_sem_give(&schedule_sem);
+
     while (1)
     {
+        // Wake-up lateness against the absolute schedule; inference runs below this thread's priority
+        int32_t jitter_us = (int32_t)(k_ticks_to_us_floor64(k_uptime_ticks()) - next_ms * 1000);
+        if (jitter_us > max_jitter_us) max_jitter_us = jitter_us;
+
         printf("\nSet machines values:\n");
         for (int i=0; i<NUM_MACHINES; i++)              // Set values for all the sensors in each machine
         {
@@ -101,6 +169,7 @@ void set_data(void)
             const MachineConfig* config = &machine_configs[type];           // Use MachineType to index into machine_configs 
 
             printf("%s:", config->name);
+            float values[NUM_SENSOR_KINDS] = {0.0f};
             for (int s=0; s < config->num_sensors; s++) {
                 const SensorConfig* sensor = &config->sensors[s];
                 
@@ -109,7 +178,8 @@ void set_data(void)
                 float range = sensor->max_value - sensor->min_value;
                 float value = sensor->min_value + (rand() / (float)RAND_MAX) * range;
 
-                set_sensor_value(machines[i], sensor->name, value);
+                values[s] = value;
+                window_buffer_write(i, s, (value - sensor->min_value) / range);
                 if (s == 0) {
                     printf(" %s = %.2f  [range %.1f-%.1f]\n",  
                         sensor->name, (double)value, (double)sensor->min_value, (double)sensor->max_value);
@@ -118,13 +188,41 @@ void set_data(void)
                         sensor->name, (double)value, (double)sensor->min_value, (double)sensor->max_value);
                 }
             }
+            set_machine_values(machines[i], values);                        // The whole machine in one unrolled write
+        }
+
+        int ready = 1;
+        for (int i=0; i<NUM_MACHINES; i++) ready &= machine_window_ready(machines[i]);
+        // Window boundary: swap the back frame to the front. While the consumer still holds the
+        // front frame the swap is deferred and the rings stay ready, so the next sample retries.
+        if (ready && window_buffer_publish()) {
+            for (int i=0; i<NUM_MACHINES; i++) machine_consume_window(machines[i]);
         }
+        printf("Sampling jitter: %d us (max %d us)\n", jitter_us, max_jitter_us);
         printf("\n");
-        k_msleep(5000);  // Sleep for 3 seconds before printing again
+
+        next_ms += SAMPLE_PERIOD_MS;
+        int64_t remaining = next_ms - k_uptime_get();
+        if (remaining > 0) k_msleep((int32_t)remaining);
     }
 } 
 
 // Thread to print sensor values of each machine
+// Mean of the sensor's timestamped samples from the last TREND_WINDOW_MS, read while set_data()
+// keeps writing; 0 when there are none
+static float sensor_trend(MachineHandle machine, SensorId id, int* count)
+{
+    TimedSample samples[SENSOR_LOG_LENGTH];
+    uint32_t since = k_uptime_get_32() - TREND_WINDOW_MS;
+    float sum = 0.0f;
+
+    *count = get_sensor_samples_since(machine, id, since, samples, SENSOR_LOG_LENGTH);
+    for (int n = 0; n < *count; n++) {
+        sum += samples[n].value;
+    }
+    return *count > 0 ? sum / *count : 0.0f;
+}
+
 void print_data(void) 
 {
     while (1) 
@@ -146,13 +244,15 @@ void print_data(void)
                 
                 if (strlen(sensor->name) == 0) continue;                 // Skip invalid sensors
 
-                float value = get_sensor_value(machines[i], sensor->name);
+                float value = get_sensor_value_by_id(machines[i], sensor_ids[i][s]);
+                int count;
+                float trend = sensor_trend(machines[i], sensor_ids[i][s], &count);
                 if (s == 0) {
-                    printf(" %s = %.2f\n",  
-                        sensor->name, value);
+                    printf(" %s = %.2f (mean %.2f over %d samples)\n",  
+                        sensor->name, value, trend, count);
                 } else {
-                    printf("                %s = %.2f\n",  
-                        sensor->name, value);
+                    printf("                %s = %.2f (mean %.2f over %d samples)\n",  
+                        sensor->name, value, trend, count);
                 }
             }
         }
@@ -161,10 +261,173 @@ void print_data(void)
     }
 }
 
+// Score one published window: the prefilter cascade, the score cache, one batched Invoke() and the verdicts
+static void score_window(const WindowFrame* frame, const MachineConfig* const configs[])
+{
+    // Cascade: only windows the prefilter finds ambiguous go on, and only those that moved since
+    // their machine was last scored reach the autoencoder. Cached scores follow the runs.
+    // The frame stays held until the runs are scored: each window is copied once, from the frame
+    // into its row of the model input, and scored against the frame.
+    MachineHandle run_handles[NUM_MACHINES];
+    const MachineConfig* run_configs[NUM_MACHINES];
+    const float* run_windows[NUM_MACHINES];
+    InferenceResult results[NUM_MACHINES];
+    InferenceResult cached[NUM_MACHINES];
+    int run_index[NUM_MACHINES];
+    int cached_index[NUM_MACHINES];
+    int runs = 0, reused = 0;
+
+    // Scores cached under the previous model are not reused once tflite_setup() has switched
+    static uint32_t cached_model_version;
+    uint32_t model_version = tflite_model_version();
+    if (model_version != cached_model_version) {
+        score_cache_invalidate();
+        cached_model_version = model_version;
+    }
+
+    for (int i=0; i<NUM_MACHINES; i++) {
+        if (!prefilter_needs_inference(i, (*frame)[i], configs[i]->num_sensors)) continue;
+        if (score_cache_lookup(i, (*frame)[i], configs[i]->num_sensors, &cached[reused])) {
+            cached_index[reused++] = i;
+            continue;
+        }
+        run_handles[runs] = machines[i];
+        run_configs[runs] = configs[i];
+        run_windows[runs] = (*frame)[i];
+        run_index[runs++] = i;
+    }
+
+    // Ambiguous machines' windows scored with a single Invoke(); the cache keeps its own key copy
+    int failed = runs > 0 && tflite_run_window_inference(run_handles, run_configs, run_windows, runs, results) != 0;
+    for (int r=0; !failed && r<runs; r++) score_cache_store(run_index[r], run_windows[r], &results[r]);
+    window_buffer_release();
+    if (failed) return;
+    for (int c=0; c<reused; c++) {
+        results[runs + c] = cached[c];
+        run_index[runs + c] = cached_index[c];
+    }
+
+    // One compact verdict per judged machine; only anomalies get a line of their own. Reused
+    // scores are judged without feeding the baseline a second time.
+    int judged = runs + reused;
+    int normal = NUM_MACHINES - judged;
+    for (int r=0; r<judged; r++) {
+        AnomalyVerdict verdict;
+        if (r < runs) {
+            anomaly_judge(run_index[r], &results[r], &verdict);
+        } else {
+            anomaly_check(run_index[r], &results[r], &verdict);
+        }
+        if (verdict.anomalous) {
+            printk("ANOMALY %s: mse %f > threshold %f (mae %f)\n", configs[run_index[r]]->name,
+                (double)verdict.mse, (double)verdict.threshold, (double)verdict.mae);
+        } else {
+            normal++;
+        }
+    }
+    printk("%d/%d machines normal (%d skipped by prefilter, %d scores reused)\n", normal, NUM_MACHINES,
+        NUM_MACHINES - judged, reused);
+}
+
+// Inference thread, released by an absolute periodic timer so its period never drifts by the
+// time Invoke() and the reports take. Latency and slack are measured from each release.
+void inference(void)
+{
+    // Resolve each machine's config once for the batched inference path
+    const MachineConfig* configs[NUM_MACHINES];
+    for (int i=0; i<NUM_MACHINES; i++)
+    {
+        MachineType type = get_machine_type(machines[i]);
+        __ASSERT(type >= 0 && type < (sizeof(machine_configs) / sizeof(machine_configs[0])), "Invalid machine type");
+        configs[i] = &machine_configs[type];
+    }
+
+    // First release: INFERENCE_OFFSET_MS after the sampler's next pass, however long boot took.
+    // The timer is started on the absolute uptime so the two schedules stay locked together.
+    k_sem_take(&schedule_sem, K_FOREVER);
+    int64_t release_ms = schedule_epoch_ms + INFERENCE_OFFSET_MS;
+    int64_t now_ms = k_uptime_get();
+    if (now_ms >= release_ms) {
+        release_ms += ((now_ms - release_ms) / SAMPLE_PERIOD_MS + 1) * SAMPLE_PERIOD_MS;
+    }
+    k_timer_start(&inference_timer, K_TIMEOUT_ABS_MS(release_ms), K_MSEC(SAMPLE_PERIOD_MS));
+    release_ms -= SAMPLE_PERIOD_MS;                 // Advanced by every expiry below
+
+    int cycle = 0;
+    while (1) {
+        // Expirations since the last wait; more than one means earlier releases were overrun
+        uint32_t released = k_timer_status_sync(&inference_timer);
+        release_ms += (int64_t)released * SAMPLE_PERIOD_MS;
+        int64_t release_us = release_ms * 1000;
+        int64_t start_us = (int64_t)k_ticks_to_us_floor64(k_uptime_ticks());
+
+        // Take the newest published window; the sampler keeps filling the other frame meanwhile
+        const WindowFrame* frame = window_buffer_acquire(K_NO_WAIT);
+        if (frame == NULL) {
+            deadline_record_idle(released - 1);
+            continue;
+        }
+        score_window(frame, configs);
+
+        int64_t end_us = (int64_t)k_ticks_to_us_floor64(k_uptime_ticks());
+        deadline_record((uint32_t)(start_us - release_us), (uint32_t)(end_us - release_us),
+            INFERENCE_DEADLINE_MS * 1000, released - 1);
+
+        // Report once how long the device was blind after boot
+        if (cycle == 0) {
+            StartupStats boot;
+            tflite_get_startup_stats(&boot);
+            printk("Boot to first inference: %u us (setup %u us, AllocateTensors %u us, %s memory plan)\n",
+                boot.first_inference_us, boot.setup_us, boot.allocate_us, boot.offline_plan ? "offline" : "runtime");
+        }
+
+        if (++cycle % PROFILE_REPORT_EVERY == 0) {
+            WindowBufferStats stats;
+            window_buffer_get_stats(&stats);
+            printk("Windows: %u published, %u deferred, %u overwritten\n",
+                stats.published, stats.deferred, stats.overwritten);
+            PrefilterStats gate;
+            prefilter_get_stats(&gate);
+            printk("Prefilter: %u windows, %u invoked, %u skipped\n", gate.windows, gate.invoked, gate.skipped);
+            ScoreCacheStats cache;
+            score_cache_get_stats(&cache);
+            printk("Score cache: %u lookups, %u hits, %u misses (%u refreshes), %u us inference, ~%u us saved\n",
+                cache.lookups, cache.hits, cache.misses, cache.refreshes, cache.invoke_us, cache.saved_us);
+            DeadlineStats timing;
+            deadline_get_stats(&timing);
+            printk("Deadline: %u runs, %u missed, %u releases skipped, latency avg %u max %u us, min slack %d us\n",
+                timing.runs, timing.misses, timing.skipped, timing.avg_latency_us, timing.max_latency_us,
+                timing.min_slack_us);
+            object_pool_report();
+            printk("Per-op inference latency:\n");
+            print_op_profile(INFERENCE_PATH_BATCH);
+        }
+    }
+}
+
+#ifdef APP_MODEL_UPDATE_DEMO
+// Thread simulating a field update: the packaged model is written to the spare flash slot and
+// tflite_setup() switches to it while the inference loop keeps scoring windows
+void model_update(void)
+{
+    k_msleep(UPDATE_DELAY_MS);
+
+    int slot = model_store_spare_slot();
+    int ret = slot < 0 ? slot : model_store_write(slot, model_update_image, model_update_image_len);
+    if (ret != 0) { printk("Model update: slot write failed (%d)\n", ret); return; }
+
+    printk("Model update: %u byte image written to slot %d\n", model_update_image_len, slot);
+    tflite_setup();
+}
+
+K_THREAD_DEFINE(model_update_id, STACKSIZE * 4, model_update, NULL, NULL, NULL, UPDATE_PRIORITY, 0, 0);
+#endif
+
 // Start the threads
 K_THREAD_DEFINE(blink0_id, STACKSIZE, blink0, NULL, NULL, NULL, PRIORITY, 0, 0);                    // Confirm the program is alive
 K_THREAD_DEFINE(set_data_id, STACKSIZE, set_data, NULL, NULL, NULL, PRIORITY + 1, 0, 0);            // Read the sensor data into the machines
-K_THREAD_DEFINE(print_data_id, STACKSIZE, print_data, NULL, NULL, NULL, PRIORITY + 2, 0, 0);        // Print the machine sensor values
+K_THREAD_DEFINE(print_data_id, STACKSIZE * 2, print_data, NULL, NULL, NULL, PRIORITY + 2, 0, 0);        // Print the machine sensor values; room for a TimedSample snapshot
+K_THREAD_DEFINE(inference_id, STACKSIZE * 4, inference, NULL, NULL, NULL, INFERENCE_PRIORITY, 0, SYS_FOREVER_MS);   // Started by main() once the model is set up
 
 int main(void) {
     
@@ -173,15 +436,24 @@ int main(void) {
     printk("Demo Message: %s\n", demo_get_message());    // Make sure C++ is working
     
     srand(time(NULL));          // Seed random number generator
-    //generate_machines();        // Generate the machines
+    generate_machines();        // Generate the machines
 
     tflite_setup();
-    tflite_run_inference();
 
-    while (1) {
-        k_sleep(K_SECONDS(5));
-        tflite_run_inference();
-    }
-    
+#ifdef APP_BENCHMARK
+    tflite_run_benchmarks();
+    sample_ring_run_benchmark();
+    sensor_run_benchmark();
+    sparse_run_benchmark();
+    score_cache_run_benchmark();
+    fleet_run_benchmark();
+    object_pool_run_benchmark();
+#endif
+
+    // Boot is over: machines and sensors are in their pools, anything on the heap from here is a leak
+    object_pool_seal_heap();
+    object_pool_report();
+
+    k_thread_start(inference_id);
     return 0;
 }
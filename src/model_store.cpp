@@ -0,0 +1,163 @@
+/*
+//  model_store.cpp - Two flash slots holding retrained models, read in place
+//
+//  Each slot is a fixed partition (model_slot_a / model_slot_b in the board's
+//  devicetree; boards/native_sim.overlay puts them on the flash simulator).
+//  A slot holds one image from scripts/model_image.py: a header, the
+//  single-window model and optionally its batched copy. Validation checks the
+//  header, bounds and CRC; the models are then handed to TFLM straight from
+//  memory-mapped flash, so nothing is copied into RAM.
+*/
+
+#include "model_store.h"
+#include <errno.h>
+#include <string.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/sys/printk.h>
+
+#if DT_NODE_EXISTS(DT_NODELABEL(model_slot_a)) && DT_NODE_EXISTS(DT_NODELABEL(model_slot_b))
+#define MODEL_STORE_PRESENT
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/sys/crc.h>
+#ifdef CONFIG_FLASH_SIMULATOR
+#include <zephyr/drivers/flash/flash_simulator.h>
+#endif
+#endif
+
+#define MAX_WRITE_BLOCK     32          // Largest flash write-block size the padded tail supports
+#define ALIGN_UP(x, a)      (((x) + (a) - 1) / (a) * (a))
+
+#ifdef MODEL_STORE_PRESENT
+
+static const uint8_t slot_ids[MODEL_STORE_NUM_SLOTS] = {
+    FIXED_PARTITION_ID(model_slot_a),
+    FIXED_PARTITION_ID(model_slot_b),
+};
+
+static const struct flash_area* slots[MODEL_STORE_NUM_SLOTS];
+
+// Where the slot's bytes can be read directly: the simulator's backing buffer, or the SoC flash mapping
+static const uint8_t* slot_memory(const struct flash_area* fa)
+{
+#ifdef CONFIG_FLASH_SIMULATOR
+    size_t size;
+    return (const uint8_t*)flash_simulator_get_memory(fa->fa_dev, &size) + fa->fa_off;
+#else
+    return (const uint8_t*)(DT_REG_ADDR(DT_CHOSEN(zephyr_flash)) + fa->fa_off);
+#endif
+}
+
+extern "C" int model_store_init(void)
+{
+    for (int i = 0; i < MODEL_STORE_NUM_SLOTS; i++) {
+        if (slots[i] == NULL && flash_area_open(slot_ids[i], &slots[i]) != 0) {
+            printk("Model slot %d: cannot open partition\n", i);
+            return -ENODEV;
+        }
+    }
+    return 0;
+}
+
+extern "C" int model_store_load(int slot, ModelImage* image)
+{
+    if (slot < 0 || slot >= MODEL_STORE_NUM_SLOTS || image == NULL) return -EINVAL;
+    if (slots[slot] == NULL) return -ENODEV;
+
+    const struct flash_area* fa = slots[slot];
+    const uint8_t* base = slot_memory(fa);
+    ModelImageHeader header;
+    memcpy(&header, base, sizeof(header));
+
+    if (header.magic != MODEL_IMAGE_MAGIC || header.version == 0 || header.model_len == 0) {
+        return -ENOENT;                                         // Erased or never written
+    }
+
+    // Bounds before touching the payload: a corrupt length must not walk off the partition
+    uint32_t batch_off = header.batch_len ? ALIGN_UP(header.model_len, MODEL_IMAGE_ALIGN) : header.model_len;
+    uint64_t payload_len = (uint64_t)batch_off + header.batch_len;
+    if (header.model_len > fa->fa_size || sizeof(header) + payload_len > fa->fa_size ||
+        (header.batch_len != 0 && header.batch_size == 0)) {
+        printk("Model slot %d: image v%u does not fit the partition\n", slot, header.version);
+        return -EINVAL;
+    }
+
+    const uint8_t* payload = base + sizeof(header);
+    if (crc32_ieee(payload, (size_t)payload_len) != header.crc32) {
+        printk("Model slot %d: image v%u fails its checksum\n", slot, header.version);
+        return -EBADMSG;
+    }
+
+    image->slot = slot;
+    image->version = header.version;
+    image->model = payload;
+    image->model_len = header.model_len;
+    image->batch_model = header.batch_len ? payload + batch_off : NULL;
+    image->batch_len = header.batch_len;
+    image->batch_size = header.batch_size;
+    return 0;
+}
+
+extern "C" int model_store_newest(ModelImage* image)
+{
+    int found = -ENOENT;
+    for (int i = 0; i < MODEL_STORE_NUM_SLOTS; i++) {
+        ModelImage candidate;
+        if (model_store_load(i, &candidate) == 0 && (found != 0 || candidate.version > image->version)) {
+            *image = candidate;
+            found = 0;
+        }
+    }
+    return found;
+}
+
+extern "C" int model_store_spare_slot(void)
+{
+    ModelImage newest;
+    if (model_store_newest(&newest) != 0) return 0;
+    return (newest.slot + 1) % MODEL_STORE_NUM_SLOTS;
+}
+
+extern "C" int model_store_write(int slot, const uint8_t* image, size_t len)
+{
+    if (slot < 0 || slot >= MODEL_STORE_NUM_SLOTS || image == NULL || len <= sizeof(ModelImageHeader)) {
+        return -EINVAL;
+    }
+    const struct flash_area* fa = slots[slot];
+    if (fa == NULL) return -ENODEV;
+    if (len > fa->fa_size) return -EFBIG;
+
+    uint32_t block = flash_area_align(fa);
+    if (block == 0 || block > MAX_WRITE_BLOCK || sizeof(ModelImageHeader) % block != 0) return -ENOTSUP;
+
+    int ret = flash_area_erase(fa, 0, fa->fa_size);
+    if (ret != 0) return ret;
+
+    // Payload first, its unaligned tail padded with the erased value
+    size_t payload_len = len - sizeof(ModelImageHeader);
+    size_t whole = payload_len / block * block;
+    ret = flash_area_write(fa, sizeof(ModelImageHeader), image + sizeof(ModelImageHeader), whole);
+    if (ret == 0 && whole < payload_len) {
+        uint8_t tail[MAX_WRITE_BLOCK];
+        memset(tail, 0xff, sizeof(tail));
+        memcpy(tail, image + sizeof(ModelImageHeader) + whole, payload_len - whole);
+        ret = flash_area_write(fa, sizeof(ModelImageHeader) + whole, tail, block);
+    }
+
+    // Header last: until it lands the slot reads as erased
+    if (ret == 0) ret = flash_area_write(fa, 0, image, sizeof(ModelImageHeader));
+    return ret;
+}
+
+#else // No model slot partitions on this board: only the embedded model is available
+
+extern "C" int model_store_init(void) { return -ENODEV; }
+extern "C" int model_store_load(int slot, ModelImage* image) { (void)slot; (void)image; return -ENODEV; }
+extern "C" int model_store_newest(ModelImage* image) { (void)image; return -ENODEV; }
+extern "C" int model_store_spare_slot(void) { return -ENODEV; }
+extern "C" int model_store_write(int slot, const uint8_t* image, size_t len)
+{
+    (void)slot; (void)image; (void)len;
+    return -ENODEV;
+}
+
+#endif // MODEL_STORE_PRESENT
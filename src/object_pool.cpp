@@ -0,0 +1,197 @@
+/*
+//  object_pool.cpp - Static storage for every Machine, and a heap watch
+//
+//  Machine routes `new`/`delete` to the fixed pool below, so create_machine()
+//  and destroy_machine() take and return a slot in O(1) and the heap is never
+//  touched. Sensors are members of their machine. The link wraps malloc(),
+//  calloc() and realloc() (-Wl,--wrap, set in both CMakeLists.txt) with
+//  counters, and the global operator new allocates through malloc().
+//  object_pool_seal_heap() marks the end of boot, and any allocation after it
+//  shows up in the footprint report. libc allocates its own buffers (stdio)
+//  behind those entry points, so the report also compares the libc heap's
+//  in-use bytes against the seal.
+*/
+
+#include "object_pool.h"
+#include "fleet_store.h"
+#include "sensor.h"
+#include <stdlib.h>
+#include <malloc.h>
+#include <new>
+#include <zephyr/sys/printk.h>
+
+#ifdef APP_BENCHMARK
+#include <zephyr/kernel.h>
+#endif
+
+static ObjectPool<Machine, FLEET_MAX_MACHINES> machine_pool;
+
+static bool heap_sealed;
+static uint32_t boot_allocs;
+static uint32_t runtime_allocs;
+static uint32_t runtime_bytes;
+static size_t sealed_heap_bytes;
+
+extern "C" {
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t count, size_t size);
+void* __real_realloc(void* p, size_t size);
+}
+
+static void count_allocation(size_t size)
+{
+    if (heap_sealed) {
+        runtime_allocs++;
+        runtime_bytes += size;
+    } else {
+        boot_allocs++;
+    }
+}
+
+extern "C" void* __wrap_malloc(size_t size)
+{
+    count_allocation(size);
+    return __real_malloc(size);
+}
+
+extern "C" void* __wrap_calloc(size_t count, size_t size)
+{
+    count_allocation(count * size);
+    return __real_calloc(count, size);
+}
+
+extern "C" void* __wrap_realloc(void* p, size_t size)
+{
+    if (size > 0) count_allocation(size);                   // realloc(p, 0) only frees
+    return __real_realloc(p, size);
+}
+
+// Bytes the libc allocator has handed out and not had back, whichever entry point was used
+static size_t libc_heap_in_use(void)
+{
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || __GLIBC_MINOR__ >= 33)
+    return mallinfo2().uordblks;
+#elif defined(__GLIBC__) || defined(CONFIG_NEWLIB_LIBC)
+    return (size_t)mallinfo().uordblks;
+#else
+    return 0;                                               // No allocator statistics in this libc
+#endif
+}
+
+void* Machine::operator new(size_t size) noexcept
+{
+    return size <= sizeof(Machine) ? machine_pool.allocate() : nullptr;
+}
+
+void Machine::operator delete(void* machine) noexcept
+{
+    machine_pool.release(machine);
+}
+
+// Everything else that says `new` still gets the heap, counted by the malloc() wrapper
+void* operator new(size_t size)
+{
+    void* p = malloc(size > 0 ? size : 1);
+    if (p == NULL) {
+        printk("Heap exhausted (%u bytes)\n", (unsigned)size);
+        abort();
+    }
+    return p;
+}
+
+void operator delete(void* p) noexcept
+{
+    free(p);
+}
+
+void operator delete(void* p, size_t) noexcept
+{
+    free(p);
+}
+
+extern "C" void object_pool_seal_heap(void)
+{
+    sealed_heap_bytes = libc_heap_in_use();
+    heap_sealed = true;
+}
+
+extern "C" void object_pool_get_stats(PoolStats* stats)
+{
+    if (stats == NULL) return;
+    stats->machines_used = machine_pool.used();
+    stats->machines_peak = machine_pool.peak();
+    stats->machines_capacity = machine_pool.capacity();
+    stats->pool_bytes = (uint32_t)machine_pool.bytes();
+    stats->boot_allocs = boot_allocs;
+    stats->runtime_allocs = runtime_allocs;
+    stats->runtime_bytes = runtime_bytes;
+    stats->heap_growth = heap_sealed ? (int32_t)(libc_heap_in_use() - sealed_heap_bytes) : 0;
+}
+
+extern "C" void object_pool_report(void)
+{
+    PoolStats stats;
+    object_pool_get_stats(&stats);
+    printk("Pools: %u/%u machines (peak %u), %u bytes static; heap: %u allocations at boot, %u after (%u bytes), "
+        "%d bytes more in use than at boot\n", stats.machines_used, stats.machines_capacity, stats.machines_peak,
+        stats.pool_bytes, stats.boot_allocs, stats.runtime_allocs, stats.runtime_bytes, (int)stats.heap_growth);
+}
+
+#ifdef APP_BENCHMARK
+
+#define POOL_BENCH_ROUNDS   10000       // Create + destroy of one machine of each type per round
+
+// What create_machine() built before the pools: a heap machine with a std::string name and a
+// vector of heap sensors, one virtual subclass instance each
+struct LegacySensor {
+    virtual ~LegacySensor() {}
+    float value = 0.0f;
+    SensorHistory history;
+};
+
+struct LegacyMachine {
+    std::string name;
+    MachineType type;
+    std::vector<std::unique_ptr<LegacySensor>> sensors;
+};
+
+static void print_churn(const char* path, uint64_t total, uint32_t worst)
+{
+    uint32_t mean_dns = (uint32_t)(k_cyc_to_ns_floor64(total) * 10 / (POOL_BENCH_ROUNDS * NUM_MACHINE_TYPES));
+    printk("%-20s %8u.%u %10u\n", path, mean_dns / 10, mean_dns % 10, (unsigned)k_cyc_to_ns_floor64(worst));
+}
+
+extern "C" void object_pool_run_benchmark(void)
+{
+    static const char* const names[NUM_MACHINE_TYPES] = {"Air_Compressor_bench", "Steam_Boiler_bench", "Electric_Motor_bench"};
+    static const int sensor_counts[NUM_MACHINE_TYPES] = {3, 2, 1};
+    uint64_t heap_total = 0, pool_total = 0;
+    uint32_t heap_worst = 0, pool_worst = 0;
+
+    for (int r = 0; r < POOL_BENCH_ROUNDS; r++) {
+        for (int t = 0; t < NUM_MACHINE_TYPES; t++) {
+            uint32_t start = k_cycle_get_32();
+            LegacyMachine* legacy = new LegacyMachine{names[t], (MachineType)t, {}};
+            for (int s = 0; s < sensor_counts[t]; s++) {
+                legacy->sensors.push_back(std::unique_ptr<LegacySensor>(new LegacySensor()));
+            }
+            delete legacy;
+            uint32_t cycles = k_cycle_get_32() - start;
+            heap_total += cycles;
+            heap_worst = cycles > heap_worst ? cycles : heap_worst;
+
+            start = k_cycle_get_32();
+            destroy_machine(create_machine(names[t], (MachineType)t));
+            cycles = k_cycle_get_32() - start;
+            pool_total += cycles;
+            pool_worst = cycles > pool_worst ? cycles : pool_worst;
+        }
+    }
+
+    printk("\nMachine create + destroy (%d of each type), ns:\n", POOL_BENCH_ROUNDS);
+    printk("%-20s %10s %10s\n", "path", "mean", "worst");
+    print_churn("heap (before)", heap_total, heap_worst);
+    print_churn("static pools", pool_total, pool_worst);
+}
+
+#endif // APP_BENCHMARK
@@ -0,0 +1,72 @@
+/*
+//  op_profiler.cpp - Rolling per-op latency statistics from MicroInterpreter::Invoke()
+*/
+
+#include "op_profiler.h"
+#include <algorithm>
+#include <zephyr/kernel.h>
+
+uint32_t OpProfiler::BeginEvent(const char* tag)
+{
+    int op = next_event++;
+    if (op >= PROFILER_MAX_OPS) return PROFILER_MAX_OPS;        // Graph larger than the profiler; not tracked
+
+    if (op >= num_ops) num_ops = op + 1;
+    ops[op].tag = tag;
+    start_cycles[op] = k_cycle_get_32();
+    return op;
+}
+
+void OpProfiler::EndEvent(uint32_t event_handle)
+{
+    uint32_t end = k_cycle_get_32();
+    if (event_handle >= PROFILER_MAX_OPS) return;
+
+    OpWindow& op = ops[event_handle];
+    op.cycles[op.next] = end - start_cycles[event_handle];
+    op.next = (op.next + 1) % PROFILER_WINDOW;
+    if (op.count < PROFILER_WINDOW) op.count++;
+}
+
+// Back to a freshly constructed profiler: the next interpreter may run a different graph
+void OpProfiler::reset()
+{
+    for (int i = 0; i < PROFILER_MAX_OPS; i++) {
+        ops[i] = OpWindow{};
+        start_cycles[i] = 0;
+    }
+    num_ops = 0;
+    next_event = 0;
+}
+
+int OpProfiler::getStats(OpProfile* out, int max_ops) const
+{
+    int n = num_ops < max_ops ? num_ops : max_ops;
+
+    for (int i = 0; i < n; i++) {
+        const OpWindow& op = ops[i];
+        OpProfile& stats = out[i];
+        stats.op_index = i;
+        stats.tag = op.tag;
+        stats.samples = op.count;
+        stats.min_cycles = stats.avg_cycles = stats.max_cycles = stats.p99_cycles = 0;
+        if (op.count == 0) continue;
+
+        uint32_t sorted[PROFILER_WINDOW];
+        uint64_t sum = 0;
+        for (uint32_t s = 0; s < op.count; s++) {
+            sorted[s] = op.cycles[s];
+            sum += op.cycles[s];
+        }
+
+        // Nearest-rank p99 over the window
+        uint32_t rank = (op.count * 99 + 99) / 100 - 1;
+        std::nth_element(sorted, sorted + rank, sorted + op.count);
+
+        stats.p99_cycles = sorted[rank];
+        stats.min_cycles = *std::min_element(sorted, sorted + op.count);
+        stats.max_cycles = *std::max_element(sorted, sorted + op.count);
+        stats.avg_cycles = (uint32_t)(sum / op.count);
+    }
+    return n;
+}
@@ -0,0 +1,71 @@
+/*
+//  prefilter.cpp - Running z-score/EWMA gate in front of the autoencoder
+//
+//  Windows arrive normalized by the SensorConfig ranges, so the priors are the
+//  same for every sensor: mean 0.5 and stddev 1/6. A window is passed on when
+//  any sensor is far from its running mean, sits near or past the configured
+//  range limits, or the machine is warming up / due for a refresh. Everything
+//  else is clearly normal and skips Invoke(). scripts/evaluate_prefilter.py
+//  replays the CSVs through the same rules against the always-on detector.
+*/
+
+#include "prefilter.h"
+#include <math.h>
+#include <string.h>
+
+typedef struct {
+    float mean[MODEL_NUM_FEATURES];
+    float var[MODEL_NUM_FEATURES];
+    uint32_t windows;
+} SensorStats;
+
+static SensorStats machines[PREFILTER_MAX_MACHINES];
+static PrefilterStats stats;
+
+extern "C" bool prefilter_needs_inference(int machine, const float* window, int num_sensors)
+{
+    if (machine < 0 || machine >= PREFILTER_MAX_MACHINES || window == NULL) {
+        return true;                                            // Unknown machine: let the model decide
+    }
+
+    SensorStats* s = &machines[machine];
+    if (s->windows == 0) {
+        for (int f = 0; f < MODEL_NUM_FEATURES; f++) {
+            s->mean[f] = 0.5f;                                  // Mid-range
+            s->var[f] = 1.0f / 36.0f;                           // Range = +/-3 stddev
+        }
+    }
+
+    bool needed = s->windows < PREFILTER_WARMUP || s->windows % PREFILTER_REFRESH == 0;
+    int n = num_sensors < MODEL_NUM_FEATURES ? num_sensors : MODEL_NUM_FEATURES;
+
+    for (int f = 0; f < n; f++) {
+        float x = window[f];
+        float diff = x - s->mean[f];
+
+        if (fabsf(diff) > PREFILTER_Z_GATE * sqrtf(s->var[f]) ||
+            x < PREFILTER_EDGE_BAND || x > 1.0f - PREFILTER_EDGE_BAND) {
+            needed = true;
+        }
+
+        // EWMA mean and variance, updated after scoring the sample against them
+        s->mean[f] += PREFILTER_ALPHA * diff;
+        s->var[f] = (1.0f - PREFILTER_ALPHA) * (s->var[f] + PREFILTER_ALPHA * diff * diff);
+    }
+
+    s->windows++;
+    stats.windows++;
+    if (needed) stats.invoked++; else stats.skipped++;
+    return needed;
+}
+
+extern "C" void prefilter_get_stats(PrefilterStats* out)
+{
+    if (out != NULL) *out = stats;
+}
+
+extern "C" void prefilter_reset(void)
+{
+    memset(machines, 0, sizeof(machines));
+    memset(&stats, 0, sizeof(stats));
+}
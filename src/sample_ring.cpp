@@ -0,0 +1,220 @@
+/*
+//  sample_ring.cpp - Per-sample cost of window assembly as the window grows
+//
+//  Three ways to keep the newest L samples of a sensor available as a
+//  contiguous window, with a window taken after every sample (hop 1, the
+//  worst case):
+//    shift   - history array shifted down by one on every sample
+//    copy    - plain ring, window copied out in order on every hop
+//    mirror  - SampleRing: two stores per sample, window is a pointer
+//  The first two grow linearly with L; the mirrored ring stays flat.
+//
+//  Then the timestamped SampleLog against the same log behind a spinlock:
+//  the cost of a push and of last-N / since-T snapshots, uncontended. Under
+//  contention the locked log makes the sampling thread wait; SampleLog never does.
+*/
+
+#include "sample_ring.h"
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+
+#ifdef APP_BENCHMARK
+
+#define RING_BENCH_SAMPLES  16384       // Samples pushed per method and window length
+#define RING_BENCH_INPUTS   256         // Distinct input values, cycled
+
+static float inputs[RING_BENCH_INPUTS];
+static volatile float sink;             // Keeps each window's contents observable
+
+template <int L>
+static uint32_t bench_shift(void)
+{
+    static float history[L];
+    float acc = 0.0f;
+
+    uint32_t start = k_cycle_get_32();
+    for (int i = 0; i < RING_BENCH_SAMPLES; i++) {
+        memmove(history, history + 1, (L - 1) * sizeof(float));
+        history[L - 1] = inputs[i % RING_BENCH_INPUTS];
+        acc += history[0] + history[L - 1];
+    }
+    uint32_t cycles = k_cycle_get_32() - start;
+    sink = acc;
+    return cycles;
+}
+
+template <int L>
+static uint32_t bench_copy(void)
+{
+    static float ring[L];
+    static float window[L];
+    int head = 0;
+    float acc = 0.0f;
+
+    uint32_t start = k_cycle_get_32();
+    for (int i = 0; i < RING_BENCH_SAMPLES; i++) {
+        ring[head] = inputs[i % RING_BENCH_INPUTS];
+        head = head + 1 == L ? 0 : head + 1;
+        memcpy(window, ring + head, (L - head) * sizeof(float));
+        memcpy(window + (L - head), ring, head * sizeof(float));
+        acc += window[0] + window[L - 1];
+    }
+    uint32_t cycles = k_cycle_get_32() - start;
+    sink = acc;
+    return cycles;
+}
+
+template <int L>
+static uint32_t bench_mirror(void)
+{
+    static SampleRing<L> ring;
+    float acc = 0.0f;
+
+    uint32_t start = k_cycle_get_32();
+    for (int i = 0; i < RING_BENCH_SAMPLES; i++) {
+        ring.push(inputs[i % RING_BENCH_INPUTS]);
+        const float* window = ring.window();
+        acc += window[0] + window[L - 1];
+    }
+    uint32_t cycles = k_cycle_get_32() - start;
+    sink = acc;
+    return cycles;
+}
+
+// Tenths of a nanosecond per sample for a cycle count over RING_BENCH_SAMPLES
+static uint32_t per_sample_dns(uint32_t cycles)
+{
+    return (uint32_t)(k_cyc_to_ns_floor64(cycles) * 10 / RING_BENCH_SAMPLES);
+}
+
+// What a reader-safe log costs with a lock: the producer and every reader take the same spinlock
+template <int Capacity>
+class LockedLog {
+public:
+    void push(float value, uint32_t timestamp_ms)
+    {
+        while (lock.test_and_set(std::memory_order_acquire)) {}
+        samples[written % Capacity] = {timestamp_ms, value};
+        written++;
+        lock.clear(std::memory_order_release);
+    }
+
+    int last(TimedSample* out, int max_samples)
+    {
+        while (lock.test_and_set(std::memory_order_acquire)) {}
+        uint32_t n = written < (uint32_t)Capacity ? written : (uint32_t)Capacity;
+        if (n > (uint32_t)max_samples) n = (uint32_t)max_samples;
+        for (uint32_t i = 0; i < n; i++) out[i] = samples[(written - n + i) % Capacity];
+        lock.clear(std::memory_order_release);
+        return (int)n;
+    }
+
+private:
+    std::atomic_flag lock = ATOMIC_FLAG_INIT;
+    TimedSample samples[Capacity];
+    uint32_t written = 0;
+};
+
+template <typename Log>
+static uint32_t bench_log_push(Log& log)
+{
+    uint32_t start = k_cycle_get_32();
+    for (int i = 0; i < RING_BENCH_SAMPLES; i++) {
+        log.push(inputs[i % RING_BENCH_INPUTS], (uint32_t)i);
+    }
+    return k_cycle_get_32() - start;
+}
+
+template <typename Log>
+static uint32_t bench_log_last(Log& log, int count)
+{
+    static TimedSample out[SENSOR_LOG_LENGTH];
+    float acc = 0.0f;
+
+    uint32_t start = k_cycle_get_32();
+    for (int i = 0; i < RING_BENCH_SAMPLES; i++) {
+        int n = log.last(out, count);
+        acc += out[n - 1].value;
+    }
+    uint32_t cycles = k_cycle_get_32() - start;
+    sink = acc;
+    return cycles;
+}
+
+static uint32_t bench_log_since(const SensorLog& log, uint32_t since_ms)
+{
+    static TimedSample out[SENSOR_LOG_LENGTH];
+    float acc = 0.0f;
+
+    uint32_t start = k_cycle_get_32();
+    for (int i = 0; i < RING_BENCH_SAMPLES; i++) {
+        int n = log.since(since_ms, out, SENSOR_LOG_LENGTH);
+        acc += out[n - 1].value;
+    }
+    uint32_t cycles = k_cycle_get_32() - start;
+    sink = acc;
+    return cycles;
+}
+
+static void print_log_row(const char* operation, uint32_t locked, uint32_t lock_free)
+{
+    if (locked == 0) {
+        printk("%-22s %10s %8u.%u\n", operation, "-", lock_free / 10, lock_free % 10);
+    } else {
+        printk("%-22s %8u.%u %8u.%u\n", operation, locked / 10, locked % 10, lock_free / 10, lock_free % 10);
+    }
+}
+
+template <int L>
+static void bench_length(void)
+{
+    uint32_t shift = per_sample_dns(bench_shift<L>());
+    uint32_t copy = per_sample_dns(bench_copy<L>());
+    uint32_t mirror = per_sample_dns(bench_mirror<L>());
+
+    printk("%6d %8u.%u %8u.%u %8u.%u\n", L,
+        shift / 10, shift % 10, copy / 10, copy % 10, mirror / 10, mirror % 10);
+}
+
+extern "C" void sample_ring_run_benchmark(void)
+{
+    for (int i = 0; i < RING_BENCH_INPUTS; i++) {
+        inputs[i] = rand() / (float)RAND_MAX;
+    }
+
+    printk("\nWindow assembly, ns per sample at hop 1 (%d samples each):\n", RING_BENCH_SAMPLES);
+    printk("%6s %10s %10s %10s\n", "length", "shift", "copy", "mirror");
+    bench_length<8>();
+    bench_length<16>();
+    bench_length<32>();
+    bench_length<64>();
+    bench_length<128>();
+    bench_length<256>();
+    bench_length<512>();
+
+    static LockedLog<SENSOR_LOG_LENGTH> locked;
+    static SensorLog log;
+    uint32_t locked_push = per_sample_dns(bench_log_push(locked));
+    uint32_t log_push = per_sample_dns(bench_log_push(log));
+
+    // A full log with no push in progress hands back every sample it holds
+    static TimedSample full[SENSOR_LOG_LENGTH];
+    int kept = log.last(full, SENSOR_LOG_LENGTH);
+    if (kept != SENSOR_LOG_LENGTH || full[kept - 1].timestamp_ms != (uint32_t)(RING_BENCH_SAMPLES - 1)) {
+        printk("SampleLog: a full log returned %d of %d samples\n", kept, SENSOR_LOG_LENGTH);
+    }
+
+    printk("\nTimestamped log of %d samples, ns per call (%d calls each, uncontended):\n",
+        SENSOR_LOG_LENGTH, RING_BENCH_SAMPLES);
+    printk("%-22s %10s %10s\n", "operation", "spinlock", "lock-free");
+    print_log_row("push", locked_push, log_push);
+    print_log_row("last 8", per_sample_dns(bench_log_last(locked, 8)), per_sample_dns(bench_log_last(log, 8)));
+    print_log_row("last all", per_sample_dns(bench_log_last(locked, SENSOR_LOG_LENGTH)),
+        per_sample_dns(bench_log_last(log, SENSOR_LOG_LENGTH)));
+    print_log_row("since half", 0, per_sample_dns(bench_log_since(log, RING_BENCH_SAMPLES - SENSOR_LOG_LENGTH / 2)));
+}
+
+#endif // APP_BENCHMARK
@@ -0,0 +1,203 @@
+/*
+//  score_cache.cpp - Reuse a machine's last anomaly score while its window barely moves
+//
+//  Slow sensors (motor and boiler temperature) change little between sampling
+//  passes, so most of their windows reproduce the previous reconstruction error.
+//  Each machine keeps the window its last score was computed on; a new window
+//  whose largest per-sensor change from it is within SCORE_CACHE_EPSILON reuses
+//  that score instead of running the autoencoder. After SCORE_CACHE_MAX_HITS
+//  reuses in a row the machine is scored anyway.
+*/
+
+#include "score_cache.h"
+#include <math.h>
+#include <string.h>
+
+#ifdef APP_BENCHMARK
+#include <stdlib.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#endif
+
+typedef struct {
+    float window[MODEL_NUM_FEATURES];   // Window the cached score was computed on
+    InferenceResult result;
+    uint32_t hits;                      // Reuses since the last Invoke()
+    bool valid;
+} CacheEntry;
+
+static CacheEntry entries[SCORE_CACHE_MAX_MACHINES];
+static ScoreCacheStats stats;
+static uint64_t invoke_us;              // Wider than the stats field; the mean needs the exact sum
+
+static bool lookup(int machine, const float* window, int num_sensors, InferenceResult* result, float epsilon)
+{
+    if (machine < 0 || machine >= SCORE_CACHE_MAX_MACHINES || window == NULL || result == NULL) {
+        return false;
+    }
+    stats.lookups++;
+
+    CacheEntry* e = &entries[machine];
+    bool hit = epsilon > 0.0f && e->valid;
+    if (hit && e->hits >= SCORE_CACHE_MAX_HITS) {
+        stats.refreshes++;
+        hit = false;
+    }
+
+    int n = num_sensors < MODEL_NUM_FEATURES ? num_sensors : MODEL_NUM_FEATURES;
+    for (int f = 0; hit && f < n; f++) {
+        hit = fabsf(window[f] - e->window[f]) <= epsilon;
+    }
+
+    if (!hit) {
+        stats.misses++;
+        return false;
+    }
+    e->hits++;
+    stats.hits++;
+    *result = e->result;
+    result->latency_us = 0;
+    return true;
+}
+
+extern "C" bool score_cache_lookup(int machine, const float* window, int num_sensors, InferenceResult* result)
+{
+    return lookup(machine, window, num_sensors, result, (float)SCORE_CACHE_EPSILON);
+}
+
+extern "C" void score_cache_store(int machine, const float* window, const InferenceResult* result)
+{
+    if (machine < 0 || machine >= SCORE_CACHE_MAX_MACHINES || window == NULL || result == NULL) {
+        return;
+    }
+
+    CacheEntry* e = &entries[machine];
+    memcpy(e->window, window, sizeof(e->window));
+    e->result = *result;
+    e->hits = 0;
+    e->valid = true;
+    invoke_us += result->latency_us;
+}
+
+extern "C" void score_cache_get_stats(ScoreCacheStats* out)
+{
+    if (out == NULL) return;
+    *out = stats;
+    out->invoke_us = (uint32_t)invoke_us;
+    out->saved_us = stats.misses > 0 ? (uint32_t)(invoke_us * stats.hits / stats.misses) : 0;
+}
+
+extern "C" void score_cache_invalidate(void)
+{
+    memset(entries, 0, sizeof(entries));
+}
+
+extern "C" void score_cache_reset(void)
+{
+    score_cache_invalidate();
+    memset(&stats, 0, sizeof(stats));
+    invoke_us = 0;
+}
+
+#ifdef APP_BENCHMARK
+
+#define CACHE_BENCH_WINDOWS     2048            // Sampling passes replayed per epsilon
+#define CACHE_BENCH_STEP        0.004f          // Largest normalized change per sensor and pass (slow drift)
+
+static const MachineConfig bench_configs[] = {
+    {"Air Compressor", {{"Temperature", 0.0f, 1.0f}, {"Pressure", 0.0f, 1.0f}, {"Vibration", 0.0f, 1.0f}}, 3},
+    {"Steam Boiler", {{"Temperature", 0.0f, 1.0f}, {"Pressure", 0.0f, 1.0f}, {"", 0.0f, 0.0f}}, 2},
+    {"Electric Motor", {{"Temperature", 0.0f, 1.0f}, {"", 0.0f, 0.0f}, {"", 0.0f, 0.0f}}, 1},
+};
+#define CACHE_BENCH_MACHINES    (int)(sizeof(bench_configs) / sizeof(bench_configs[0]))
+
+static float walk[CACHE_BENCH_WINDOWS][CACHE_BENCH_MACHINES][MODEL_NUM_FEATURES];
+static float reference[CACHE_BENCH_WINDOWS][CACHE_BENCH_MACHINES];
+
+// Every machine's sensors as bounded random walks from mid-range
+static void generate_walk(void)
+{
+    for (int m = 0; m < CACHE_BENCH_MACHINES; m++) {
+        for (int f = 0; f < MODEL_NUM_FEATURES; f++) {
+            float x = 0.5f;
+            for (int w = 0; w < CACHE_BENCH_WINDOWS; w++) {
+                x += CACHE_BENCH_STEP * (2.0f * rand() / (float)RAND_MAX - 1.0f);
+                x = x < 0.0f ? 0.0f : (x > 1.0f ? 1.0f : x);
+                walk[w][m][f] = f < bench_configs[m].num_sensors ? x : 0.0f;
+            }
+        }
+    }
+}
+
+// Replay the walk through the cache at `epsilon`; returns inference cycles, fills the worst score error
+static uint32_t replay_walk(const MachineHandle* handles, float epsilon, float* max_error)
+{
+    uint32_t cycles = 0;
+    *max_error = 0.0f;
+    score_cache_reset();
+
+    for (int w = 0; w < CACHE_BENCH_WINDOWS; w++) {
+        for (int m = 0; m < CACHE_BENCH_MACHINES; m++) {
+            const MachineConfig* config = &bench_configs[m];
+            InferenceResult result;
+            const float* window = walk[w][m];
+            uint32_t start = k_cycle_get_32();
+            if (!lookup(m, window, config->num_sensors, &result, epsilon)) {
+                tflite_run_window_inference(&handles[m], &config, &window, 1, &result);
+                score_cache_store(m, walk[w][m], &result);
+            }
+            cycles += k_cycle_get_32() - start;
+
+            float error = fabsf(result.score - reference[w][m]);
+            *max_error = error > *max_error ? error : *max_error;
+        }
+    }
+    return cycles;
+}
+
+extern "C" void score_cache_run_benchmark(void)
+{
+    static const float epsilons[] = {0.0f, 0.002f, 0.005f, 0.01f, 0.02f};
+    static const MachineType types[CACHE_BENCH_MACHINES] = {AIR_COMPRESSOR, STEAM_BOILER, ELECTRIC_MOTOR};
+
+    MachineHandle handles[CACHE_BENCH_MACHINES];
+    for (int m = 0; m < CACHE_BENCH_MACHINES; m++) {
+        handles[m] = create_machine(bench_configs[m].name, types[m]);
+    }
+    generate_walk();
+
+    // Uncached scores every cached run is measured against
+    for (int w = 0; w < CACHE_BENCH_WINDOWS; w++) {
+        for (int m = 0; m < CACHE_BENCH_MACHINES; m++) {
+            const MachineConfig* config = &bench_configs[m];
+            const float* window = walk[w][m];
+            InferenceResult result;
+            tflite_run_window_inference(&handles[m], &config, &window, 1, &result);
+            reference[w][m] = result.score;
+        }
+    }
+
+    int windows = CACHE_BENCH_WINDOWS * CACHE_BENCH_MACHINES;
+    printk("\nScore cache on a random walk (step <= %.3f per pass, %d windows, %d max reuses)\n",
+        (double)CACHE_BENCH_STEP, windows, SCORE_CACHE_MAX_HITS);
+    printk("%8s %8s %12s %10s %14s\n", "epsilon", "hit %", "us/window", "cpu saved", "max score err");
+
+    uint32_t uncached = 0;
+    for (unsigned k = 0; k < sizeof(epsilons) / sizeof(epsilons[0]); k++) {
+        float max_error;
+        uint32_t cycles = replay_walk(handles, epsilons[k], &max_error);
+        if (k == 0) uncached = cycles;
+
+        uint32_t ns = (uint32_t)(k_cyc_to_ns_floor64(cycles) / windows);
+        int saved = uncached > 0 ? (int)(100 - (uint64_t)cycles * 100 / uncached) : 0;
+        printk("%8.3f %7u%% %8u.%03u %9d%% %14.6f\n", (double)epsilons[k], stats.hits * 100 / windows,
+            ns / 1000, ns % 1000, saved, (double)max_error);
+    }
+
+    score_cache_reset();
+    for (int m = 0; m < CACHE_BENCH_MACHINES; m++) {
+        destroy_machine(handles[m]);
+    }
+}
+
+#endif // APP_BENCHMARK
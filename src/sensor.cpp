@@ -1,76 +1,74 @@
 /*
-//  sensor.cpp - Sensor Base class that all sensors inherit from it
+//  sensor.cpp - Machines and the sensors their MachineLayout gives them
 */
 
 #include "sensor.h"
+#include "fleet_store.h"
 #include <string>
 #include <stdio.h>
+#include <string.h>
 
 #include <memory>
 #include <vector>
-#include <iostream>
-
-// Sensor implementations
-void TempSensor::setValue(float value) { Value = value; }
-float TempSensor::readValue() { return Value; }
-std::string TempSensor::getType() { return "Temperature"; }
-
-void PressureSensor::setValue(float value) { Value = value; }
-float PressureSensor::readValue() { return Value; }
-std::string PressureSensor::getType() { return "Pressure"; }
-
-void VibrationSensor::setValue(float value) { Value = value; }
-float VibrationSensor::readValue() { return Value; }
-std::string VibrationSensor::getType() { return "Vibration"; }
-
-// SensorFactory implementation
-std::unique_ptr<Sensor> SensorFactory::createSensor(const std::string& type) {
-    if (type == "Temperature") {
-        return std::unique_ptr<Sensor>(new TempSensor());
-    } else if (type == "Pressure") {
-        return std::unique_ptr<Sensor>(new PressureSensor());
-    } else if (type == "Vibration") {
-        return std::unique_ptr<Sensor>(new VibrationSensor());
-    }
-    return nullptr;
-}
+#include <zephyr/sys/printk.h>
 
 // Machine implementation
-Machine::Machine(const std::string& machineName, const std::vector<std::string>& sensorTypes, MachineType machineType) 
-    : type(machineType), name(machineName)  {
-    for (const auto& type : sensorTypes) {
-        auto sensor = SensorFactory::createSensor(type);
-        if (sensor) {
-            sensors.push_back(std::move(sensor));
-        }
-    }
+Machine::Machine(const char* machineName, MachineType machineType) 
+    : type(machineType), mask(withMachineLayout(machineType, [](auto layout) { return layout.mask; }))  {
+    size_t length = strnlen(machineName, sizeof(name) - 1);
+    memcpy(name, machineName, length);
+    name[length] = '\0';
 }
 
 void Machine::display() const {
-    std::cout << "Machine: " << name << std::endl;
-    for (const auto& sensor : sensors) {
-        std::cout << "  - Sensor Type: " << sensor->getType() << std::endl;
-    }
+    printk("Machine: %s\n", name);
+    withMachineLayout(type, [&](auto layout) {
+        layout.forEach([&](SensorKind kind, int) { printk("  - Sensor Type: %s\n", sensors[kind].getType()); });
+    });
 }
 
-void Machine::setSensorValue(const std::string& type, float value) {
-    for (auto& sensor : sensors) {
-        if (sensor->getType() == type) {
-            sensor->setValue(value);
-            return;
-        }
+void Machine::missingSensor(const char* type) const {
+    printk("Sensor type %s not found in machine %s\n", type, name);
+}
+
+void Machine::setSensorValue(const char* type, float value) {
+    SensorKind kind = get_sensor_kind(type);
+    if (!hasSensor(kind)) {
+        missingSensor(type);
+        return;
     }
-    std::cout << "Sensor type " << type << " not found in machine " << name << std::endl;
+    sensors[kind].setValue(value);
 }
 
-float Machine::getSensorValue(const std::string& type) {
-    for (const auto& sensor : sensors) {
-        if (sensor->getType() == type) {
-            return sensor->readValue();
-        }
+float Machine::getSensorValue(const char* type) {
+    SensorKind kind = get_sensor_kind(type);
+    if (!hasSensor(kind)) {
+        missingSensor(type);
+        return -1.0f;
     }
-    std::cout << "Sensor type " << type << " not found in machine " << name << std::endl;
-    return -1.0f;
+    return sensors[kind].readValue();
+}
+
+void Machine::bindStore(MachineHandle handle) {
+    forEachSensor([&](Sensor& sensor) { sensor.bindCell(fleet_cell(sensor.getKind(), handle)); });
+}
+
+void Machine::setValues(const float* values, uint32_t timestampMs) {
+    withMachineLayout(type, [&](auto layout) {
+        layout.forEach([&](SensorKind kind, int index) { sensors[kind].setValue(values[index], timestampMs); });
+    });
+}
+
+bool Machine::windowReady() const {
+    return withMachineLayout(type, [&](auto layout) {
+        bool ready = layout.count > 0;
+        layout.forEach([&](SensorKind kind, int) { ready &= sensors[kind].samples().ready(SENSOR_WINDOW_HOP); });
+        return ready;
+    });
+}
+
+void Machine::consumeWindow() {
+    forEachSensor([](Sensor& sensor) { sensor.consumeWindow(); });
 }
 
 
@@ -1,51 +1,63 @@
 #include "sensor.h"
 #include "sensor_wrapper.h"
+#include "fleet_store.h"
 #include <vector>
 #include <string>
 #include <cstring>
 
-// Define sensor types for each machine type
-const std::vector<std::string> air_compressor_sensors = {"Temperature", "Pressure", "Vibration"};
-const std::vector<std::string> steam_boiler_sensors = {"Temperature", "Pressure"};
-const std::vector<std::string> electric_motor_sensors = {"Temperature"};
+int get_sensor_samples(MachineHandle handle, SensorId id, TimedSample* samples, int max_samples) {
+    Machine* machine = fleet_machine(handle);
+    const Sensor* sensor = machine ? machine->getSensor((SensorKind)id) : nullptr;
+    return sensor && samples ? sensor->timedSamples().last(samples, max_samples) : 0;
+}
+
+int get_sensor_samples_since(MachineHandle handle, SensorId id, uint32_t since_ms, TimedSample* samples, int max_samples) {
+    Machine* machine = fleet_machine(handle);
+    const Sensor* sensor = machine ? machine->getSensor((SensorKind)id) : nullptr;
+    return sensor && samples ? sensor->timedSamples().since(since_ms, samples, max_samples) : 0;
+}
+
+#ifdef APP_BENCHMARK
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#endif
+
+// Names of the sensor kinds, indexed by SensorKind
+static const char* const sensor_kind_names[NUM_SENSOR_KINDS] = {"Temperature", "Pressure", "Vibration"};
 
 MachineHandle create_machine(const char* machine_name, MachineType type) {
-    std::vector<std::string> sensors;
-    
-    switch(type) {
-        case AIR_COMPRESSOR:
-            sensors = air_compressor_sensors;
-            break;
-        case STEAM_BOILER:
-            sensors = steam_boiler_sensors;
-            break;
-        case ELECTRIC_MOTOR:
-            sensors = electric_motor_sensors;
-            break;
+    // The handle is the machine's index in the fleet store; its sensors keep their values there.
+    // The machine comes from the static pool (object_pool.h), its sensors from its MachineLayout.
+    Machine* machine = new Machine(machine_name, type);
+    if (machine == nullptr) return -1;
+    MachineHandle handle = fleet_add(machine, type, machine->sensorMask());
+    if (handle < 0) {
+        delete machine;
+        return -1;
     }
-    
-    Machine* machine = new Machine(std::string(machine_name), sensors, type);
-    return reinterpret_cast<MachineHandle>(machine);
+    machine->bindStore(handle);
+    return handle;
 }
 
 void destroy_machine(MachineHandle handle) {
-    Machine* machine = reinterpret_cast<Machine*>(handle);
+    Machine* machine = fleet_machine(handle);
+    fleet_remove(handle);
     delete machine;
 }
 
 void describe_machine(MachineHandle handle) {
-    Machine* machine = reinterpret_cast<Machine*>(handle);
-    machine->display();
+    Machine* machine = fleet_machine(handle);
+    if (machine) machine->display();
 }
 
 void set_sensor_value(MachineHandle handle, const char* sensor_type, float value) {
-    Machine* machine = reinterpret_cast<Machine*>(handle);
-    machine->setSensorValue(sensor_type, value);
+    Machine* machine = fleet_machine(handle);
+    if (machine) machine->setSensorValue(sensor_type, value);
 }
 
 float get_sensor_value(MachineHandle handle, const char* sensor_type) {
-    Machine* machine = reinterpret_cast<Machine*>(handle);
-    return machine->getSensorValue(sensor_type);
+    Machine* machine = fleet_machine(handle);
+    return machine ? machine->getSensorValue(sensor_type) : -1.0f;
 }
 
 const char* get_machine_type_string(MachineType type) {
@@ -58,10 +70,213 @@ const char* get_machine_type_string(MachineType type) {
 }
 
 MachineType get_machine_type(MachineHandle handle) {
-    Machine* machine = reinterpret_cast<Machine*>(handle);
-    return machine->getType();
+    return fleet_type(handle);
+}
+
+SensorKind get_sensor_kind(const char* sensor_type) {
+    if (sensor_type == NULL) return SENSOR_UNKNOWN;
+    for (int kind = 0; kind < NUM_SENSOR_KINDS; kind++) {
+        if (strcmp(sensor_type, sensor_kind_names[kind]) == 0) return (SensorKind)kind;
+    }
+    return SENSOR_UNKNOWN;
+}
+
+const char* get_sensor_kind_string(SensorKind kind) {
+    return kind >= 0 && kind < NUM_SENSOR_KINDS ? sensor_kind_names[kind] : "Unknown Sensor";
+}
+
+SensorId find_sensor(MachineHandle handle, const char* sensor_type) {
+    Machine* machine = fleet_machine(handle);
+    SensorKind kind = get_sensor_kind(sensor_type);
+    return machine && machine->hasSensor(kind) ? (SensorId)kind : -1;
+}
+
+void set_sensor_value_by_id(MachineHandle handle, SensorId id, float value) {
+    Machine* machine = fleet_machine(handle);
+    if (machine) machine->setSensorValue((SensorKind)id, value);
+}
+
+float get_sensor_value_by_id(MachineHandle handle, SensorId id) {
+    Machine* machine = fleet_machine(handle);
+    return machine ? machine->getSensorValue((SensorKind)id) : -1.0f;
+}
+
+void set_machine_values(MachineHandle handle, const float* values) {
+    Machine* machine = fleet_machine(handle);
+    if (machine && values) machine->setValues(values);
+}
+
+int get_sensor_window(MachineHandle handle, SensorId id, const float** samples) {
+    Machine* machine = fleet_machine(handle);
+    const float* window = machine ? machine->sensorWindow((SensorKind)id) : nullptr;
+    if (samples != NULL) *samples = window;
+    return window != nullptr ? SENSOR_WINDOW_LENGTH : 0;
+}
+
+int machine_window_ready(MachineHandle handle) {
+    Machine* machine = fleet_machine(handle);
+    return machine && machine->windowReady() ? 1 : 0;
+}
+
+void machine_consume_window(MachineHandle handle) {
+    Machine* machine = fleet_machine(handle);
+    if (machine) machine->consumeWindow();
+}
+
+#ifdef APP_BENCHMARK
+
+#define SENSOR_BENCH_CALLS  100000      // Calls timed per access path
+
+static volatile float sensor_sink;
+
+// The sensors before the compile-time layouts: one subclass per kind behind virtual calls, each
+// heap-allocated and owned by the machine through a vector of unique_ptrs. A write does the same
+// work as Sensor::setValue(): value, window ring and timestamped log.
+class LegacySensor {
+protected:
+    float value = 0.0f;
+    SensorHistory history;
+    SensorLog log;
+public:
+    virtual ~LegacySensor() {}
+    virtual void setValue(float v) = 0;
+    virtual float readValue() = 0;
+    virtual const char* getType() const = 0;
+};
+
+template <SensorKind Kind>
+class LegacyKindSensor : public LegacySensor {
+public:
+    void setValue(float v) override { value = v; history.push(v); log.push(v, k_uptime_get_32()); }
+    float readValue() override { return value; }
+    const char* getType() const override { return get_sensor_kind_string(Kind); }
+};
+
+typedef std::vector<std::unique_ptr<LegacySensor>> LegacySensors;
+
+// What set_sensor_value()/get_sensor_value() did before the slot table: a std::string from the
+// C name, then a linear scan building every sensor's type as a std::string to compare against
+static LegacySensor* legacy_find(LegacySensors& sensors, const char* sensor_type) {
+    std::string type(sensor_type);
+    for (auto& sensor : sensors) {
+        if (std::string(sensor->getType()) == type) return sensor.get();
+    }
+    return nullptr;
+}
+
+// Nanoseconds per call, in tenths
+static uint32_t per_call_dns(uint32_t cycles) {
+    return (uint32_t)(k_cyc_to_ns_floor64(cycles) * 10 / SENSOR_BENCH_CALLS);
 }
 
+static void print_path(const char* path, uint32_t set_cycles, uint32_t get_cycles) {
+    uint32_t set_dns = per_call_dns(set_cycles), get_dns = per_call_dns(get_cycles);
+    printk("%-28s %8u.%u %8u.%u\n", path, set_dns / 10, set_dns % 10, get_dns / 10, get_dns % 10);
+}
+
+static void print_write(const char* path, uint32_t cycles) {
+    uint32_t dns = per_call_dns(cycles);
+    printk("%-28s %8u.%u\n", path, dns / 10, dns % 10);
+}
+
+// Per-call cost of writing and reading the last sensor of an Air Compressor by each path, then
+// of writing all three of its sensors
+void sensor_run_benchmark(void) {
+    static const char* const name = "Vibration";
+    MachineHandle handle = create_machine("Benchmark", AIR_COMPRESSOR);
+    Machine* machine = fleet_machine(handle);
+    SensorId id = find_sensor(handle, name);
+    float acc = 0.0f;
+
+    LegacySensors legacy;
+    legacy.push_back(std::unique_ptr<LegacySensor>(new LegacyKindSensor<SENSOR_TEMPERATURE>()));
+    legacy.push_back(std::unique_ptr<LegacySensor>(new LegacyKindSensor<SENSOR_PRESSURE>()));
+    legacy.push_back(std::unique_ptr<LegacySensor>(new LegacyKindSensor<SENSOR_VIBRATION>()));
+    LegacySensor* slot = legacy[SENSOR_VIBRATION].get();
+
+    uint32_t start = k_cycle_get_32();
+    for (int i = 0; i < SENSOR_BENCH_CALLS; i++) legacy_find(legacy, name)->setValue((float)i);
+    uint32_t legacy_set = k_cycle_get_32() - start;
+    start = k_cycle_get_32();
+    for (int i = 0; i < SENSOR_BENCH_CALLS; i++) acc += legacy_find(legacy, name)->readValue();
+    uint32_t legacy_get = k_cycle_get_32() - start;
+
+    start = k_cycle_get_32();
+    for (int i = 0; i < SENSOR_BENCH_CALLS; i++) slot->setValue((float)i);
+    uint32_t virtual_set = k_cycle_get_32() - start;
+    start = k_cycle_get_32();
+    for (int i = 0; i < SENSOR_BENCH_CALLS; i++) acc += slot->readValue();
+    uint32_t virtual_get = k_cycle_get_32() - start;
+
+    start = k_cycle_get_32();
+    for (int i = 0; i < SENSOR_BENCH_CALLS; i++) machine->setSensorValue(SENSOR_VIBRATION, (float)i);
+    uint32_t inline_set = k_cycle_get_32() - start;
+    start = k_cycle_get_32();
+    for (int i = 0; i < SENSOR_BENCH_CALLS; i++) acc += machine->getSensorValue(SENSOR_VIBRATION);
+    uint32_t inline_get = k_cycle_get_32() - start;
+
+    start = k_cycle_get_32();
+    for (int i = 0; i < SENSOR_BENCH_CALLS; i++) set_sensor_value(handle, name, (float)i);
+    uint32_t name_set = k_cycle_get_32() - start;
+    start = k_cycle_get_32();
+    for (int i = 0; i < SENSOR_BENCH_CALLS; i++) acc += get_sensor_value(handle, name);
+    uint32_t name_get = k_cycle_get_32() - start;
+
+    start = k_cycle_get_32();
+    for (int i = 0; i < SENSOR_BENCH_CALLS; i++) set_sensor_value_by_id(handle, id, (float)i);
+    uint32_t id_set = k_cycle_get_32() - start;
+    start = k_cycle_get_32();
+    for (int i = 0; i < SENSOR_BENCH_CALLS; i++) acc += get_sensor_value_by_id(handle, id);
+    uint32_t id_get = k_cycle_get_32() - start;
+
+    // Whole machine: three virtual writes, the compile-time layout, and through the C API
+    constexpr int count = MachineLayout<AIR_COMPRESSOR>::count;
+    float values[count] = {0.0f};
+    start = k_cycle_get_32();
+    for (int i = 0; i < SENSOR_BENCH_CALLS; i++) {
+        values[i % count] = (float)i;
+        for (int s = 0; s < count; s++) legacy[s]->setValue(values[s]);
+    }
+    uint32_t virtual_machine = k_cycle_get_32() - start;
+    start = k_cycle_get_32();
+    for (int i = 0; i < SENSOR_BENCH_CALLS; i++) {
+        values[i % count] = (float)i;
+        machine->setValues<AIR_COMPRESSOR>(values);
+    }
+    uint32_t layout_machine = k_cycle_get_32() - start;
+    start = k_cycle_get_32();
+    for (int i = 0; i < SENSOR_BENCH_CALLS; i++) {
+        values[i % count] = (float)i;
+        for (int s = 0; s < count; s++) set_sensor_value_by_id(handle, (SensorId)s, values[s]);
+    }
+    uint32_t id_machine = k_cycle_get_32() - start;
+    start = k_cycle_get_32();
+    for (int i = 0; i < SENSOR_BENCH_CALLS; i++) {
+        values[i % count] = (float)i;
+        set_machine_values(handle, values);
+    }
+    uint32_t typed_machine = k_cycle_get_32() - start;
+
+    sensor_sink = acc;
+    destroy_machine(handle);
+
+    printk("\nSensor access, ns per call (%s of an Air Compressor, %d calls each):\n", name, SENSOR_BENCH_CALLS);
+    printk("%-28s %10s %10s\n", "path", "set", "get");
+    print_path("std::string scan (before)", legacy_set, legacy_get);
+    print_path("virtual call by slot (before)", virtual_set, virtual_get);
+    print_path("Machine, inlined by kind", inline_set, inline_get);
+    print_path("by name (kind lookup)", name_set, name_get);
+    print_path("by slot ID", id_set, id_get);
+
+    printk("\nAll three sensors of an Air Compressor, ns per write:\n");
+    print_write("virtual calls (before)", virtual_machine);
+    print_write("setValues<AIR_COMPRESSOR>", layout_machine);
+    print_write("3 x set_sensor_value_by_id", id_machine);
+    print_write("set_machine_values", typed_machine);
+}
+
+#endif // APP_BENCHMARK
+
 
 
 // #include "sensor.h"
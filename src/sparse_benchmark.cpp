@@ -0,0 +1,79 @@
+/*
+//  sparse_benchmark.cpp - Dense vs block-sparse FullyConnected latency at 50/75/90% sparsity
+//
+//  The layers and their packed forms come from scripts/sparse_model.py
+//  (sparse_benchmark.h); layers it keeps dense (the 3-input layer) run dense in
+//  both passes. Both passes use runtime-shaped loops like the TFLM kernels, so
+//  the ratio is what swapping FULLY_CONNECTED for SPARSE_FULLY_CONNECTED buys.
+*/
+
+#include "sparse_kernels.h"
+#include <stdlib.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+
+#ifdef APP_BENCHMARK
+
+#include "sparse_benchmark.h"
+
+#define SPARSE_BENCH_ROUNDS 256         // Windows per measurement
+#define SPARSE_BENCH_WIDTH  64          // Widest layer of the autoencoder
+
+using namespace sparse_benchmark;
+
+static float scratch[2][SPARSE_BENCH_WIDTH];
+static volatile float sink;
+
+// Forward pass through every FullyConnected; sparse == nullptr runs all layers dense
+static void forward(const float* window, const sparse_kernels::BlockSparseMatrix* sparse)
+{
+    const float* x = window;
+    for (int l = 0; l < kLayers; l++) {
+        float* y = scratch[l % 2];
+        if (sparse != nullptr && sparse[l].out_features > 0) {
+            sparse_kernels::sparse_dense(x, sparse[l], kDense[l].bias, kDense[l].relu, y);
+        } else {
+            sparse_kernels::dense(x, kDense[l].weights, kDense[l].bias, kDense[l].in_features,
+                kDense[l].out_features, kDense[l].relu, y);
+        }
+        x = y;
+    }
+    sink = x[0];
+}
+
+static uint32_t time_forward(const sparse_kernels::BlockSparseMatrix* sparse)
+{
+    float window[SPARSE_BENCH_WIDTH];
+    uint32_t start = k_cycle_get_32();
+    for (int round = 0; round < SPARSE_BENCH_ROUNDS; round++) {
+        for (int f = 0; f < kDense[0].in_features; f++) {
+            window[f] = rand() / (float)RAND_MAX;
+        }
+        forward(window, sparse);
+    }
+    return k_cycle_get_32() - start;
+}
+
+extern "C" void sparse_run_benchmark(void)
+{
+    for (int l = 0; l < kLayers; l++) {
+        if (kDense[l].in_features > SPARSE_BENCH_WIDTH || kDense[l].out_features > SPARSE_BENCH_WIDTH) {
+            printk("Sparse benchmark: layer %d wider than %d, skipped\n", l, SPARSE_BENCH_WIDTH);
+            return;
+        }
+    }
+
+    uint32_t dense_cycles = time_forward(nullptr);
+    uint32_t dense_ns = (uint32_t)(k_cyc_to_ns_floor64(dense_cycles) / SPARSE_BENCH_ROUNDS);
+
+    printk("\nFullyConnected layers, ns per window over %d windows:\n", SPARSE_BENCH_ROUNDS);
+    printk("  dense  %8u\n", dense_ns);
+    for (int s = 0; s < kNumSparsities; s++) {
+        uint32_t cycles = time_forward(kSparse[s]);
+        uint32_t ns = (uint32_t)(k_cyc_to_ns_floor64(cycles) / SPARSE_BENCH_ROUNDS);
+        uint32_t speedup = cycles > 0 ? (uint32_t)((uint64_t)dense_cycles * 100 / cycles) : 0;
+        printk("  %3d%%   %8u  (%u.%02ux)\n", kSparsities[s], ns, speedup / 100, speedup % 100);
+    }
+}
+
+#endif // APP_BENCHMARK
@@ -0,0 +1,110 @@
+/*
+//  sparse_fully_connected.cpp - TFLM kernel for the SPARSE_FULLY_CONNECTED custom op
+//
+//  The packed weights stay in the flatbuffer (flash); Prepare() only checks the
+//  block-CSR index against the activation shapes and keeps a view of it, so Eval()
+//  is a straight walk over the stored blocks of each output row.
+*/
+
+#include "sparse_fully_connected.h"
+#include "sparse_kernels.h"
+#include <tensorflow/lite/c/common.h>
+#include <tensorflow/lite/micro/kernels/kernel_util.h>
+#include <tensorflow/lite/micro/micro_context.h>
+#include <tensorflow/lite/micro/micro_log.h>
+
+namespace {
+
+constexpr int kInputTensor = 0;
+constexpr int kWeightsTensor = 1;
+constexpr int kBiasTensor = 2;
+constexpr int kOutputTensor = 0;
+
+int elements(const TfLiteIntArray* dims)
+{
+    int n = 1;
+    for (int i = 0; i < dims->size; i++) n *= dims->data[i];
+    return n;
+}
+
+struct OpData {
+    sparse_kernels::BlockSparseMatrix weights;
+    bool relu;
+};
+
+void* Init(TfLiteContext* context, const char* buffer, size_t length)
+{
+    OpData* data = static_cast<OpData*>(context->AllocatePersistentBuffer(context, sizeof(OpData)));
+    if (data != nullptr) {
+        data->relu = buffer != nullptr && length > 0 && buffer[0] != 0;
+    }
+    return data;
+}
+
+TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node)
+{
+    OpData* data = static_cast<OpData*>(node->user_data);
+    TF_LITE_ENSURE(context, data != nullptr);
+    TF_LITE_ENSURE(context, node->inputs->size >= 2 && node->outputs->size == 1);
+
+    tflite::MicroContext* micro_context = tflite::GetMicroContext(context);
+    TfLiteTensor* input = micro_context->AllocateTempInputTensor(node, kInputTensor);
+    TfLiteTensor* weights = micro_context->AllocateTempInputTensor(node, kWeightsTensor);
+    TfLiteTensor* bias = micro_context->AllocateTempInputTensor(node, kBiasTensor);
+    TfLiteTensor* output = micro_context->AllocateTempOutputTensor(node, kOutputTensor);
+
+    TfLiteStatus status = kTfLiteError;
+    if (input != nullptr && weights != nullptr && output != nullptr &&
+        input->type == kTfLiteFloat32 && output->type == kTfLiteFloat32 && weights->type == kTfLiteUInt8 &&
+        (bias == nullptr || bias->type == kTfLiteFloat32) &&
+        sparse_kernels::unpack(weights->data.uint8, weights->bytes, &data->weights)) {
+
+        const sparse_kernels::BlockSparseMatrix& w = data->weights;
+        int in_elements = elements(input->dims);
+        int out_elements = elements(output->dims);
+        int batches = in_elements / w.in_features;
+        bool shapes_ok = in_elements % w.in_features == 0 && out_elements == batches * w.out_features &&
+                         (bias == nullptr || elements(bias->dims) == w.out_features);
+        if (shapes_ok) {
+            status = kTfLiteOk;
+        } else {
+            MicroPrintf("SPARSE_FULLY_CONNECTED: weights %dx%d do not match the activations",
+                w.out_features, w.in_features);
+        }
+    } else {
+        MicroPrintf("SPARSE_FULLY_CONNECTED: unsupported tensor types or corrupt packed weights");
+    }
+
+    if (input != nullptr) micro_context->DeallocateTempTfLiteTensor(input);
+    if (weights != nullptr) micro_context->DeallocateTempTfLiteTensor(weights);
+    if (bias != nullptr) micro_context->DeallocateTempTfLiteTensor(bias);
+    if (output != nullptr) micro_context->DeallocateTempTfLiteTensor(output);
+    return status;
+}
+
+TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node)
+{
+    const OpData* data = static_cast<const OpData*>(node->user_data);
+    const TfLiteEvalTensor* input = tflite::micro::GetEvalInput(context, node, kInputTensor);
+    const TfLiteEvalTensor* bias = tflite::micro::GetEvalInput(context, node, kBiasTensor);
+    TfLiteEvalTensor* output = tflite::micro::GetEvalOutput(context, node, kOutputTensor);
+
+    const sparse_kernels::BlockSparseMatrix& w = data->weights;
+    const float* x = tflite::micro::GetTensorData<float>(input);
+    const float* b = bias != nullptr ? tflite::micro::GetTensorData<float>(bias) : nullptr;
+    float* y = tflite::micro::GetTensorData<float>(output);
+
+    int batches = elements(input->dims) / w.in_features;
+    for (int n = 0; n < batches; n++) {
+        sparse_kernels::sparse_dense(x + n * w.in_features, w, b, data->relu, y + n * w.out_features);
+    }
+    return kTfLiteOk;
+}
+
+}  // namespace
+
+TFLMRegistration* register_sparse_fully_connected()
+{
+    static TFLMRegistration registration = tflite::micro::RegisterOp(Init, Prepare, Eval);
+    return &registration;
+}
@@ -1,77 +1,1073 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <zephyr/kernel.h>
-#include <zephyr/device.h>
 #include <zephyr/sys/printk.h>
-#include <zephyr/drivers/gpio.h>
+#include <zephyr/sys/atomic.h>
 #include <zephyr/sys/__assert.h>
 
 #include "autoencoder_model.h"
+#include "arena_sizes.h"
+#include "model_op_resolver.h"
+#include "tflite_wrapper.h"
+#include "sensor.h"
+#include "window.h"
+#include "op_profiler.h"
+#include "replay_data.h"
+#include "model_store.h"
+#include <math.h>
+#include <string.h>
+#include <new>
+
+#ifdef APP_BENCHMARK
+#include "autoencoder_compiled.h"
+#endif
+#include <tensorflow/lite/micro/micro_allocator.h>
 #include <tensorflow/lite/micro/micro_interpreter.h>
 #include <tensorflow/lite/micro/micro_op_resolver.h>
-#include <tensorflow/lite/micro/micro_mutable_op_resolver.h>
 #include <tensorflow/lite/schema/schema_generated.h>
 
-#define TENSOR_ARENA_SIZE       10 * 1024
+#ifdef TFLITE_ARENA_REPORT
+#include <tensorflow/lite/micro/recording_micro_allocator.h>
+#endif
 
-static uint8_t tensor_arena[TENSOR_ARENA_SIZE];
+// Model variant is picked at build time (APP_MODEL_VARIANT); the batched model follows it
+#ifdef MODEL_VARIANT_INT8
+#define ACTIVE_MODEL                       autoencoder_int8_model_tflite
+#define ACTIVE_ARENA_MIN_BYTES             INT8_ARENA_MIN_BYTES
+#define ACTIVE_ARENA_PERSISTENT_BYTES      INT8_ARENA_PERSISTENT_BYTES
+#define ACTIVE_ARENA_NON_PERSISTENT_BYTES  INT8_ARENA_NON_PERSISTENT_BYTES
+#define ACTIVE_ARENA_SIZE                  INT8_ARENA_SIZE
+#else
+#define ACTIVE_MODEL                       autoencoder_model_tflite
+#define ACTIVE_ARENA_MIN_BYTES             FLOAT_ARENA_MIN_BYTES
+#define ACTIVE_ARENA_PERSISTENT_BYTES      FLOAT_ARENA_PERSISTENT_BYTES
+#define ACTIVE_ARENA_NON_PERSISTENT_BYTES  FLOAT_ARENA_NON_PERSISTENT_BYTES
+#define ACTIVE_ARENA_SIZE                  FLOAT_ARENA_SIZE
+#endif
 
-const tflite::Model* model = NULL;
-tflite::MicroInterpreter* interpreter = NULL;
-TfLiteTensor* input = NULL;
-TfLiteTensor* output = NULL;
+// Model registry: the model each MachineType runs, indexed by MachineType. Types that name the
+// same model share one interpreter; every distinct model and the batched interpreter are tenants
+// of one shared arena.
+static constexpr const unsigned char* machine_type_models[NUM_MACHINE_TYPES] = {
+    ACTIVE_MODEL,                   // AIR_COMPRESSOR: Temperature, Pressure, Vibration
+    ACTIVE_MODEL,                   // STEAM_BOILER:   Temperature, Pressure
+    ACTIVE_MODEL,                   // ELECTRIC_MOTOR: Temperature
+};
 
-extern "C" void tflite_setup()
+// Registry entries that differ from every entry before them
+static constexpr int count_distinct_models(const unsigned char* const* models, int count)
 {
-    // Load model
-    model = tflite::GetModel(autoencoder_model_tflite);
-    if (model->version() != TFLITE_SCHEMA_VERSION) {
-        printk("Model schema mismatch!\n");
-        return;
+    int distinct = 0;
+    for (int i = 0; i < count; i++) {
+        bool seen = false;
+        for (int j = 0; j < i; j++) seen = seen || models[j] == models[i];
+        if (!seen) distinct++;
+    }
+    return distinct;
+}
+
+// Single-window interpreters per bank; a flash image runs one model for every type
+#define NUM_TYPE_MODELS         count_distinct_models(machine_type_models, NUM_MACHINE_TYPES)
+
+// Each tenant keeps its own persistent allocations, but the non-persistent region (activations,
+// planner scratch) is reused between Invoke()s, so the shared arena only needs the largest one.
+// Per-model figures come from scripts/arena_size.py; margin and rounding match it.
+#define ARENA_MAX(a, b)         ((a) > (b) ? (a) : (b))
+#define SHARED_ARENA_BYTES      (NUM_TYPE_MODELS * ACTIVE_ARENA_PERSISTENT_BYTES + BATCH_ARENA_PERSISTENT_BYTES + \
+                                 ARENA_MAX(ACTIVE_ARENA_NON_PERSISTENT_BYTES, BATCH_ARENA_NON_PERSISTENT_BYTES))
+#define SHARED_ARENA_SIZE       ((SHARED_ARENA_BYTES * 11 / 10 + 255) / 256 * 256)
+#define SEPARATE_ARENAS_SIZE    (NUM_TYPE_MODELS * ACTIVE_ARENA_SIZE + BATCH_ARENA_SIZE)
+
+// APP_TENSOR_ARENA_SIZE overrides the shared arena size
+#ifndef TENSOR_ARENA_SIZE
+#define TENSOR_ARENA_SIZE       SHARED_ARENA_SIZE
+#endif
+
+// Every tenant's persistent allocations plus the shared scratch, not just the activation peak:
+// build_bank() checks the same sum against the allocator's measured usage
+static_assert(TENSOR_ARENA_SIZE >= SHARED_ARENA_BYTES,
+    "Tensor arena below the tenants' persistent plus non-persistent bytes");
+static_assert(ACTIVE_ARENA_NON_PERSISTENT_BYTES <= BATCH_ARENA_NON_PERSISTENT_BYTES,
+    "Tenants are allocated in ascending scratch order; the batch interpreter must come last");
+
+#ifdef TFLITE_ARENA_REPORT
+typedef tflite::RecordingMicroAllocator ArenaAllocator;
+#else
+typedef tflite::MicroAllocator ArenaAllocator;
+#endif
+
+// With model slots, a second bank holds the spare arena a model update is built in while the
+// first keeps serving windows
+#ifdef MODEL_SLOTS
+#define MODEL_BANKS             2
+#else
+#define MODEL_BANKS             1
+#endif
+
+static ModelOpResolver resolver;                   // Exactly the ops in the embedded models
+
+// Per-op latency of a bank's single and batched interpreters, indexed by InferencePath. Each bank
+// has its own pair, so an update built in the spare bank never records into the tables the
+// active bank's Invoke()s are filling.
+#ifdef TFLITE_OP_PROFILER
+#define PROFILER(bank, path)    (&(bank)->profilers[path])
+#else
+#define PROFILER(bank, path)    nullptr
+#endif
+
+struct ModelSlot {
+    const unsigned char* model_data;
+    tflite::MicroInterpreter* interpreter;
+    TfLiteTensor* input;
+    TfLiteTensor* output;
+    bool input_in_place;                            // Planned input survives Invoke(): windows are scored from it
+};
+
+// One complete set of interpreters over its own shared arena. Inference reads whichever bank is
+// active; tflite_setup() builds an update in the other one and switches between windows.
+struct ModelBank {
+    alignas(16) uint8_t arena[TENSOR_ARENA_SIZE];
+    // Interpreters are constructed in place at setup, once their models are known
+    alignas(tflite::MicroInterpreter) uint8_t interpreter_storage[NUM_TYPE_MODELS + 1][sizeof(tflite::MicroInterpreter)];
+    ArenaAllocator* allocator;
+    ModelSlot model_slots[NUM_TYPE_MODELS];         // One per distinct single-window model
+    int num_models;
+    const ModelSlot* type_slots[NUM_MACHINE_TYPES]; // Each MachineType's model slot; NULL until built
+    ModelSlot batch_slot;                           // Activations [INFERENCE_BATCH_SIZE, MODEL_NUM_FEATURES]; may be empty
+    const unsigned char* batch_source;              // Single-window model the batched one was made from
+    uint32_t version;                               // 0: embedded model, otherwise the flash image's version
+    atomic_t users;                                 // Inference calls currently running on this bank
+    uint32_t allocate_cycles;                       // AllocateTensors() time of the last build
+    bool offline_plan;                              // Every model of the last build carries an offline plan
+#ifdef TFLITE_OP_PROFILER
+    mutable OpProfiler profilers[2];                // Written by Invoke() on the bank's interpreters
+#endif
+};
+
+// Models a bank is built from: the embedded registry, or a validated flash image
+struct ModelSource {
+    uint32_t version;
+    const unsigned char* type_models[NUM_MACHINE_TYPES];
+    const unsigned char* batch_model;               // NULL: no batched copy, the fleet runs per machine
+    const unsigned char* batch_source;              // Single-window model batch_model was made from
+};
+
+static ModelBank banks[MODEL_BANKS];
+static atomic_ptr_t active_bank = ATOMIC_PTR_INIT(NULL);
+
+static StartupStats startup;                        // Updated only when a built bank is switched to
+
+// Offsets in TFLM's offline planner metadata let AllocateTensors() skip runtime planning
+#define OFFLINE_PLAN_METADATA   "OfflineMemoryAllocation"
+
+static int tensor_elements(const TfLiteTensor* tensor)
+{
+    int n = 1;
+    for (int i = 0; i < tensor->dims->size; i++) {
+        n *= tensor->dims->data[i];
+    }
+    return n;
+}
+
+// Float and full-int8 models are supported; anything else is a conversion mistake
+static bool check_io(const TfLiteTensor* in, const TfLiteTensor* out, int rows)
+{
+    if (in->type != out->type || (in->type != kTfLiteFloat32 && in->type != kTfLiteInt8)) {
+        printk("Unsupported model I/O type %d/%d\n", in->type, out->type);
+        return false;
+    }
+    if (tensor_elements(in) != rows * MODEL_NUM_FEATURES || tensor_elements(out) != rows * MODEL_NUM_FEATURES) {
+        printk("Model I/O has %d/%d elements, expected %d\n",
+            tensor_elements(in), tensor_elements(out), rows * MODEL_NUM_FEATURES);
+        return false;
     }
+    return true;
+}
 
-    // Set up operator resolver (includes all ops)
-    static tflite::MicroMutableOpResolver<5> resolver;
-    resolver.AddFullyConnected();
-    resolver.AddRelu();
-    resolver.AddReshape();
-    resolver.AddSoftmax();
+// Offline plan table: [version, subgraph, tensor count, arena offset per tensor], or NULL
+static const flatbuffers::Vector<uint8_t>* offline_plan(const tflite::Model* m)
+{
+    if (m->metadata() == NULL) return NULL;
+    for (uint32_t i = 0; i < m->metadata()->size(); i++) {
+        const tflite::Metadata* entry = m->metadata()->Get(i);
+        if (entry->name() != NULL && strcmp(entry->name()->c_str(), OFFLINE_PLAN_METADATA) == 0) {
+            return m->buffers()->Get(entry->buffer())->data();
+        }
+    }
+    return NULL;
+}
 
-    // Set up interpreter
-    static tflite::MicroInterpreter static_interpreter(
-        model, resolver, tensor_arena, TENSOR_ARENA_SIZE);
-    interpreter = &static_interpreter;
+static bool has_offline_plan(const tflite::Model* m)
+{
+    return offline_plan(m) != NULL;
+}
 
-    // Allocate tensor buffers
-    TfLiteStatus allocate_status = interpreter->AllocateTensors();
-    if (allocate_status != kTfLiteOk) {
+static size_t tensor_type_size(tflite::TensorType type)
+{
+    switch (type) {
+        case tflite::TensorType_FLOAT32:
+        case tflite::TensorType_INT32: return 4;
+        case tflite::TensorType_INT16: return 2;
+        case tflite::TensorType_INT8:
+        case tflite::TensorType_UINT8: return 1;
+        default: return 0;
+    }
+}
+
+static size_t tensor_bytes(const tflite::Tensor* tensor)
+{
+    size_t bytes = tensor_type_size(tensor->type());
+    for (uint32_t d = 0; tensor->shape() != NULL && d < tensor->shape()->size(); d++) {
+        bytes *= tensor->shape()->Get(d);
+    }
+    return bytes;
+}
+
+// Planned arena offset of tensor `index`; the table is little-endian int32 and may be unaligned
+static int32_t plan_offset(const flatbuffers::Vector<uint8_t>* plan, uint32_t index)
+{
+    int32_t offset;
+    memcpy(&offset, plan->data() + (3 + index) * sizeof(int32_t), sizeof(offset));
+    return offset;
+}
+
+// True when the offline plan gives the input tensor an arena region no other tensor is planned
+// into, so a window written there before Invoke() is still intact afterwards. The runtime
+// planner reuses the input once its last reader has run.
+static bool input_survives_invoke(const tflite::Model* m)
+{
+    const flatbuffers::Vector<uint8_t>* plan = offline_plan(m);
+    const tflite::SubGraph* subgraph = m->subgraphs()->Get(0);
+    uint32_t num_tensors = subgraph->tensors()->size();
+    if (plan == NULL || plan->size() != (3 + num_tensors) * sizeof(int32_t)) return false;
+
+    uint32_t in = (uint32_t)subgraph->inputs()->Get(0);
+    int32_t in_start = plan_offset(plan, in);
+    int32_t in_end = in_start + (int32_t)tensor_bytes(subgraph->tensors()->Get(in));
+    if (in_start < 0) return false;
+
+    for (uint32_t i = 0; i < num_tensors; i++) {
+        int32_t start = plan_offset(plan, i);
+        int32_t end = start + (int32_t)tensor_bytes(subgraph->tensors()->Get(i));
+        if (i != in && start >= 0 && start < in_end && in_start < end) return false;
+    }
+    return true;
+}
+
+static bool setup_interpreter(tflite::MicroInterpreter* interp, int rows)
+{
+    if (interp->AllocateTensors() != kTfLiteOk) {
         printk("AllocateTensors() failed\n");
-        return;
+        return false;
     }
+    return check_io(interp->input(0), interp->output(0), rows);
+}
 
-    // Get input/output tensors
-    input = interpreter->input(0);
-    output = interpreter->output(0);
+#ifdef TFLITE_ARENA_REPORT
+// Print where one tenant's tensors live: read in place from flash or planned into the arena
+static void report_model_tensors(const char* label, const tflite::Model* m, size_t min_bytes)
+{
+    const tflite::SubGraph* subgraph = m->subgraphs()->Get(0);
+    size_t activation_bytes = 0;
+
+    printk("\n%s tensors\n", label);
+    for (uint32_t i = 0; i < subgraph->tensors()->size(); i++) {
+        const tflite::Tensor* tensor = subgraph->tensors()->Get(i);
+        const flatbuffers::Vector<uint8_t>* data = m->buffers()->Get(tensor->buffer())->data();
 
-    printk("TFLite Micro setup complete!\n");
+        size_t bytes = tensor_bytes(tensor);
+        bool in_flash = data != NULL && data->size() > 0;           // Weights are read in place from the model
+        if (!in_flash) activation_bytes += bytes;
+        printk("  tensor %2u %6u bytes  %-5s  %s\n", (unsigned)i, (unsigned)bytes,
+            in_flash ? "flash" : "arena", tensor->name() ? tensor->name()->c_str() : "");
+    }
+    printk("  activations (unplanned sum) %u bytes, planned high-water estimate %u bytes\n",
+        (unsigned)activation_bytes, (unsigned)min_bytes);
 }
 
-extern "C" void tflite_run_inference() 
+// Print where the shared arena went: per allocation type, and the headroom left
+static void report_arena(const tflite::RecordingMicroAllocator* recorder, size_t arena_size)
 {
-    // Example: Fill input with dummy data (e.g., all 0.5)
-    for (int i = 0; i < input->bytes / sizeof(float); i++) {
-        input->data.f[i] = 0.5f;
+    printk("\nShared arena report\n");
+    recorder->PrintAllocations();
+
+    const tflite::RecordingSingleArenaBufferAllocator* buffers = recorder->GetSimpleMemoryAllocator();
+    size_t persistent = buffers->GetPersistentUsedBytes();
+    size_t non_persistent = buffers->GetNonPersistentUsedBytes();
+    size_t used = buffers->GetUsedBytes();
+
+    printk("  persistent %u + non-persistent %u = %u of %u bytes, headroom %d bytes\n",
+        (unsigned)persistent, (unsigned)non_persistent, (unsigned)used, (unsigned)arena_size,
+        (int)arena_size - (int)used);
+}
+#endif // TFLITE_ARENA_REPORT
+
+// Build one tenant of the bank's arena and resolve its I/O tensors
+static bool setup_slot(ModelBank* bank, ModelSlot* slot, void* storage, const unsigned char* model_data, int rows,
+                       InferencePath path, const char* label)
+{
+    const tflite::Model* m = tflite::GetModel(model_data);
+    if (m->version() != TFLITE_SCHEMA_VERSION) {
+        printk("%s: model schema mismatch!\n", label);
+        return false;
     }
 
+    tflite::MicroInterpreter* interp = new (storage) tflite::MicroInterpreter(
+        m, resolver, bank->allocator, nullptr, PROFILER(bank, path));
+    slot->interpreter = interp;                     // Set before AllocateTensors() so a failure is torn down too
+    uint32_t start = k_cycle_get_32();
+    bool ok = setup_interpreter(interp, rows);
+    bank->allocate_cycles += k_cycle_get_32() - start;
+    if (!ok) {
+        printk("%s: interpreter setup failed\n", label);
+        return false;
+    }
+    if (!has_offline_plan(m)) bank->offline_plan = false;
+
+#ifdef TFLITE_ARENA_REPORT
+    report_model_tensors(label, m, rows > 1 ? BATCH_ARENA_MIN_BYTES : ACTIVE_ARENA_MIN_BYTES);
+#endif
+
+    slot->model_data = model_data;
+    slot->input = interp->input(0);
+    slot->output = interp->output(0);
+    slot->input_in_place = input_survives_invoke(m);
+    return true;
+}
+
+// Destroy a bank's interpreters; the caller makes sure no inference is running on it
+static void clear_bank(ModelBank* bank)
+{
+    for (int m = 0; m < bank->num_models; m++) {
+        if (bank->model_slots[m].interpreter != NULL) bank->model_slots[m].interpreter->~MicroInterpreter();
+        bank->model_slots[m] = ModelSlot{};
+    }
+    bank->num_models = 0;
+    for (int type = 0; type < NUM_MACHINE_TYPES; type++) {
+        bank->type_slots[type] = NULL;
+    }
+    if (bank->batch_slot.interpreter != NULL) bank->batch_slot.interpreter->~MicroInterpreter();
+    bank->batch_slot = ModelSlot{};
+    bank->batch_source = NULL;
+    bank->allocator = NULL;
+}
+
+// Build every interpreter for `source` in the bank's arena; on failure the bank is left empty
+static bool build_bank(ModelBank* bank, const ModelSource* source)
+{
+    clear_bank(bank);
+    bank->allocate_cycles = 0;
+    bank->offline_plan = true;                      // Cleared by any model planned at runtime
+
+    // One allocator over the bank's arena; every interpreter takes its persistent data from the
+    // tail and plans activations into the common head
+    bank->allocator = ArenaAllocator::Create(bank->arena, TENSOR_ARENA_SIZE);
+    if (bank->allocator == NULL) {
+        printk("Tensor arena allocator setup failed!\n");
+        return false;
+    }
+
+    // Tenants are allocated in ascending scratch order so the planned head only ever grows
+    bool ok = true;
+    for (int type = 0; ok && type < NUM_MACHINE_TYPES; type++) {
+        const unsigned char* model = source->type_models[type];
+        ModelSlot* slot = NULL;
+        for (int m = 0; m < bank->num_models; m++) {
+            if (bank->model_slots[m].model_data == model) slot = &bank->model_slots[m];
+        }
+        if (slot == NULL) {
+            if (bank->num_models == NUM_TYPE_MODELS) {
+                printk("More than %d distinct models; the arena is sized for the registry's\n", NUM_TYPE_MODELS);
+                ok = false;
+                break;
+            }
+            slot = &bank->model_slots[bank->num_models];
+            ok = setup_slot(bank, slot, bank->interpreter_storage[bank->num_models], model, 1,
+                            INFERENCE_PATH_SINGLE, get_machine_type_string((MachineType)type));
+            bank->num_models++;                     // Counted even on failure so clear_bank() tears it down
+        }
+        bank->type_slots[type] = slot;
+    }
+    if (ok && source->batch_model != NULL) {
+        ok = setup_slot(bank, &bank->batch_slot, bank->interpreter_storage[NUM_TYPE_MODELS], source->batch_model,
+                        INFERENCE_BATCH_SIZE, INFERENCE_PATH_BATCH, "Batch model");
+    }
+    if (!ok) {
+        clear_bank(bank);
+        return false;
+    }
+
+#ifdef TFLITE_ARENA_REPORT
+    report_arena(bank->allocator, TENSOR_ARENA_SIZE);
+#endif
+
+    // Measured high-water mark of the shared allocator against the sum the build asserted on; a
+    // model that outgrows the estimate needs the constants in scripts/arena_size.py raised
+    size_t used = bank->allocator->used_bytes();
+    if (used > SHARED_ARENA_BYTES) {
+        printk("Arena use %u bytes exceeds the build-time estimate of %u bytes (arena %u)\n",
+            (unsigned)used, (unsigned)SHARED_ARENA_BYTES, (unsigned)TENSOR_ARENA_SIZE);
+    }
+    __ASSERT(used <= SHARED_ARENA_BYTES, "Arena estimate below measured use");
+
+    bank->batch_source = source->batch_model != NULL ? source->batch_source : NULL;
+    bank->version = source->version;
+    return true;
+}
+
+// Pin the active bank for one inference call. The re-check closes the window where setup switches
+// banks between the load and the increment; setup never rebuilds a bank with users.
+static ModelBank* acquire_bank(void)
+{
+    for (;;) {
+        ModelBank* bank = (ModelBank*)atomic_ptr_get(&active_bank);
+        if (bank == NULL) return NULL;
+        atomic_inc(&bank->users);
+        if (atomic_ptr_get(&active_bank) == bank) return bank;
+        atomic_dec(&bank->users);
+    }
+}
+
+static void release_bank(ModelBank* bank)
+{
+    atomic_dec(&bank->users);
+}
+
+#ifdef MODEL_SLOTS
+// Flash images are untrusted until the flatbuffer verifier has walked them
+static bool verify_model(const uint8_t* data, uint32_t len, const char* label)
+{
+    flatbuffers::Verifier verifier(data, len);
+    if (!tflite::VerifyModelBuffer(verifier) || tflite::GetModel(data)->version() != TFLITE_SCHEMA_VERSION) {
+        printk("%s: not a valid schema v%d model\n", label, TFLITE_SCHEMA_VERSION);
+        return false;
+    }
+    return true;
+}
+
+// Newest flash image with a version above `current` and below `below` that passes the verifier.
+// A slot that fails it is skipped for the next older one, not for the embedded model.
+static bool flash_source(uint32_t current, uint32_t below, ModelSource* source)
+{
+    if (model_store_init() != 0) return false;
+
+    ModelImage image;
+    for (;;) {
+        bool found = false;
+        for (int slot = 0; slot < MODEL_STORE_NUM_SLOTS; slot++) {
+            ModelImage candidate;
+            if (model_store_load(slot, &candidate) == 0 && candidate.version > current && candidate.version < below &&
+                (!found || candidate.version > image.version)) {
+                image = candidate;
+                found = true;
+            }
+        }
+        if (!found) return false;
+        if (verify_model(image.model, image.model_len, "Slot model")) break;
+        below = image.version;
+    }
+
+    source->version = image.version;
+    for (int type = 0; type < NUM_MACHINE_TYPES; type++) {
+        source->type_models[type] = image.model;
+    }
+    source->batch_model = NULL;
+    source->batch_source = image.model;
+    if (image.batch_model != NULL && image.batch_size == INFERENCE_BATCH_SIZE &&
+        verify_model(image.batch_model, image.batch_len, "Slot batch model")) {
+        source->batch_model = image.batch_model;
+    }
+    printk("Model slot %d: image v%u validated (%u bytes%s)\n", image.slot, image.version, image.model_len,
+        source->batch_model != NULL ? ", with batched copy" : ", no batched copy");
+    return true;
+}
+#endif
+
+static void embedded_source(ModelSource* source)
+{
+    source->version = 0;
+    for (int type = 0; type < NUM_MACHINE_TYPES; type++) {
+        source->type_models[type] = machine_type_models[type];
+    }
+    source->batch_model = autoencoder_batch_model_tflite;
+    source->batch_source = ACTIVE_MODEL;
+}
+
+extern "C" void tflite_setup()
+{
+    uint32_t setup_start = k_cycle_get_32();
+
+    // Register the ops the models use (generated from the graphs by scripts/generate_resolver.py)
+    static bool ops_registered = false;
+    if (!ops_registered) {
+        if (register_model_ops(resolver) != kTfLiteOk) {
+            printk("Op registration failed!\n");
+            return;
+        }
+        ops_registered = true;
+    }
+
+    // First call: newest valid flash image, else the embedded models. Later calls only pick up a
+    // newer image, built in the spare bank while the active one keeps serving windows.
+    ModelBank* active = (ModelBank*)atomic_ptr_get(&active_bank);
+    uint32_t current = active != NULL ? active->version : 0;
+
+    ModelBank* spare = &banks[0];
+    if (active != NULL) {
+        if (MODEL_BANKS < 2) return;
+        spare = active == &banks[0] ? &banks[MODEL_BANKS - 1] : &banks[0];
+        while (atomic_get(&spare->users) != 0) {
+            k_yield();                                  // A window from before the last switch is finishing
+        }
+    }
+
+    // An image whose interpreters cannot be built is rejected for the next older valid image;
+    // the embedded model is the last resort at boot
+    ModelSource source;
+    uint32_t below = UINT32_MAX;
+    for (;;) {
+        bool found = false;
+#ifdef MODEL_SLOTS
+        found = flash_source(current, below, &source);
+#endif
+        if (!found && active == NULL) {
+            embedded_source(&source);
+            found = true;
+        }
+        if (!found) {
+            if (below == UINT32_MAX) {
+                printk("Model v%u is current\n", current);
+            } else {
+                printk("No newer model could be built, keeping v%u\n", current);
+            }
+            return;
+        }
+        if (build_bank(spare, &source)) break;
+        if (source.version == 0) return;
+        printk("Model v%u rejected, trying the next older image\n", source.version);
+        below = source.version;
+    }
+
+#ifdef TFLITE_OP_PROFILER
+    spare->profilers[INFERENCE_PATH_SINGLE].reset();    // Drop setup events and the bank's previous model
+    spare->profilers[INFERENCE_PATH_BATCH].reset();
+#endif
+
+    atomic_ptr_set(&active_bank, spare);                // The next window runs on the new bank
+    startup.setup_us = k_cyc_to_us_floor32(k_cycle_get_32() - setup_start);
+    startup.allocate_us = k_cyc_to_us_floor32(spare->allocate_cycles);
+    startup.offline_plan = spare->offline_plan ? 1 : 0;
+
+    const ModelSlot* sized = spare->batch_slot.interpreter != NULL ? &spare->batch_slot : spare->type_slots[0];
+    printk("Model registry: %d machine types on %d model(s) + batch model share one %u byte arena (%u used); "
+        "one arena per model would take %u bytes\n", (int)NUM_MACHINE_TYPES, spare->num_models, (unsigned)TENSOR_ARENA_SIZE,
+        (unsigned)sized->interpreter->arena_used_bytes(), (unsigned)SEPARATE_ARENAS_SIZE);
+    printk("TFLite Micro setup complete (%s model v%u%s)!\n",
+        sized->input->type == kTfLiteInt8 ? "int8" : "float", spare->version,
+        active != NULL ? ", switched without stopping inference" : "");
+    printk("Setup took %u us, %u us of it in AllocateTensors() (%s memory plan)\n", startup.setup_us,
+        startup.allocate_us, startup.offline_plan ? "offline" : "runtime");
+    printk("Sensor windows are packed into the input tensor and scored %s\n",
+        sized->input_in_place ? "in place" : "from a copy (input reused during Invoke())");
+}
+
+// Write one window into row `row` of the input tensor, quantizing at the edge for int8 models
+static void write_row(TfLiteTensor* tensor, int row, const float* window)
+{
+    if (tensor->type == kTfLiteInt8) {
+        int8_t* dst = &tensor->data.int8[row * MODEL_NUM_FEATURES];
+        float scale = tensor->params.scale;
+        int32_t zero_point = tensor->params.zero_point;
+        for (int f = 0; f < MODEL_NUM_FEATURES; f++) {
+            int32_t q = (int32_t)lroundf(window[f] / scale) + zero_point;
+            dst[f] = (int8_t)(q < -128 ? -128 : (q > 127 ? 127 : q));
+        }
+    } else {
+        float* dst = &tensor->data.f[row * MODEL_NUM_FEATURES];
+        for (int f = 0; f < MODEL_NUM_FEATURES; f++) {
+            dst[f] = window[f];
+        }
+    }
+}
+
+// Read row `row` of the output tensor as floats, dequantizing at the edge for int8 models
+static void read_row(const TfLiteTensor* tensor, int row, float* dst)
+{
+    if (tensor->type == kTfLiteInt8) {
+        const int8_t* src = &tensor->data.int8[row * MODEL_NUM_FEATURES];
+        for (int f = 0; f < MODEL_NUM_FEATURES; f++) {
+            dst[f] = (src[f] - tensor->params.zero_point) * tensor->params.scale;
+        }
+    } else {
+        const float* src = &tensor->data.f[row * MODEL_NUM_FEATURES];
+        for (int f = 0; f < MODEL_NUM_FEATURES; f++) {
+            dst[f] = src[f];
+        }
+    }
+}
+
+static TfLiteStatus invoke(const ModelBank* bank, tflite::MicroInterpreter* interp, InferencePath path)
+{
+#ifdef TFLITE_OP_PROFILER
+    bank->profilers[path].beginInvoke();
+#else
+    (void)bank;
+    (void)path;
+#endif
+    return interp->Invoke();
+}
+
+// Put a machine's window into row `row` of the slot's input and return where to score it from.
+// Float windows are normalized from the sensors straight into the tensor the model reads, and
+// scored there after Invoke() when the plan keeps the input intact. Pre-packed windows are
+// already in the caller's memory; int8 windows are quantized on the way in.
+static const float* stage_window(const ModelSlot* slot, int row, MachineHandle handle, const MachineConfig* config,
+                                 const float* packed, float* scratch)
+{
+    if (packed != NULL) {
+        write_row(slot->input, row, packed);
+        return packed;
+    }
+    if (slot->input->type != kTfLiteFloat32) {
+        pack_window(handle, config, scratch);
+        write_row(slot->input, row, scratch);
+        return scratch;
+    }
+
+    float* dst = &slot->input->data.f[row * MODEL_NUM_FEATURES];
+    pack_window(handle, config, dst);
+    if (slot->input_in_place) return dst;
+    memcpy(scratch, dst, MODEL_NUM_FEATURES * sizeof(float));      // Activations may overwrite the input
+    return scratch;
+}
+
+// Score one machine on the model registered for its type
+static int run_single(const ModelBank* bank, MachineHandle handle, const MachineConfig* config, const float* packed,
+                      InferenceResult* result)
+{
+    MachineType type = get_machine_type(handle);
+    if (type < 0 || type >= NUM_MACHINE_TYPES || bank->type_slots[type] == NULL) {
+        return -1;
+    }
+    const ModelSlot* slot = bank->type_slots[type];
+    uint32_t start = k_cycle_get_32();
+
+    float scratch[MODEL_NUM_FEATURES];
+    float reconstruction[MODEL_NUM_FEATURES];
+    // Inputs share the arena head; stage right before Invoke()
+    const float* window = stage_window(slot, 0, handle, config, packed, scratch);
+
     // Run inference
-    TfLiteStatus invoke_status = interpreter->Invoke();
+    TfLiteStatus invoke_status = invoke(bank, slot->interpreter, INFERENCE_PATH_SINGLE);
     if (invoke_status != kTfLiteOk) {
         printk("Invoke failed!\n");
+        return -1;
+    }
+
+    read_row(slot->output, 0, reconstruction);
+    reconstruction_scores(window, reconstruction, config->num_sensors, &result->score, &result->mae);
+    result->latency_us = k_cyc_to_us_floor32(k_cycle_get_32() - start);
+    return 0;
+}
+
+// Run up to INFERENCE_BATCH_SIZE machines, picked from the fleet by `index`, through one Invoke()
+static int run_batch(const ModelBank* bank, const int* index, int rows, const MachineHandle* handles,
+                     const MachineConfig* const* configs, const float* const* packed, InferenceResult* results)
+{
+    const ModelSlot* batch = &bank->batch_slot;
+    static const float empty_window[MODEL_NUM_FEATURES] = {0};
+    float scratch[INFERENCE_BATCH_SIZE][MODEL_NUM_FEATURES];
+    const float* windows[INFERENCE_BATCH_SIZE];
+    float reconstruction[MODEL_NUM_FEATURES];
+    uint32_t start = k_cycle_get_32();
+
+    // Stack every machine's window into the batch dimension
+    for (int r = 0; r < rows; r++) {
+        int i = index[r];
+        windows[r] = stage_window(batch, r, handles[i], configs[i], packed ? packed[i] : NULL, scratch[r]);
+    }
+    for (int r = rows; r < INFERENCE_BATCH_SIZE; r++) {
+        write_row(batch->input, r, empty_window);               // Unused rows of a partial batch
+    }
+
+    if (invoke(bank, batch->interpreter, INFERENCE_PATH_BATCH) != kTfLiteOk) {
+        printk("Batch Invoke failed!\n");
+        return -1;
+    }
+
+    // Latency is amortized across the machines that shared the Invoke()
+    uint32_t latency_us = k_cyc_to_us_floor32(k_cycle_get_32() - start);
+    for (int r = 0; r < rows; r++) {
+        read_row(batch->output, r, reconstruction);
+        InferenceResult* result = &results[index[r]];
+        reconstruction_scores(windows[r], reconstruction, configs[index[r]]->num_sensors, &result->score, &result->mae);
+        result->latency_us = latency_us / rows;
+    }
+    return 0;
+}
+
+// Score a fleet, batching every machine on the batched model's weights
+static int run_fleet(const ModelBank* bank, const MachineHandle* handles, const MachineConfig* const* configs,
+                     const float* const* packed, int count, InferenceResult* results)
+{
+
+    int pending[INFERENCE_BATCH_SIZE];
+    int rows = 0;
+
+    // Machines on the batched model go through in INFERENCE_BATCH_SIZE chunks; types registered
+    // with a different model, or a bank without a batched copy, fall back to their own interpreter
+    for (int i = 0; i < count; i++) {
+        MachineType type = get_machine_type(handles[i]);
+        if (type < 0 || type >= NUM_MACHINE_TYPES || bank->batch_source == NULL ||
+            bank->type_slots[type] == NULL || bank->type_slots[type]->model_data != bank->batch_source) {
+            const float* window = packed ? packed[i] : NULL;
+            if (run_single(bank, handles[i], configs[i], window, &results[i]) != 0) return -1;
+            continue;
+        }
+
+        pending[rows++] = i;
+        if (rows == INFERENCE_BATCH_SIZE) {
+            if (run_batch(bank, pending, rows, handles, configs, packed, results) != 0) return -1;
+            rows = 0;
+        }
+    }
+    if (rows > 0 && run_batch(bank, pending, rows, handles, configs, packed, results) != 0) return -1;
+    return 0;
+}
+
+// Uptime of the first scored window: boot-to-first-inference, including setup
+static void note_inference(void)
+{
+    if (startup.first_inference_us == 0) {
+        startup.first_inference_us = (uint32_t)k_ticks_to_us_floor64(k_uptime_ticks());
+    }
+}
+
+extern "C" int tflite_run_inference(MachineHandle handle, const MachineConfig* config, InferenceResult* result)
+{
+    if (handle < 0 || config == NULL || result == NULL) {
+        return -1;
+    }
+    ModelBank* bank = acquire_bank();
+    if (bank == NULL) return -1;
+    int ret = run_single(bank, handle, config, NULL, result);
+    release_bank(bank);
+    if (ret == 0) note_inference();
+    return ret;
+}
+
+// One fleet call runs entirely on one bank, so a model switch lands between windows
+static int run_fleet_pinned(const MachineHandle* handles, const MachineConfig* const* configs,
+                            const float* const* packed, int count, InferenceResult* results)
+{
+    if (handles == NULL || configs == NULL || results == NULL) {
+        return -1;
+    }
+    ModelBank* bank = acquire_bank();
+    if (bank == NULL) return -1;
+    int ret = run_fleet(bank, handles, configs, packed, count, results);
+    release_bank(bank);
+    if (ret == 0 && count > 0) note_inference();
+    return ret;
+}
+
+extern "C" int tflite_run_batch_inference(const MachineHandle* handles, const MachineConfig* const* configs,
+                                          int count, InferenceResult* results)
+{
+    return run_fleet_pinned(handles, configs, NULL, count, results);
+}
+
+extern "C" int tflite_run_window_inference(const MachineHandle* handles, const MachineConfig* const* configs,
+                                           const float* const* windows, int count, InferenceResult* results)
+{
+    if (windows == NULL) {
+        return -1;
+    }
+    return run_fleet_pinned(handles, configs, windows, count, results);
+}
+
+// Profiles are the active bank's: a model switch starts them over
+extern "C" int tflite_get_op_profile(InferencePath path, OpProfile* profiles, int max_ops)
+{
+#ifdef TFLITE_OP_PROFILER
+    if ((path != INFERENCE_PATH_SINGLE && path != INFERENCE_PATH_BATCH) || profiles == NULL) return 0;
+    ModelBank* bank = acquire_bank();
+    if (bank == NULL) return 0;
+    int n = bank->profilers[path].getStats(profiles, max_ops);
+    release_bank(bank);
+    return n;
+#else
+    return 0;
+#endif
+}
+
+extern "C" void tflite_reset_op_profile(InferencePath path)
+{
+#ifdef TFLITE_OP_PROFILER
+    if (path != INFERENCE_PATH_SINGLE && path != INFERENCE_PATH_BATCH) return;
+    ModelBank* bank = acquire_bank();
+    if (bank == NULL) return;
+    bank->profilers[path].reset();
+    release_bank(bank);
+#endif
+}
+
+extern "C" void tflite_get_startup_stats(StartupStats* stats)
+{
+    if (stats != NULL) *stats = startup;
+}
+
+extern "C" uint32_t tflite_model_version(void)
+{
+    const ModelBank* bank = (const ModelBank*)atomic_ptr_get(&active_bank);
+    return bank != NULL ? bank->version : 0;
+}
+
+#ifdef APP_BENCHMARK
+// Fill one window with synthetic normalized samples
+static void fill_random_window(float* dst)
+{
+    for (int f = 0; f < MODEL_NUM_FEATURES; f++) {
+        dst[f] = rand() / (float)RAND_MAX;
+    }
+}
+
+// Compare one Invoke() per machine against batched Invoke()s as the fleet grows
+static void benchmark_batching(void)
+{
+    static const int fleet_sizes[] = {3, 8, 16, 32, 64, 128, 256};
+    const int rounds = 4;
+
+    const ModelBank* bank = (const ModelBank*)atomic_ptr_get(&active_bank);
+    if (bank == NULL || bank->type_slots[AIR_COMPRESSOR] == NULL || bank->batch_slot.interpreter == NULL) {
+        printk("Benchmark: interpreters not set up\n");
+        return;
+    }
+
+    printk("\nBatching benchmark (batch size %d, %d rounds)\n", INFERENCE_BATCH_SIZE, rounds);
+    printk("%8s %14s %14s %10s\n", "machines", "per-machine us", "batched us", "speedup");
+
+    const ModelSlot* single = bank->type_slots[AIR_COMPRESSOR];
+    const ModelSlot* batch = &bank->batch_slot;
+    float windows[INFERENCE_BATCH_SIZE][MODEL_NUM_FEATURES];
+    float reconstruction[MODEL_NUM_FEATURES];
+
+    for (unsigned k = 0; k < sizeof(fleet_sizes) / sizeof(fleet_sizes[0]); k++) {
+        int machines = fleet_sizes[k];
+        float sink = 0.0f;
+
+        // One Invoke() per machine
+        uint32_t start = k_cycle_get_32();
+        for (int round = 0; round < rounds; round++) {
+            for (int m = 0; m < machines; m++) {
+                fill_random_window(windows[0]);
+                write_row(single->input, 0, windows[0]);
+                single->interpreter->Invoke();
+                read_row(single->output, 0, reconstruction);
+                sink += reconstruction_error(windows[0], reconstruction, MODEL_NUM_FEATURES);
+            }
+        }
+        uint32_t single_us = k_cyc_to_us_floor32(k_cycle_get_32() - start) / rounds;
+
+        // One Invoke() per INFERENCE_BATCH_SIZE machines
+        start = k_cycle_get_32();
+        for (int round = 0; round < rounds; round++) {
+            for (int first = 0; first < machines; first += INFERENCE_BATCH_SIZE) {
+                int rows = machines - first < INFERENCE_BATCH_SIZE ? machines - first : INFERENCE_BATCH_SIZE;
+                for (int r = 0; r < rows; r++) {
+                    fill_random_window(windows[r]);
+                    write_row(batch->input, r, windows[r]);
+                }
+                batch->interpreter->Invoke();
+                for (int r = 0; r < rows; r++) {
+                    read_row(batch->output, r, reconstruction);
+                    sink += reconstruction_error(windows[r], reconstruction, MODEL_NUM_FEATURES);
+                }
+            }
+        }
+        uint32_t batched_us = k_cyc_to_us_floor32(k_cycle_get_32() - start) / rounds;
+
+        printk("%8d %14u %14u %9.2fx\n", machines, single_us, batched_us,
+            (double)(batched_us > 0 ? (float)single_us / batched_us : 0.0f));
+        (void)sink;
+    }
+}
+
+// Float interpreter the comparison benchmarks measure against
+static tflite::MicroInterpreter* reference_interpreter(void)
+{
+    alignas(16) static uint8_t arena[FLOAT_ARENA_SIZE];
+    static tflite::MicroInterpreter reference(
+        tflite::GetModel(autoencoder_model_tflite), resolver, arena, FLOAT_ARENA_SIZE);
+    static bool ready = setup_interpreter(&reference, 1);
+    return ready ? &reference : NULL;
+}
+
+// Replay the CSV windows through the float and int8 models side by side
+static void benchmark_int8(void)
+{
+    alignas(16) static uint8_t int8_arena[INT8_ARENA_SIZE];
+    static tflite::MicroInterpreter int8_interpreter(
+        tflite::GetModel(autoencoder_int8_model_tflite), resolver, int8_arena, INT8_ARENA_SIZE);
+
+    tflite::MicroInterpreter* float_interpreter = reference_interpreter();
+    if (float_interpreter == NULL || !setup_interpreter(&int8_interpreter, 1)) {
+        printk("Benchmark: float/int8 interpreters not set up\n");
+        return;
+    }
+
+    float float_out[MODEL_NUM_FEATURES];
+    float int8_out[MODEL_NUM_FEATURES];
+    uint32_t float_cycles = 0, int8_cycles = 0;
+    float drift_sum = 0.0f, drift_max = 0.0f, float_score_sum = 0.0f;
+
+    for (unsigned i = 0; i < replay_num_windows; i++) {
+        const float* window = replay_windows[i];
+
+        uint32_t start = k_cycle_get_32();
+        write_row(float_interpreter->input(0), 0, window);
+        float_interpreter->Invoke();
+        read_row(float_interpreter->output(0), 0, float_out);
+        float_cycles += k_cycle_get_32() - start;
+
+        start = k_cycle_get_32();
+        write_row(int8_interpreter.input(0), 0, window);
+        int8_interpreter.Invoke();
+        read_row(int8_interpreter.output(0), 0, int8_out);
+        int8_cycles += k_cycle_get_32() - start;
+
+        float float_score = reconstruction_error(window, float_out, replay_num_sensors[i]);
+        float drift = fabsf(reconstruction_error(window, int8_out, replay_num_sensors[i]) - float_score);
+        float_score_sum += float_score;
+        drift_sum += drift;
+        drift_max = drift > drift_max ? drift : drift_max;
+    }
+
+    printk("\nFloat vs int8 on %u replayed windows\n", replay_num_windows);
+    printk("%6s %12s %12s %12s\n", "model", "flash bytes", "arena bytes", "us/window");
+    printk("%6s %12u %12u %12u\n", "float", autoencoder_model_tflite_len,
+        (unsigned)float_interpreter->arena_used_bytes(), k_cyc_to_us_floor32(float_cycles / replay_num_windows));
+    printk("%6s %12u %12u %12u\n", "int8", autoencoder_int8_model_tflite_len,
+        (unsigned)int8_interpreter.arena_used_bytes(), k_cyc_to_us_floor32(int8_cycles / replay_num_windows));
+    printk("Mean float score %f, int8 score drift mean %f max %f\n",
+        (double)(float_score_sum / replay_num_windows), (double)(drift_sum / replay_num_windows), (double)drift_max);
+}
+
+// Compiled straight-line backend vs the float interpreter on the replayed windows
+static void benchmark_compiled(void)
+{
+    static float scratch[autoencoder_compiled::kScratchSize];
+    const float tolerance = 1e-5f;
+
+    tflite::MicroInterpreter* float_interpreter = reference_interpreter();
+    if (float_interpreter == NULL) {
+        printk("Benchmark: float interpreter not set up\n");
         return;
     }
 
-    // Print output
-    for (int i = 0; i < output->bytes / sizeof(float); i++) {
-        printk("Output[%d]: %f\n", i, output->data.f[i]);
+    float interpreter_out[MODEL_NUM_FEATURES];
+    float compiled_out[MODEL_NUM_FEATURES];
+    uint32_t interpreter_cycles = 0, compiled_cycles = 0;
+    float max_diff = 0.0f;
+
+    for (unsigned i = 0; i < replay_num_windows; i++) {
+        const float* window = replay_windows[i];
+
+        uint32_t start = k_cycle_get_32();
+        write_row(float_interpreter->input(0), 0, window);
+        float_interpreter->Invoke();
+        read_row(float_interpreter->output(0), 0, interpreter_out);
+        interpreter_cycles += k_cycle_get_32() - start;
+
+        start = k_cycle_get_32();
+        autoencoder_compiled::forward(window, compiled_out, scratch);
+        compiled_cycles += k_cycle_get_32() - start;
+
+        for (int f = 0; f < MODEL_NUM_FEATURES; f++) {
+            float diff = fabsf(compiled_out[f] - interpreter_out[f]);
+            max_diff = diff > max_diff ? diff : max_diff;
+        }
     }
-}
\ No newline at end of file
+
+    printk("\nInterpreter vs compiled on %u replayed windows\n", replay_num_windows);
+    printk("%12s %12s %12s %12s\n", "backend", "flash bytes", "ram bytes", "us/window");
+    printk("%12s %12u %12u %12u\n", "interpreter", autoencoder_model_tflite_len,
+        (unsigned)float_interpreter->arena_used_bytes(), k_cyc_to_us_floor32(interpreter_cycles / replay_num_windows));
+    printk("%12s %12u %12u %12u\n", "compiled", (unsigned)autoencoder_compiled::kParameterBytes,
+        (unsigned)sizeof(scratch), k_cyc_to_us_floor32(compiled_cycles / replay_num_windows));
+    printk("Max output difference %e (%s, tolerance %e)\n",
+        (double)max_diff, max_diff <= tolerance ? "PASS" : "FAIL", (double)tolerance);
+}
+
+// Per-inference cost of staging a machine's window: packed on the stack and copied into the input
+// tensor (the path before in-place staging) vs packed straight into the tensor and scored there
+static void benchmark_zero_copy(void)
+{
+    static const MachineConfig config = {
+        "Benchmark", {{"Temperature", 60.0f, 100.0f}, {"Pressure", 72.0f, 145.0f}, {"Vibration", 0.5f, 2.0f}}, 3
+    };
+    const int rounds = 256;
+
+    const ModelBank* bank = (const ModelBank*)atomic_ptr_get(&active_bank);
+    if (bank == NULL || bank->type_slots[AIR_COMPRESSOR] == NULL) {
+        printk("Benchmark: interpreters not set up\n");
+        return;
+    }
+    const ModelSlot* slot = bank->type_slots[AIR_COMPRESSOR];
+    MachineHandle machine = create_machine("Benchmark", AIR_COMPRESSOR);
+
+    float window[MODEL_NUM_FEATURES];
+    float reconstruction[MODEL_NUM_FEATURES];
+    uint32_t copy_stage = 0, copy_total = 0, place_stage = 0, place_total = 0;
+    float mse, mae, sink = 0.0f;
+
+    for (int round = 0; round < rounds; round++) {
+        for (int s = 0; s < config.num_sensors; s++) {
+            const SensorConfig* sensor = &config.sensors[s];
+            set_sensor_value(machine, sensor->name,
+                sensor->min_value + (sensor->max_value - sensor->min_value) * rand() / (float)RAND_MAX);
+        }
+
+        uint32_t start = k_cycle_get_32();
+        pack_window(machine, &config, window);
+        write_row(slot->input, 0, window);
+        uint32_t staged = k_cycle_get_32();
+        slot->interpreter->Invoke();
+        read_row(slot->output, 0, reconstruction);
+        reconstruction_scores(window, reconstruction, config.num_sensors, &mse, &mae);
+        uint32_t end = k_cycle_get_32();
+        copy_stage += staged - start;
+        copy_total += end - start;
+        sink += mse;
+
+        float scratch[MODEL_NUM_FEATURES];
+        start = k_cycle_get_32();
+        const float* in = stage_window(slot, 0, machine, &config, NULL, scratch);
+        staged = k_cycle_get_32();
+        slot->interpreter->Invoke();
+        read_row(slot->output, 0, reconstruction);
+        reconstruction_scores(in, reconstruction, config.num_sensors, &mse, &mae);
+        end = k_cycle_get_32();
+        place_stage += staged - start;
+        place_total += end - start;
+        sink += mse;
+    }
+    destroy_machine(machine);
+
+    printk("\nWindow staging, cycles per inference over %d inferences (%s model, input %s)\n", rounds,
+        slot->input->type == kTfLiteInt8 ? "int8" : "float", slot->input_in_place ? "kept through Invoke()" : "reused");
+    printk("%10s %10s %10s\n", "staging", "stage", "total");
+    printk("%10s %10u %10u\n", "copy", copy_stage / rounds, copy_total / rounds);
+    printk("%10s %10u %10u\n", "in place", place_stage / rounds, place_total / rounds);
+    printk("Saved %d cycles per inference\n", (int)(copy_total / rounds) - (int)(place_total / rounds));
+    (void)sink;
+}
+
+extern "C" void tflite_run_benchmarks(void)
+{
+    benchmark_batching();
+    benchmark_zero_copy();
+    benchmark_int8();
+    benchmark_compiled();
+}
+#endif // APP_BENCHMARK
@@ -0,0 +1,69 @@
+/*
+//  window.cpp - Packing machine samples into model windows and scoring reconstructions
+*/
+
+#include "window.h"
+#include "sensor.h"
+#include <math.h>
+
+#ifdef CONFIG_CMSIS_DSP
+#include <arm_math.h>
+#endif
+
+void pack_window(MachineHandle handle, const MachineConfig* config, float* dst)
+{
+    for (int f = 0; f < MODEL_NUM_FEATURES; f++) {
+        dst[f] = 0.0f;                                              // Features the machine lacks stay at 0
+    }
+
+    // MachineConfig lists a type's sensors in its MachineLayout order, so each feature's kind is
+    // known at compile time: one switch on the type, no name lookup. A free handle has no layout.
+    withMachineLayout(fleet_type(handle), [&](auto layout) {
+        layout.forEach([&](SensorKind kind, int s) {
+            if (s >= config->num_sensors || s >= MODEL_NUM_FEATURES) return;
+            const SensorConfig* sensor = &config->sensors[s];
+            float range = sensor->max_value - sensor->min_value;
+            if (range <= 0.0f) return;                              // Skip empty sensor slots
+            dst[s] = (fleet_column(kind)[handle] - sensor->min_value) / range;
+        });
+    });
+}
+
+void reconstruction_scores(const float* in, const float* out, int num_sensors, float* mse, float* mae)
+{
+    int n = num_sensors < MODEL_NUM_FEATURES ? num_sensors : MODEL_NUM_FEATURES;
+    if (n <= 0) {
+        *mse = 0.0f;
+        *mae = 0.0f;
+        return;
+    }
+
+#ifdef CONFIG_CMSIS_DSP
+    float32_t diff[MODEL_NUM_FEATURES];
+    float32_t sum_sq;
+    arm_sub_f32(out, in, diff, n);
+    arm_power_f32(diff, n, &sum_sq);                                // Sum of squares
+    arm_abs_f32(diff, diff, n);
+    arm_mean_f32(diff, n, mae);
+    *mse = sum_sq / n;
+#else
+    // Plain reductions over restrict pointers; the compiler vectorizes these on the host
+    const float* __restrict a = in;
+    const float* __restrict b = out;
+    float sum_sq = 0.0f, sum_abs = 0.0f;
+    for (int i = 0; i < n; i++) {
+        float diff = b[i] - a[i];
+        sum_sq += diff * diff;
+        sum_abs += fabsf(diff);
+    }
+    *mse = sum_sq / n;
+    *mae = sum_abs / n;
+#endif
+}
+
+float reconstruction_error(const float* in, const float* out, int num_sensors)
+{
+    float mse, mae;
+    reconstruction_scores(in, out, num_sensors, &mse, &mae);
+    return mse;
+}
@@ -0,0 +1,77 @@
+/*
+//  window_buffer.cpp - Double-buffered windows between the sampler and inference threads
+//
+//  Two frames, one state word. The sampler only ever writes the back frame and
+//  the consumer only ever reads the front one; publishing a window flips which
+//  is which with one compare-and-swap, so nothing is copied and no lock is held
+//  while the interpreter runs. While the consumer holds the front frame the
+//  sampler simply does not flip, and keeps refreshing its back frame instead.
+*/
+
+#include "window_buffer.h"
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/util.h>
+
+#define FRONT_BIT   BIT(0)              // Index of the frame the consumer reads
+#define READY_BIT   BIT(1)              // Front frame holds a window the consumer has not taken
+#define BUSY_BIT    BIT(2)              // Consumer is reading the front frame
+
+static WindowFrame frames[2];
+static atomic_t state = ATOMIC_INIT(0);
+static K_SEM_DEFINE(ready_sem, 0, 1);
+static WindowBufferStats stats;         // Written by the sampler only
+
+extern "C" void window_buffer_write(int machine, int feature, float value)
+{
+    if (machine < 0 || machine >= WINDOW_BUFFER_MAX_MACHINES || feature < 0 || feature >= MODEL_NUM_FEATURES) {
+        return;
+    }
+
+    // Only the sampler flips FRONT_BIT, so the back frame cannot change under it
+    int back = (atomic_get(&state) & FRONT_BIT) ? 0 : 1;
+    frames[back][machine][feature] = value;
+}
+
+extern "C" bool window_buffer_publish(void)
+{
+    atomic_val_t old, next;
+    do {
+        old = atomic_get(&state);
+        if (old & BUSY_BIT) {
+            stats.deferred++;
+            return false;
+        }
+        next = (old ^ FRONT_BIT) | READY_BIT;
+    } while (!atomic_cas(&state, old, next));
+
+    if (old & READY_BIT) stats.overwritten++;
+    stats.published++;
+    k_sem_give(&ready_sem);
+    return true;
+}
+
+extern "C" const WindowFrame* window_buffer_acquire(k_timeout_t timeout)
+{
+    if (k_sem_take(&ready_sem, timeout) != 0) {
+        return NULL;
+    }
+
+    atomic_val_t old, next;
+    do {
+        old = atomic_get(&state);
+        if (!(old & READY_BIT)) return NULL;                    // Already taken
+        next = (old & ~READY_BIT) | BUSY_BIT;
+    } while (!atomic_cas(&state, old, next));
+
+    return &frames[(next & FRONT_BIT) ? 1 : 0];
+}
+
+extern "C" void window_buffer_release(void)
+{
+    atomic_and(&state, ~BUSY_BIT);
+}
+
+extern "C" void window_buffer_get_stats(WindowBufferStats* out)
+{
+    if (out != NULL) *out = stats;
+}